@@ -0,0 +1,404 @@
+extends Node
+## Tile Fetch Benchmark Sample
+##
+## Measures PLATEAUVectorTileDownloader.fetch_tiles() throughput offline:
+## - Serves generated PNG tiles from a local HTTP/1.1 server (TCPServer on a thread)
+## - Supports keep-alive, simulated latency and injected 503 errors (to exercise retries)
+## - Fetches the same tile grid with increasing max_connections
+## - Fetches once more into the warm cache to show resumable/cached behaviour
+## - Prints get_last_fetch_stats() and tiles/s for every run
+## - Checks the results: retries recover from injected errors, a warm cache issues
+##   no requests, and an interrupted fetch (missing tiles, stale .part files) resumes
+##
+## Usage:
+## 1. Adjust grid size, latency and failure rate in the panel
+## 2. Click Run Benchmark and read the results in the log (also printed to the console)
+
+@export var port: int = 18080
+@export var tile_grid: int = 16  ## Fetches tile_grid x tile_grid tiles per run
+@export var latency_ms: int = 20  ## Simulated per-response server latency
+@export var failure_rate: float = 0.02  ## Fraction of requests answered with 503
+@export var connection_counts: PackedInt32Array = [1, 2, 4, 8, 16]
+@export var tile_variants: int = 32  ## Distinct generated tile images
+
+const ZOOM := 16
+const BASE_COLUMN := 58210
+const BASE_ROW := 25800
+const CACHE_ROOT := "user://tile_fetch_benchmark"
+
+var _server: TCPServer
+var _server_thread: Thread
+var _server_running := false
+var _server_mutex := Mutex.new()
+var _served_requests := 0
+var _served_errors := 0
+var _tile_payloads: Array[PackedByteArray] = []
+var _running := false
+var _checks_passed := 0
+var _checks_failed := 0
+
+@onready var log_label: RichTextLabel = $UI/LogPanel/ScrollContainer/LogLabel
+@onready var run_button: Button = $UI/ControlPanel/RunButton
+
+
+func _ready() -> void:
+	run_button.pressed.connect(_on_run_pressed)
+	$UI/ControlPanel/GridSpin.value = tile_grid
+	$UI/ControlPanel/LatencySpin.value = latency_ms
+	$UI/ControlPanel/FailureSpin.value = failure_rate * 100.0
+
+	_log("Tile Fetch Benchmark ready.")
+	_log("A local server on 127.0.0.1:%d serves generated tiles; no network is used." % port)
+
+
+func _exit_tree() -> void:
+	_stop_server()
+
+
+func _on_run_pressed() -> void:
+	if _running:
+		return
+	_running = true
+	run_button.disabled = true
+
+	tile_grid = int($UI/ControlPanel/GridSpin.value)
+	latency_ms = int($UI/ControlPanel/LatencySpin.value)
+	failure_rate = $UI/ControlPanel/FailureSpin.value / 100.0
+
+	await _run_benchmark()
+
+	run_button.disabled = false
+	_running = false
+
+
+func _run_benchmark() -> void:
+	_log("--- Tile Fetch Benchmark ---")
+	_generate_tile_payloads()
+	if not _start_server():
+		return
+
+	var coords := _make_coords()
+	_log("Grid: %dx%d tiles (%d), latency %d ms, failures %.1f%%" % [
+		tile_grid, tile_grid, coords.size(), latency_ms, failure_rate * 100.0])
+
+	_checks_passed = 0
+	_checks_failed = 0
+
+	var last_destination := ""
+	var last_connections := 1
+	for connections in connection_counts:
+		last_destination = CACHE_ROOT.path_join("connections_%d" % connections)
+		last_connections = connections
+		_remove_directory(last_destination)
+		var before := _server_counts()
+		var stats: Dictionary = await _fetch(coords, last_destination, connections)
+		var served := _server_counts_since(before)
+		_report("%2d connections" % connections, stats)
+
+		# Every injected 503 must have been retried into a successful download
+		var label := "%d connections" % connections
+		_check(label + ": all tiles downloaded",
+			stats.get("downloaded", 0) == coords.size() and stats.get("failed", 0) == 0, stats)
+		_check(label + ": one successful request per tile",
+			served.requests - served.errors == coords.size(), served)
+
+	if not last_destination.is_empty():
+		# Second pass over a populated cache: every tile should be reused, none requested
+		var before := _server_counts()
+		var stats: Dictionary = await _fetch(coords, last_destination, last_connections)
+		var served := _server_counts_since(before)
+		_report("warm cache", stats)
+		_check("warm cache: all tiles cached",
+			stats.get("cached", 0) == coords.size() and stats.get("downloaded", 0) == 0, stats)
+		_check("warm cache: no requests sent", served.requests == 0, served)
+
+		await _check_resume(coords, last_destination, last_connections)
+
+	_server_mutex.lock()
+	_log("Server handled %d requests (%d injected errors)" % [_served_requests, _served_errors])
+	_server_mutex.unlock()
+	_stop_server()
+
+	if _checks_failed == 0:
+		_log("[color=green]All %d checks passed[/color]" % _checks_passed)
+	else:
+		_log("[color=red]%d of %d checks failed[/color]" % [_checks_failed, _checks_passed + _checks_failed])
+
+
+# Simulates an interrupted fetch: every other tile is removed, some leave a stale .part
+# file or an empty tile behind. The next fetch must reuse the rest and replace only those.
+func _check_resume(coords: Array[PLATEAUTileCoordinate], destination: String, connections: int) -> void:
+	var downloader := PLATEAUVectorTileDownloader.new()
+	downloader.url_template = "http://127.0.0.1:%d/{z}/{x}/{y}.png" % port
+	downloader.destination = destination
+
+	var removed: Array[PLATEAUTileCoordinate] = []
+	for i in range(0, coords.size(), 2):
+		var path := downloader.get_tile_file_path(coords[i])
+		DirAccess.remove_absolute(path)
+		match removed.size() % 3:
+			1:
+				var part := FileAccess.open(path + ".part", FileAccess.WRITE)
+				part.store_string("truncated")
+				part.close()
+			2:
+				FileAccess.open(path, FileAccess.WRITE).close()
+		removed.append(coords[i])
+
+	var before := _server_counts()
+	var stats: Dictionary = await _fetch(coords, destination, connections)
+	var served := _server_counts_since(before)
+	_report("resume", stats)
+
+	_check("resume: removed tiles downloaded",
+		stats.get("downloaded", 0) == removed.size() and stats.get("failed", 0) == 0, stats)
+	_check("resume: remaining tiles cached", stats.get("cached", 0) == coords.size() - removed.size(), stats)
+	_check("resume: only removed tiles requested", served.requests - served.errors == removed.size(), served)
+
+	var mismatched := 0
+	var leftover_parts := 0
+	for coord in removed:
+		var path := downloader.get_tile_file_path(coord)
+		if FileAccess.get_file_as_bytes(path) != _payload_for(coord.column, coord.row):
+			mismatched += 1
+		if FileAccess.file_exists(path + ".part"):
+			leftover_parts += 1
+	_check("resume: replaced tiles match the server", mismatched == 0, {"mismatched": mismatched})
+	_check("resume: no .part files left", leftover_parts == 0, {"leftover": leftover_parts})
+
+
+func _fetch(coords: Array[PLATEAUTileCoordinate], destination: String, connections: int) -> Dictionary:
+	var downloader := PLATEAUVectorTileDownloader.new()
+	downloader.url_template = "http://127.0.0.1:%d/{z}/{x}/{y}.png" % port
+	downloader.destination = destination
+	downloader.max_connections = connections
+	downloader.max_retries = 4
+	downloader.retry_delay_ms = 50
+	downloader.timeout_ms = 10000
+
+	# Async so the UI keeps updating; the server runs on its own thread either way
+	downloader.fetch_tiles_async(coords)
+	await downloader.fetch_completed
+	return downloader.get_last_fetch_stats()
+
+
+func _check(label: String, passed: bool, details: Dictionary) -> void:
+	if passed:
+		_checks_passed += 1
+		_log("[color=green]PASS[/color] " + label)
+	else:
+		_checks_failed += 1
+		_log("[color=red]FAIL[/color] %s  %s" % [label, str(details)])
+
+
+func _report(label: String, stats: Dictionary) -> void:
+	var seconds: float = max(stats.get("seconds", 0.0), 0.001)
+	var fetched: int = stats.get("downloaded", 0) + stats.get("cached", 0)
+	_log("%s: %.0f tiles/s, %.2f MB/s  %s" % [
+		label,
+		fetched / seconds,
+		stats.get("bytes", 0) / seconds / 1048576.0,
+		str(stats)])
+
+
+func _make_coords() -> Array[PLATEAUTileCoordinate]:
+	var coords: Array[PLATEAUTileCoordinate] = []
+	for row in range(tile_grid):
+		for column in range(tile_grid):
+			var coord := PLATEAUTileCoordinate.new()
+			coord.zoom_level = ZOOM
+			coord.column = BASE_COLUMN + column
+			coord.row = BASE_ROW + row
+			coords.append(coord)
+	return coords
+
+
+# ============================================================================
+# Generated tiles
+# ============================================================================
+
+func _generate_tile_payloads() -> void:
+	if _tile_payloads.size() == tile_variants:
+		return
+	_tile_payloads.clear()
+	var rng := RandomNumberGenerator.new()
+	rng.seed = 12345
+	for i in range(tile_variants):
+		var image := Image.create(256, 256, false, Image.FORMAT_RGB8)
+		var base := Color(rng.randf_range(0.2, 0.8), rng.randf_range(0.2, 0.8), rng.randf_range(0.2, 0.8))
+		image.fill(base)
+		# Some structure so the PNGs have a realistic size
+		for block in range(48):
+			var rect := Rect2i(rng.randi_range(0, 224), rng.randi_range(0, 224), rng.randi_range(8, 32), rng.randi_range(8, 32))
+			image.fill_rect(rect, base.lerp(Color(rng.randf(), rng.randf(), rng.randf()), 0.5))
+		_tile_payloads.append(image.save_png_to_buffer())
+	_log("Generated %d tile images (%d bytes each on average)" % [
+		_tile_payloads.size(), _average_payload_size()])
+
+
+func _payload_for(column: int, row: int) -> PackedByteArray:
+	var index := absi(hash("%d/%d" % [column, row])) % _tile_payloads.size()
+	return _tile_payloads[index]
+
+
+func _average_payload_size() -> int:
+	var total := 0
+	for payload in _tile_payloads:
+		total += payload.size()
+	return total / max(_tile_payloads.size(), 1)
+
+
+# ============================================================================
+# Local HTTP server
+# ============================================================================
+
+func _start_server() -> bool:
+	_stop_server()
+	_server = TCPServer.new()
+	var err := _server.listen(port, "127.0.0.1")
+	if err != OK:
+		_log("[color=red]Failed to listen on port %d (error %d)[/color]" % [port, err])
+		_server = null
+		return false
+	_served_requests = 0
+	_served_errors = 0
+	_server_running = true
+	_server_thread = Thread.new()
+	_server_thread.start(_server_loop)
+	return true
+
+
+func _stop_server() -> void:
+	if _server_thread:
+		_server_mutex.lock()
+		_server_running = false
+		_server_mutex.unlock()
+		_server_thread.wait_to_finish()
+		_server_thread = null
+	if _server:
+		_server.stop()
+		_server = null
+
+
+func _server_counts() -> Dictionary:
+	_server_mutex.lock()
+	var counts := {"requests": _served_requests, "errors": _served_errors}
+	_server_mutex.unlock()
+	return counts
+
+
+func _server_counts_since(before: Dictionary) -> Dictionary:
+	var now := _server_counts()
+	return {"requests": now.requests - before.requests, "errors": now.errors - before.errors}
+
+
+func _is_server_running() -> bool:
+	_server_mutex.lock()
+	var running := _server_running
+	_server_mutex.unlock()
+	return running
+
+
+# Single-threaded event loop: every connection is polled, complete requests are answered
+# once their simulated latency has elapsed, so slow responses don't block other connections
+func _server_loop() -> void:
+	var rng := RandomNumberGenerator.new()
+	var connections: Array[Dictionary] = []
+
+	while _is_server_running():
+		var idle := true
+
+		while _server.is_connection_available():
+			var peer := _server.take_connection()
+			peer.set_no_delay(true)
+			connections.append({"peer": peer, "buffer": PackedByteArray(), "pending": []})
+
+		var now := Time.get_ticks_msec()
+		for i in range(connections.size() - 1, -1, -1):
+			var connection: Dictionary = connections[i]
+			var peer: StreamPeerTCP = connection.peer
+			peer.poll()
+			if peer.get_status() != StreamPeerTCP.STATUS_CONNECTED:
+				connections.remove_at(i)
+				continue
+
+			var buffer: PackedByteArray = connection.buffer
+			var available := peer.get_available_bytes()
+			if available > 0:
+				idle = false
+				var received := peer.get_data(available)
+				if received[0] == OK:
+					buffer.append_array(received[1])
+
+			# Requests have no body, so each one ends at the blank line
+			var text := buffer.get_string_from_ascii()
+			var header_end := text.find("\r\n\r\n")
+			while header_end >= 0:
+				var request_line := text.substr(0, text.find("\r\n"))
+				buffer = buffer.slice(header_end + 4)
+				connection.pending.append([now + latency_ms, _build_response(request_line, rng)])
+				text = buffer.get_string_from_ascii()
+				header_end = text.find("\r\n\r\n")
+			connection.buffer = buffer
+
+			# HTTP/1.1 responses go out in request order
+			while not connection.pending.is_empty() and connection.pending[0][0] <= now:
+				var response: PackedByteArray = connection.pending.pop_front()[1]
+				peer.put_data(response)
+				idle = false
+
+		if idle:
+			OS.delay_usec(200)
+
+	for connection in connections:
+		connection.peer.disconnect_from_host()
+
+
+func _build_response(request_line: String, rng: RandomNumberGenerator) -> PackedByteArray:
+	# "GET /z/x/y.png HTTP/1.1"
+	var parts := request_line.split(" ")
+	var segments := parts[1].trim_prefix("/").get_basename().split("/") if parts.size() >= 2 else PackedStringArray()
+
+	var status := "200 OK"
+	var body := PackedByteArray()
+	if parts.size() < 2 or parts[0] != "GET" or segments.size() != 3:
+		status = "404 Not Found"
+	elif rng.randf() < failure_rate:
+		status = "503 Service Unavailable"
+	else:
+		body = _payload_for(int(segments[1]), int(segments[2]))
+
+	_server_mutex.lock()
+	_served_requests += 1
+	if status != "200 OK":
+		_served_errors += 1
+	_server_mutex.unlock()
+
+	var header := "HTTP/1.1 %s\r\nContent-Type: image/png\r\nContent-Length: %d\r\nConnection: keep-alive\r\n\r\n" % [status, body.size()]
+	var response := header.to_ascii_buffer()
+	response.append_array(body)
+	return response
+
+
+# ============================================================================
+# Helpers
+# ============================================================================
+
+func _remove_directory(path: String) -> void:
+	var dir := DirAccess.open(path)
+	if dir == null:
+		return
+	for sub in dir.get_directories():
+		_remove_directory(path.path_join(sub))
+	for file in dir.get_files():
+		dir.remove(file)
+	DirAccess.remove_absolute(path)
+
+
+func _log(message: String) -> void:
+	var timestamp = Time.get_time_string_from_system()
+	log_label.text += "[" + timestamp + "] " + message + "\n"
+	await get_tree().process_frame
+	var scroll = $UI/LogPanel/ScrollContainer as ScrollContainer
+	scroll.scroll_vertical = scroll.get_v_scroll_bar().max_value
+	print(message)
@@ -6,6 +6,13 @@
 #include <godot_cpp/classes/dir_access.hpp>
 #include <godot_cpp/classes/project_settings.hpp>
 #include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/http_client.hpp>
+#include <godot_cpp/classes/tls_options.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/classes/rendering_server.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#include <atomic>
+#include <cstring>
 #include <mutex>
 
 using namespace godot;
@@ -120,16 +127,45 @@ bool PLATEAUVectorTile::is_success() const {
     return success_;
 }
 
-Ref<Image> PLATEAUVectorTile::load_image() const {
-    if (!success_ || image_path_.is_empty()) {
-        return Ref<Image>();
-    }
+void PLATEAUVectorTile::set_tile_pack(const Ref<PLATEAUTilePack> &pack) {
+    tile_pack_ = pack;
+}
+
+Ref<PLATEAUTilePack> PLATEAUVectorTile::get_tile_pack() const {
+    return tile_pack_;
+}
 
+Ref<Image> PLATEAUVectorTile::load_image() const {
     // Return cached image if available
     if (cached_image_.is_valid()) {
         return cached_image_;
     }
 
+    Ref<Image> image = load_image_uncached();
+
+    // Cache the loaded image for subsequent calls
+    cached_image_ = image;
+    return image;
+}
+
+Ref<Image> PLATEAUVectorTile::load_image_uncached() const {
+    if (!success_) {
+        return Ref<Image>();
+    }
+
+    if (image_path_.is_empty()) {
+        if (tile_pack_.is_null() || coordinate_.is_null()) {
+            return Ref<Image>();
+        }
+        Ref<Image> image = tile_pack_->load_tile_image(coordinate_->get_zoom_level(),
+                                                       coordinate_->get_column(), coordinate_->get_row());
+        if (image.is_null()) {
+            UtilityFunctions::printerr("PLATEAUVectorTile: Failed to load tile from pack: ",
+                                       coordinate_->get_column(), "/", coordinate_->get_row());
+        }
+        return image;
+    }
+
     Ref<Image> image;
     image.instantiate();
 
@@ -138,9 +174,6 @@ Ref<Image> PLATEAUVectorTile::load_image() const {
         UtilityFunctions::printerr("PLATEAUVectorTile: Failed to load image: ", image_path_);
         return Ref<Image>();
     }
-
-    // Cache the loaded image for subsequent calls
-    cached_image_ = image;
     return image;
 }
 
@@ -169,6 +202,10 @@ void PLATEAUVectorTile::_bind_methods() {
     ClassDB::bind_method(D_METHOD("set_success", "success"), &PLATEAUVectorTile::set_success);
     ClassDB::bind_method(D_METHOD("is_success"), &PLATEAUVectorTile::is_success);
 
+    ClassDB::bind_method(D_METHOD("set_tile_pack", "pack"), &PLATEAUVectorTile::set_tile_pack);
+    ClassDB::bind_method(D_METHOD("get_tile_pack"), &PLATEAUVectorTile::get_tile_pack);
+    ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "tile_pack", PROPERTY_HINT_RESOURCE_TYPE, "PLATEAUTilePack"), "set_tile_pack", "get_tile_pack");
+
     ClassDB::bind_method(D_METHOD("load_image"), &PLATEAUVectorTile::load_image);
     ClassDB::bind_method(D_METHOD("load_texture"), &PLATEAUVectorTile::load_texture);
     ClassDB::bind_method(D_METHOD("clear_image_cache"), &PLATEAUVectorTile::clear_image_cache);
@@ -178,9 +215,33 @@ void PLATEAUVectorTile::_bind_methods() {
 // PLATEAUVectorTileDownloader
 // ============================================================================
 
+// Copy a tightly packed tile image into a larger row-major buffer
+static void copy_tile_rows(uint8_t *dst, size_t dst_row_bytes, const uint8_t *src,
+                           int width, int height, size_t pixel_size) {
+    size_t src_row_bytes = static_cast<size_t>(width) * pixel_size;
+    for (int r = 0; r < height; r++) {
+        memcpy(dst + r * dst_row_bytes, src + r * src_row_bytes, src_row_bytes);
+    }
+}
+
+// Fill a rectangle of a row-major buffer with a single pixel value
+static void fill_tile_rows(uint8_t *dst, size_t dst_row_bytes, const uint8_t *pixel,
+                           int width, int height, size_t pixel_size) {
+    for (int r = 0; r < height; r++) {
+        uint8_t *row_ptr = dst + r * dst_row_bytes;
+        for (int c = 0; c < width; c++) {
+            memcpy(row_ptr + c * pixel_size, pixel, pixel_size);
+        }
+    }
+}
+
 PLATEAUVectorTileDownloader::PLATEAUVectorTileDownloader()
     : zoom_level_(15),
-      tile_source_(TILE_SOURCE_GSI_PHOTO)
+      tile_source_(TILE_SOURCE_GSI_PHOTO),
+      max_connections_(4),
+      max_retries_(3),
+      retry_delay_ms_(250),
+      timeout_ms_(30000)
 #ifndef PLATEAU_MOBILE_PLATFORM
     , extent_(plateau::geometry::GeoCoordinate(0, 0, 0),
               plateau::geometry::GeoCoordinate(0, 0, 0))
@@ -428,17 +489,14 @@ Ref<PLATEAUVectorTile> PLATEAUVectorTileDownloader::download_tile(const Ref<PLAT
         return result;
     }
 
-    // NOTE: libplateau's HTTP client (cpp-httplib with OpenSSL) crashes on Windows.
-    // Use get_tile_url() and get_tile_file_path() with Godot's HTTPRequest instead.
-    // See basemap_sample.gd for GDScript-based download implementation.
-
-    result->set_coordinate(coord);
-    result->set_image_path("");
-    result->set_success(false);
-
-    UtilityFunctions::printerr("PLATEAUVectorTileDownloader::download_tile - C++ HTTP disabled. Use GDScript HTTPRequest instead.");
-    UtilityFunctions::print("  URL: ", get_tile_url(coord));
-    UtilityFunctions::print("  File: ", get_tile_file_path(coord));
+    // libplateau's HTTP client (cpp-httplib with OpenSSL) crashes on Windows,
+    // so single tiles go through the HTTPClient-based fetcher instead.
+    TypedArray<PLATEAUTileCoordinate> coords;
+    coords.push_back(coord);
+    TypedArray<PLATEAUVectorTile> fetched = fetch_tiles(coords);
+    if (fetched.size() == 1) {
+        result = fetched[0];
+    }
 
     return result;
 }
@@ -490,39 +548,423 @@ TypedArray<PLATEAUVectorTile> PLATEAUVectorTileDownloader::download_all() {
     return result;
 }
 
+// Host part of a tile URL template, shared by all fetch connections
+struct TileHost {
+    String host;
+    int port = -1;
+    bool tls = false;
+    int prefix_length = 0;   // Length of "scheme://host[:port]" in generated URLs
+};
+
+static bool parse_tile_host(const String &url_template, TileHost &out) {
+    int scheme_end = url_template.find("://");
+    if (scheme_end < 0) {
+        return false;
+    }
+    String scheme = url_template.substr(0, scheme_end).to_lower();
+    if (scheme != "http" && scheme != "https") {
+        return false;
+    }
+    out.tls = scheme == "https";
+
+    int host_start = scheme_end + 3;
+    int path_start = url_template.find("/", host_start);
+    if (path_start < 0) {
+        path_start = url_template.length();
+    }
+    String host_port = url_template.substr(host_start, path_start - host_start);
+    int colon = host_port.rfind(":");
+    if (colon >= 0) {
+        out.host = host_port.substr(0, colon);
+        out.port = host_port.substr(colon + 1).to_int();
+    } else {
+        out.host = host_port;
+        out.port = out.tls ? 443 : 80;
+    }
+    out.prefix_length = path_start;
+    return !out.host.is_empty();
+}
+
+// Poll until the client leaves the given transient status; false on timeout
+static bool poll_http_while(const Ref<HTTPClient> &client, HTTPClient::Status transient, uint64_t deadline_ms) {
+    while (client->get_status() == transient) {
+        client->poll();
+        if (Time::get_singleton()->get_ticks_msec() > deadline_ms) {
+            return false;
+        }
+        OS::get_singleton()->delay_usec(500);
+    }
+    return true;
+}
+
+static bool ensure_http_connected(const Ref<HTTPClient> &client, const TileHost &host, uint64_t deadline_ms) {
+    if (client->get_status() == HTTPClient::STATUS_CONNECTED) {
+        return true;   // Keep-alive connection from the previous tile
+    }
+    client->close();
+    Ref<TLSOptions> tls_options = host.tls ? TLSOptions::client() : Ref<TLSOptions>();
+    if (client->connect_to_host(host.host, host.port, tls_options) != OK) {
+        return false;
+    }
+    while (client->get_status() == HTTPClient::STATUS_RESOLVING ||
+           client->get_status() == HTTPClient::STATUS_CONNECTING) {
+        client->poll();
+        if (Time::get_singleton()->get_ticks_msec() > deadline_ms) {
+            return false;
+        }
+        OS::get_singleton()->delay_usec(500);
+    }
+    return client->get_status() == HTTPClient::STATUS_CONNECTED;
+}
+
+enum TileFetchStatus {
+    TILE_FETCH_OK,
+    TILE_FETCH_RETRY,      // Transient failure (connection, timeout, 5xx, 429)
+    TILE_FETCH_FAILED      // Permanent failure (other HTTP errors)
+};
+
+// One GET on an open connection. Leaves the connection reusable on success.
+static TileFetchStatus fetch_tile_once(const Ref<HTTPClient> &client, const TileHost &host,
+                                       const String &path, int timeout_ms, PackedByteArray &out_body) {
+    uint64_t deadline = Time::get_singleton()->get_ticks_msec() + timeout_ms;
+    if (!ensure_http_connected(client, host, deadline)) {
+        client->close();
+        return TILE_FETCH_RETRY;
+    }
+
+    PackedStringArray headers;
+    headers.push_back("User-Agent: godot-plateau");
+    headers.push_back("Accept: image/*");
+    headers.push_back("Connection: keep-alive");
+    if (client->request(HTTPClient::METHOD_GET, path, headers) != OK ||
+        !poll_http_while(client, HTTPClient::STATUS_REQUESTING, deadline) ||
+        !client->has_response()) {
+        client->close();
+        return TILE_FETCH_RETRY;
+    }
+
+    int code = client->get_response_code();
+    out_body.clear();
+    while (client->get_status() == HTTPClient::STATUS_BODY) {
+        client->poll();
+        PackedByteArray chunk = client->read_response_body_chunk();
+        if (chunk.is_empty()) {
+            if (Time::get_singleton()->get_ticks_msec() > deadline) {
+                client->close();
+                return TILE_FETCH_RETRY;
+            }
+            OS::get_singleton()->delay_usec(500);
+        } else {
+            out_body.append_array(chunk);
+        }
+    }
+
+    HTTPClient::Status status = client->get_status();
+    if (status != HTTPClient::STATUS_CONNECTED && status != HTTPClient::STATUS_DISCONNECTED) {
+        client->close();
+        return TILE_FETCH_RETRY;
+    }
+    if (code == 200 && !out_body.is_empty()) {
+        return TILE_FETCH_OK;
+    }
+    if (code == 429 || code >= 500 || code == 0) {
+        return TILE_FETCH_RETRY;
+    }
+    return TILE_FETCH_FAILED;
+}
+
+// Write via a temporary file so an interrupted fetch never leaves a truncated tile behind
+static bool write_tile_file(const String &path, const PackedByteArray &data) {
+    DirAccess::make_dir_recursive_absolute(path.get_base_dir());
+    String temp_path = path + ".part";
+    {
+        Ref<FileAccess> file = FileAccess::open(temp_path, FileAccess::WRITE);
+        if (file.is_null()) {
+            return false;
+        }
+        file->store_buffer(data);
+        file->close();
+    }
+    if (FileAccess::file_exists(path)) {
+        DirAccess::remove_absolute(path);
+    }
+    return DirAccess::rename_absolute(temp_path, path) == OK;
+}
+
+TypedArray<PLATEAUVectorTile> PLATEAUVectorTileDownloader::fetch_tiles(const TypedArray<PLATEAUTileCoordinate> &coords) {
+    TypedArray<PLATEAUVectorTile> result;
+    int count = coords.size();
+    if (count == 0) {
+        return result;
+    }
+
+    // Tiles go into the pack if one is open for writing, otherwise into destination
+    Ref<PLATEAUTilePack> pack = tile_pack_;
+    bool use_pack = pack.is_valid() && pack->is_writable();
+    ERR_FAIL_COND_V_MSG(!use_pack && destination_.is_empty(), result,
+        "PLATEAUVectorTileDownloader: destination is not set");
+    TileHost host;
+    ERR_FAIL_COND_V_MSG(!parse_tile_host(url_template_, host), result,
+        "PLATEAUVectorTileDownloader: Unsupported URL template: " + url_template_);
+
+    // Resolve URLs and paths up front; workers only touch plain strings
+    struct FetchJob {
+        String path;         // Request path on the host
+        String file_path;
+        int zoom = 0;
+        int column = 0;
+        int row = 0;
+        bool valid = false;
+        bool success = false;
+        bool cached = false;
+        int64_t bytes = 0;
+    };
+    std::vector<FetchJob> jobs(count);
+    for (int i = 0; i < count; i++) {
+        Ref<PLATEAUTileCoordinate> coord = coords[i];
+        if (coord.is_null()) {
+            continue;
+        }
+        String url = get_tile_url(coord);
+        jobs[i].path = url.substr(host.prefix_length);
+        if (jobs[i].path.is_empty()) {
+            jobs[i].path = "/";
+        }
+        jobs[i].file_path = use_pack ? String() : get_tile_file_path(coord);
+        jobs[i].zoom = coord->get_zoom_level();
+        jobs[i].column = coord->get_column();
+        jobs[i].row = coord->get_row();
+        jobs[i].valid = true;
+    }
+
+    uint64_t start_ms = Time::get_singleton()->get_ticks_msec();
+    std::atomic<int> next_job{0};
+    int connections = Math::clamp(max_connections_, 1, count);
+    int max_retries = Math::max(max_retries_, 0);
+    int retry_delay_ms = Math::max(retry_delay_ms_, 0);
+    int timeout_ms = Math::max(timeout_ms_, 1);
+    bool report_progress = is_fetching_.load();
+    std::atomic<int> done_count{0};
+
+    // One thread per connection; each keeps its HTTPClient alive across tiles
+    plateau_parallel::parallel_for(0, static_cast<size_t>(connections), [&](size_t) {
+        Ref<HTTPClient> client;
+        client.instantiate();
+        PackedByteArray body;
+
+        for (int i = next_job.fetch_add(1); i < count; i = next_job.fetch_add(1)) {
+            FetchJob &job = jobs[i];
+            if (job.valid) {
+                bool exists = false;
+                if (use_pack) {
+                    exists = pack->has_tile(job.zoom, job.column, job.row);
+                } else {
+                    Ref<FileAccess> existing = FileAccess::open(job.file_path, FileAccess::READ);
+                    exists = existing.is_valid() && existing->get_length() > 0;
+                }
+                if (exists) {
+                    job.success = true;
+                    job.cached = true;
+                } else {
+                    int delay = retry_delay_ms;
+                    for (int attempt = 0; attempt <= max_retries; attempt++) {
+                        TileFetchStatus status = fetch_tile_once(client, host, job.path, timeout_ms, body);
+                        if (status == TILE_FETCH_OK) {
+                            job.success = use_pack ? pack->store_tile(job.zoom, job.column, job.row, body)
+                                                   : write_tile_file(job.file_path, body);
+                            job.bytes = body.size();
+                            break;
+                        }
+                        if (status == TILE_FETCH_FAILED || attempt == max_retries) {
+                            break;
+                        }
+                        OS::get_singleton()->delay_usec(static_cast<uint32_t>(delay) * 1000);
+                        delay *= 2;
+                    }
+                }
+            }
+
+            int done = done_count.fetch_add(1) + 1;
+            if (report_progress) {
+                call_deferred("emit_signal", "fetch_progress", done, count);
+            }
+        }
+        client->close();
+    }, 1, static_cast<unsigned int>(connections));
+
+    if (use_pack) {
+        pack->flush();
+    }
+
+    int downloaded = 0;
+    int cached = 0;
+    int failed = 0;
+    int64_t bytes = 0;
+    for (int i = 0; i < count; i++) {
+        Ref<PLATEAUVectorTile> tile;
+        tile.instantiate();
+        tile->set_coordinate(coords[i]);
+        tile->set_image_path(jobs[i].success ? jobs[i].file_path : String());
+        tile->set_success(jobs[i].success);
+        if (use_pack) {
+            tile->set_tile_pack(pack);
+        }
+        result.push_back(tile);
+
+        if (!jobs[i].success) {
+            failed++;
+        } else if (jobs[i].cached) {
+            cached++;
+        } else {
+            downloaded++;
+        }
+        bytes += jobs[i].bytes;
+    }
+
+    double seconds = (Time::get_singleton()->get_ticks_msec() - start_ms) / 1000.0;
+    Dictionary stats;
+    stats["requested"] = count;
+    stats["downloaded"] = downloaded;
+    stats["cached"] = cached;
+    stats["failed"] = failed;
+    stats["bytes"] = bytes;
+    stats["seconds"] = seconds;
+    {
+        std::lock_guard<std::mutex> lock(fetch_stats_mutex_);
+        last_fetch_stats_ = stats;
+    }
+
+    UtilityFunctions::print("PLATEAUVectorTileDownloader: Fetched ", downloaded, " tiles (", cached,
+                           " cached, ", failed, " failed) in ", seconds, "s");
+    return result;
+}
+
+TypedArray<PLATEAUVectorTile> PLATEAUVectorTileDownloader::fetch_all() {
+    TypedArray<PLATEAUTileCoordinate> coords;
+    int count = get_tile_count();
+    for (int i = 0; i < count; i++) {
+        coords.push_back(get_tile_coordinate(i));
+    }
+    return fetch_tiles(coords);
+}
+
+void PLATEAUVectorTileDownloader::fetch_tiles_async(const TypedArray<PLATEAUTileCoordinate> &coords) {
+    if (is_fetching_.load()) {
+        UtilityFunctions::printerr("PLATEAUVectorTileDownloader: Already fetching, cannot start new fetch");
+        return;
+    }
+
+    is_fetching_.store(true);
+    pending_fetch_coords_ = coords;
+
+    WorkerThreadPool::get_singleton()->add_task(
+        callable_mp(this, &PLATEAUVectorTileDownloader::_fetch_thread_func)
+    );
+}
+
+void PLATEAUVectorTileDownloader::_fetch_thread_func() {
+    TypedArray<PLATEAUVectorTile> tiles = fetch_tiles(pending_fetch_coords_);
+    pending_fetch_coords_ = TypedArray<PLATEAUTileCoordinate>();
+    is_fetching_.store(false);
+
+    call_deferred("emit_signal", "fetch_completed", tiles);
+}
+
+bool PLATEAUVectorTileDownloader::is_fetching() const {
+    return is_fetching_.load();
+}
+
+void PLATEAUVectorTileDownloader::set_max_connections(int count) {
+    max_connections_ = Math::max(count, 1);
+}
+
+int PLATEAUVectorTileDownloader::get_max_connections() const {
+    return max_connections_;
+}
+
+void PLATEAUVectorTileDownloader::set_max_retries(int count) {
+    max_retries_ = Math::max(count, 0);
+}
+
+int PLATEAUVectorTileDownloader::get_max_retries() const {
+    return max_retries_;
+}
+
+void PLATEAUVectorTileDownloader::set_retry_delay_ms(int delay) {
+    retry_delay_ms_ = Math::max(delay, 0);
+}
+
+int PLATEAUVectorTileDownloader::get_retry_delay_ms() const {
+    return retry_delay_ms_;
+}
+
+void PLATEAUVectorTileDownloader::set_timeout_ms(int timeout) {
+    timeout_ms_ = Math::max(timeout, 1);
+}
+
+int PLATEAUVectorTileDownloader::get_timeout_ms() const {
+    return timeout_ms_;
+}
+
+Dictionary PLATEAUVectorTileDownloader::get_last_fetch_stats() const {
+    std::lock_guard<std::mutex> lock(fetch_stats_mutex_);
+    return last_fetch_stats_;
+}
+
+void PLATEAUVectorTileDownloader::set_tile_pack(const Ref<PLATEAUTilePack> &pack) {
+    tile_pack_ = pack;
+}
+
+Ref<PLATEAUTilePack> PLATEAUVectorTileDownloader::get_tile_pack() const {
+    return tile_pack_;
+}
+
 Ref<ImageTexture> PLATEAUVectorTileDownloader::create_combined_texture(const TypedArray<PLATEAUVectorTile> &tiles) {
-    if (tiles.is_empty()) {
+    Ref<Image> combined = create_combined_image(tiles);
+    if (combined.is_null()) {
         return Ref<ImageTexture>();
     }
+    return ImageTexture::create_from_image(combined);
+}
+
+Ref<Image> PLATEAUVectorTileDownloader::create_combined_image(const TypedArray<PLATEAUVectorTile> &tiles) {
+    if (tiles.is_empty()) {
+        return Ref<Image>();
+    }
 
     int tile_count = tiles.size();
 
-    // Find min/max column and row using parallel reduction
+    // Find min/max column and row with thread-local bounds merged at the end
     struct MinMax {
         int min_col = INT_MAX, max_col = INT_MIN;
         int min_row = INT_MAX, max_row = INT_MIN;
     };
 
     MinMax bounds;
-    std::mutex bounds_mutex;
-
-    plateau_parallel::parallel_for(0, static_cast<size_t>(tile_count), [&](size_t i) {
-        Ref<PLATEAUVectorTile> tile = tiles[i];
-        if (tile.is_null() || tile->get_coordinate().is_null()) return;
-
-        Ref<PLATEAUTileCoordinate> coord = tile->get_coordinate();
-        int col = coord->get_column();
-        int row = coord->get_row();
 
-        std::lock_guard<std::mutex> lock(bounds_mutex);
-        bounds.min_col = Math::min(bounds.min_col, col);
-        bounds.max_col = Math::max(bounds.max_col, col);
-        bounds.min_row = Math::min(bounds.min_row, row);
-        bounds.max_row = Math::max(bounds.max_row, row);
-    }, 10);  // Small min_chunk since this is quick per item
+    plateau_parallel::parallel_for_reduce<MinMax>(0, static_cast<size_t>(tile_count),
+        []() { return MinMax(); },
+        [&](size_t i, MinMax &local) {
+            Ref<PLATEAUVectorTile> tile = tiles[i];
+            if (tile.is_null() || tile->get_coordinate().is_null()) return;
+
+            Ref<PLATEAUTileCoordinate> coord = tile->get_coordinate();
+            int col = coord->get_column();
+            int row = coord->get_row();
+            local.min_col = Math::min(local.min_col, col);
+            local.max_col = Math::max(local.max_col, col);
+            local.min_row = Math::min(local.min_row, row);
+            local.max_row = Math::max(local.max_row, row);
+        },
+        [&](const MinMax &local) {
+            bounds.min_col = Math::min(bounds.min_col, local.min_col);
+            bounds.max_col = Math::max(bounds.max_col, local.max_col);
+            bounds.min_row = Math::min(bounds.min_row, local.min_row);
+            bounds.max_row = Math::max(bounds.max_row, local.max_row);
+        }, 64);
 
     if (bounds.min_col > bounds.max_col || bounds.min_row > bounds.max_row) {
-        return Ref<ImageTexture>();
+        return Ref<Image>();
     }
 
     int min_col = bounds.min_col;
@@ -546,31 +988,27 @@ Ref<ImageTexture> PLATEAUVectorTileDownloader::create_combined_texture(const Typ
                 tile_width = img->get_width();
                 tile_height = img->get_height();
                 format = img->get_format();
+                if (img->is_compressed()) {
+                    // Compressed formats cannot be written per pixel
+                    format = Image::FORMAT_RGBA8;
+                }
                 break;
             }
         }
     }
 
-    // Create combined image
-    int combined_width = cols * tile_width;
-    int combined_height = rows * tile_height;
-
-    Ref<Image> combined = Image::create_empty(combined_width, combined_height, false, format);
-    if (combined.is_null()) {
+    // Gray background for missing tiles, encoded in the combined format
+    Ref<Image> background = Image::create_empty(1, 1, false, format);
+    if (background.is_null()) {
         UtilityFunctions::printerr("PLATEAUVectorTileDownloader: Failed to create combined image");
-        return Ref<ImageTexture>();
+        return Ref<Image>();
     }
-    combined->fill(Color(0.5, 0.5, 0.5, 1.0)); // Gray background for missing tiles
+    background->fill(Color(0.5, 0.5, 0.5, 1.0));
+    PackedByteArray background_pixel = background->get_data();
+    size_t pixel_size = static_cast<size_t>(background_pixel.size());
 
     // Pre-load and convert all tile images in parallel
-    // Store results for serial blit (blit_rect may not be thread-safe)
-    struct TileData {
-        Ref<Image> image;
-        int x = 0;
-        int y = 0;
-        bool valid = false;
-    };
-    std::vector<TileData> tile_data(tile_count);
+    std::vector<Ref<Image>> tile_images(tile_count);
 
     plateau_parallel::parallel_for(0, static_cast<size_t>(tile_count), [&](size_t i) {
         Ref<PLATEAUVectorTile> tile = tiles[i];
@@ -579,30 +1017,67 @@ Ref<ImageTexture> PLATEAUVectorTileDownloader::create_combined_texture(const Typ
         Ref<Image> tile_img = tile->load_image();
         if (tile_img.is_null()) return;
 
-        // Convert format if needed (this is the expensive operation)
-        if (tile_img->get_format() != format) {
-            // Create a copy to avoid modifying cached image
+        // Convert format / size if needed (copy to avoid modifying the cached image)
+        if (tile_img->get_format() != format ||
+            tile_img->get_width() != tile_width || tile_img->get_height() != tile_height) {
             tile_img = tile_img->duplicate();
-            tile_img->convert(format);
+            if (tile_img->is_compressed()) {
+                tile_img->decompress();
+            }
+            if (tile_img->get_format() != format) {
+                tile_img->convert(format);
+            }
+            if (tile_img->get_width() != tile_width || tile_img->get_height() != tile_height) {
+                tile_img->resize(tile_width, tile_height);
+            }
         }
-
-        Ref<PLATEAUTileCoordinate> coord = tile->get_coordinate();
-        tile_data[i].image = tile_img;
-        tile_data[i].x = (coord->get_column() - min_col) * tile_width;
-        tile_data[i].y = (coord->get_row() - min_row) * tile_height;
-        tile_data[i].valid = true;
+        tile_images[i] = tile_img;
     }, 1);  // Process each tile in parallel (disk I/O bound)
 
-    // Serial blit to combined image (ensure thread safety)
+    // Map grid cells to tiles (later tiles win, as with sequential blitting)
+    std::vector<int> cell_tiles(static_cast<size_t>(cols) * rows, -1);
     for (int i = 0; i < tile_count; i++) {
-        if (tile_data[i].valid) {
-            combined->blit_rect(tile_data[i].image,
-                               Rect2i(0, 0, tile_width, tile_height),
-                               Vector2i(tile_data[i].x, tile_data[i].y));
-        }
+        if (tile_images[i].is_null()) continue;
+        Ref<PLATEAUVectorTile> tile = tiles[i];
+        Ref<PLATEAUTileCoordinate> coord = tile->get_coordinate();
+        int x = coord->get_column() - min_col;
+        int y = coord->get_row() - min_row;
+        cell_tiles[static_cast<size_t>(y) * cols + x] = i;
     }
 
-    return ImageTexture::create_from_image(combined);
+    // Create combined image
+    int combined_width = cols * tile_width;
+    int combined_height = rows * tile_height;
+
+    PackedByteArray combined_data;
+    if (combined_data.resize(static_cast<int64_t>(combined_width) * combined_height * pixel_size) != OK) {
+        UtilityFunctions::printerr("PLATEAUVectorTileDownloader: Failed to create combined image");
+        return Ref<Image>();
+    }
+    uint8_t *dst = combined_data.ptrw();
+    const uint8_t *gray = background_pixel.ptr();
+    size_t combined_row_bytes = static_cast<size_t>(combined_width) * pixel_size;
+
+    // Each cell owns a disjoint rectangle of the destination buffer, so cells are written in parallel
+    plateau_parallel::parallel_for(0, cell_tiles.size(), [&](size_t cell) {
+        size_t x = (cell % cols) * static_cast<size_t>(tile_width);
+        size_t y = (cell / cols) * static_cast<size_t>(tile_height);
+        uint8_t *origin = dst + y * combined_row_bytes + x * pixel_size;
+
+        int tile_index = cell_tiles[cell];
+        if (tile_index >= 0) {
+            PackedByteArray src_data = tile_images[tile_index]->get_data();
+            copy_tile_rows(origin, combined_row_bytes, src_data.ptr(), tile_width, tile_height, pixel_size);
+        } else {
+            fill_tile_rows(origin, combined_row_bytes, gray, tile_width, tile_height, pixel_size);
+        }
+    }, 4);
+
+    Ref<Image> combined = Image::create_from_data(combined_width, combined_height, false, format, combined_data);
+    if (combined.is_null()) {
+        UtilityFunctions::printerr("PLATEAUVectorTileDownloader: Failed to create combined image");
+    }
+    return combined;
 }
 
 String PLATEAUVectorTileDownloader::get_tile_path(int index) const {
@@ -745,8 +1220,38 @@ void PLATEAUVectorTileDownloader::_bind_methods() {
     ClassDB::bind_method(D_METHOD("get_tile_url", "coord"), &PLATEAUVectorTileDownloader::get_tile_url);
     ClassDB::bind_method(D_METHOD("get_tile_file_path", "coord"), &PLATEAUVectorTileDownloader::get_tile_file_path);
     ClassDB::bind_method(D_METHOD("download_all"), &PLATEAUVectorTileDownloader::download_all);
+    ClassDB::bind_method(D_METHOD("fetch_tiles", "coords"), &PLATEAUVectorTileDownloader::fetch_tiles);
+    ClassDB::bind_method(D_METHOD("fetch_all"), &PLATEAUVectorTileDownloader::fetch_all);
+    ClassDB::bind_method(D_METHOD("fetch_tiles_async", "coords"), &PLATEAUVectorTileDownloader::fetch_tiles_async);
+    ClassDB::bind_method(D_METHOD("is_fetching"), &PLATEAUVectorTileDownloader::is_fetching);
+    ClassDB::bind_method(D_METHOD("get_last_fetch_stats"), &PLATEAUVectorTileDownloader::get_last_fetch_stats);
+
+    ClassDB::bind_method(D_METHOD("set_max_connections", "count"), &PLATEAUVectorTileDownloader::set_max_connections);
+    ClassDB::bind_method(D_METHOD("get_max_connections"), &PLATEAUVectorTileDownloader::get_max_connections);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "max_connections"), "set_max_connections", "get_max_connections");
+
+    ClassDB::bind_method(D_METHOD("set_max_retries", "count"), &PLATEAUVectorTileDownloader::set_max_retries);
+    ClassDB::bind_method(D_METHOD("get_max_retries"), &PLATEAUVectorTileDownloader::get_max_retries);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "max_retries"), "set_max_retries", "get_max_retries");
+
+    ClassDB::bind_method(D_METHOD("set_retry_delay_ms", "delay"), &PLATEAUVectorTileDownloader::set_retry_delay_ms);
+    ClassDB::bind_method(D_METHOD("get_retry_delay_ms"), &PLATEAUVectorTileDownloader::get_retry_delay_ms);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "retry_delay_ms"), "set_retry_delay_ms", "get_retry_delay_ms");
+
+    ClassDB::bind_method(D_METHOD("set_timeout_ms", "timeout"), &PLATEAUVectorTileDownloader::set_timeout_ms);
+    ClassDB::bind_method(D_METHOD("get_timeout_ms"), &PLATEAUVectorTileDownloader::get_timeout_ms);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "timeout_ms"), "set_timeout_ms", "get_timeout_ms");
+
+    ClassDB::bind_method(D_METHOD("set_tile_pack", "pack"), &PLATEAUVectorTileDownloader::set_tile_pack);
+    ClassDB::bind_method(D_METHOD("get_tile_pack"), &PLATEAUVectorTileDownloader::get_tile_pack);
+    ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "tile_pack", PROPERTY_HINT_RESOURCE_TYPE, "PLATEAUTilePack"), "set_tile_pack", "get_tile_pack");
+
+    ADD_SIGNAL(MethodInfo("fetch_progress", PropertyInfo(Variant::INT, "done"), PropertyInfo(Variant::INT, "total")));
+    ADD_SIGNAL(MethodInfo("fetch_completed", PropertyInfo(Variant::ARRAY, "tiles")));
     ClassDB::bind_method(D_METHOD("create_combined_texture", "tiles"),
                          &PLATEAUVectorTileDownloader::create_combined_texture);
+    ClassDB::bind_method(D_METHOD("create_combined_image", "tiles"),
+                         &PLATEAUVectorTileDownloader::create_combined_image);
     ClassDB::bind_method(D_METHOD("get_tile_path", "index"), &PLATEAUVectorTileDownloader::get_tile_path);
 
     ClassDB::bind_static_method("PLATEAUVectorTileDownloader", D_METHOD("get_default_url"),
@@ -764,3 +1269,532 @@ void PLATEAUVectorTileDownloader::_bind_methods() {
     BIND_ENUM_CONSTANT(TILE_SOURCE_OSM);
     BIND_ENUM_CONSTANT(TILE_SOURCE_CUSTOM);
 }
+
+// ============================================================================
+// PLATEAUBasemapAtlas
+// ============================================================================
+
+static const Color ATLAS_MISSING_TILE_COLOR(0.5, 0.5, 0.5, 1.0);
+
+// Set once Image::compress() has failed; later pages skip compression instead of failing again
+static std::atomic<bool> atlas_compress_unavailable(false);
+
+// Pick a GPU compression format the current renderer can sample
+static int select_atlas_compress_mode() {
+    // The S3TC / BPTC / ETC2 encoders are only compiled into editor builds, not export templates
+    if (atlas_compress_unavailable.load() || !OS::get_singleton()->has_feature("editor")) {
+        return -1;
+    }
+    RenderingServer *rs = RenderingServer::get_singleton();
+    if (!rs) {
+        return -1;
+    }
+    // S3TC compresses much faster than BPTC and is enough for aerial photos
+    if (rs->has_os_feature("s3tc")) {
+        return Image::COMPRESS_S3TC;
+    }
+    if (rs->has_os_feature("bptc")) {
+        return Image::COMPRESS_BPTC;
+    }
+    if (rs->has_os_feature("etc2")) {
+        return Image::COMPRESS_ETC2;
+    }
+    return -1;
+}
+
+PLATEAUBasemapAtlas::PLATEAUBasemapAtlas()
+    : min_col_(0),
+      min_row_(0),
+      cols_(0),
+      rows_(0),
+      tiles_per_page_(8),
+      compress_(true),
+      generate_mipmaps_(true),
+      max_resident_pages_(16),
+      page_cols_(0),
+      page_rows_(0),
+      use_counter_(0) {
+}
+
+PLATEAUBasemapAtlas::~PLATEAUBasemapAtlas() {
+    wait_for_pending_pages();
+}
+
+void PLATEAUBasemapAtlas::set_tiles(const TypedArray<PLATEAUVectorTile> &tiles) {
+    wait_for_pending_pages();
+
+    tiles_ = tiles;
+    tile_grid_.clear();
+    min_col_ = 0;
+    min_row_ = 0;
+    cols_ = 0;
+    rows_ = 0;
+
+    int min_col = INT_MAX, max_col = INT_MIN;
+    int min_row = INT_MAX, max_row = INT_MIN;
+    for (int i = 0; i < tiles_.size(); i++) {
+        Ref<PLATEAUVectorTile> tile = tiles_[i];
+        if (tile.is_null() || tile->get_coordinate().is_null()) {
+            continue;
+        }
+        Ref<PLATEAUTileCoordinate> coord = tile->get_coordinate();
+        min_col = Math::min(min_col, coord->get_column());
+        max_col = Math::max(max_col, coord->get_column());
+        min_row = Math::min(min_row, coord->get_row());
+        max_row = Math::max(max_row, coord->get_row());
+    }
+
+    if (min_col <= max_col && min_row <= max_row) {
+        min_col_ = min_col;
+        min_row_ = min_row;
+        cols_ = max_col - min_col + 1;
+        rows_ = max_row - min_row + 1;
+        tile_grid_.assign(static_cast<size_t>(cols_) * rows_, -1);
+
+        for (int i = 0; i < tiles_.size(); i++) {
+            Ref<PLATEAUVectorTile> tile = tiles_[i];
+            if (tile.is_null() || !tile->is_success() || tile->get_coordinate().is_null()) {
+                continue;
+            }
+            Ref<PLATEAUTileCoordinate> coord = tile->get_coordinate();
+            int x = coord->get_column() - min_col_;
+            int y = coord->get_row() - min_row_;
+            tile_grid_[static_cast<size_t>(y) * cols_ + x] = i;
+        }
+    }
+
+    rebuild_pages();
+}
+
+Vector2i PLATEAUBasemapAtlas::get_tile_grid_size() const {
+    return Vector2i(cols_, rows_);
+}
+
+void PLATEAUBasemapAtlas::set_tiles_per_page(int tiles) {
+    ERR_FAIL_COND_MSG(tiles < 1, "PLATEAUBasemapAtlas: tiles_per_page must be at least 1");
+    if (tiles == tiles_per_page_) {
+        return;
+    }
+    wait_for_pending_pages();
+    tiles_per_page_ = tiles;
+    rebuild_pages();
+}
+
+int PLATEAUBasemapAtlas::get_tiles_per_page() const {
+    return tiles_per_page_;
+}
+
+void PLATEAUBasemapAtlas::set_compress(bool enable) {
+    compress_ = enable;
+}
+
+bool PLATEAUBasemapAtlas::get_compress() const {
+    return compress_;
+}
+
+void PLATEAUBasemapAtlas::set_generate_mipmaps(bool enable) {
+    generate_mipmaps_ = enable;
+}
+
+bool PLATEAUBasemapAtlas::get_generate_mipmaps() const {
+    return generate_mipmaps_;
+}
+
+void PLATEAUBasemapAtlas::set_max_resident_pages(int count) {
+    max_resident_pages_ = Math::max(count, 1);
+}
+
+int PLATEAUBasemapAtlas::get_max_resident_pages() const {
+    return max_resident_pages_;
+}
+
+Vector2i PLATEAUBasemapAtlas::get_page_grid_size() const {
+    return Vector2i(page_cols_, page_rows_);
+}
+
+int PLATEAUBasemapAtlas::get_page_index(const Vector2i &page) const {
+    if (page.x < 0 || page.y < 0 || page.x >= page_cols_ || page.y >= page_rows_) {
+        return -1;
+    }
+    return page.y * page_cols_ + page.x;
+}
+
+Rect2i PLATEAUBasemapAtlas::get_page_tile_rect(int page_index) const {
+    int page_x = page_index % page_cols_;
+    int page_y = page_index / page_cols_;
+    int col0 = page_x * tiles_per_page_;
+    int row0 = page_y * tiles_per_page_;
+    return Rect2i(col0, row0,
+                  Math::min(tiles_per_page_, cols_ - col0),
+                  Math::min(tiles_per_page_, rows_ - row0));
+}
+
+void PLATEAUBasemapAtlas::rebuild_pages() {
+    std::lock_guard<std::mutex> lock(pages_mutex_);
+    if (cols_ > 0 && rows_ > 0) {
+        page_cols_ = (cols_ + tiles_per_page_ - 1) / tiles_per_page_;
+        page_rows_ = (rows_ + tiles_per_page_ - 1) / tiles_per_page_;
+    } else {
+        page_cols_ = 0;
+        page_rows_ = 0;
+    }
+    pages_.clear();
+    pages_.resize(static_cast<size_t>(page_cols_) * page_rows_);
+}
+
+void PLATEAUBasemapAtlas::wait_for_pending_pages() {
+    WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+    for (size_t i = 0; i < pages_.size(); i++) {
+        int64_t task_id;
+        {
+            std::lock_guard<std::mutex> lock(pages_mutex_);
+            task_id = pages_[i].task_id;
+            pages_[i].task_id = -1;
+            pages_[i].loading = false;
+            pages_[i].load_finished = false;
+            pages_[i].pending_image = Ref<Image>();
+        }
+        if (task_id >= 0 && pool) {
+            pool->wait_for_task_completion(task_id);
+        }
+    }
+    // Results of finished tasks are dropped; their deferred _finish_page calls become no-ops
+    std::lock_guard<std::mutex> lock(pages_mutex_);
+    for (PageState &state : pages_) {
+        state.pending_image = Ref<Image>();
+    }
+}
+
+bool PLATEAUBasemapAtlas::request_page(const Vector2i &page) {
+    int index = get_page_index(page);
+    ERR_FAIL_COND_V_MSG(index < 0, false, "PLATEAUBasemapAtlas: Page out of range");
+
+    PageState &state = pages_[index];
+    state.last_used = ++use_counter_;
+    {
+        std::lock_guard<std::mutex> lock(pages_mutex_);
+        if (state.texture.is_valid() || state.loading) {
+            return false;
+        }
+        state.loading = true;
+        state.load_finished = false;
+    }
+
+    int compress_mode = compress_ ? select_atlas_compress_mode() : -1;
+    int64_t task_id = WorkerThreadPool::get_singleton()->add_task(
+        callable_mp(this, &PLATEAUBasemapAtlas::_load_page_task).bind(index, compress_mode, generate_mipmaps_));
+
+    std::lock_guard<std::mutex> lock(pages_mutex_);
+    state.task_id = task_id;
+    return true;
+}
+
+bool PLATEAUBasemapAtlas::is_page_resident(const Vector2i &page) const {
+    int index = get_page_index(page);
+    return index >= 0 && pages_[index].texture.is_valid();
+}
+
+Ref<Texture2D> PLATEAUBasemapAtlas::get_page_texture(const Vector2i &page) const {
+    int index = get_page_index(page);
+    if (index < 0) {
+        return Ref<Texture2D>();
+    }
+    return pages_[index].texture;
+}
+
+void PLATEAUBasemapAtlas::unload_page(const Vector2i &page) {
+    int index = get_page_index(page);
+    if (index < 0 || pages_[index].texture.is_null()) {
+        return;
+    }
+    pages_[index].texture = Ref<ImageTexture>();
+    pages_[index].memory = 0;
+    emit_signal("page_unloaded", page);
+}
+
+int PLATEAUBasemapAtlas::update_visible_pages(const Rect2 &uv_rect) {
+    if (page_cols_ == 0 || page_rows_ == 0) {
+        return 0;
+    }
+
+    // UV -> page range (clamped to the grid)
+    double pages_per_u = static_cast<double>(cols_) / tiles_per_page_;
+    double pages_per_v = static_cast<double>(rows_) / tiles_per_page_;
+    Vector2 end = uv_rect.get_end();
+    int x0 = Math::clamp(static_cast<int>(Math::floor(uv_rect.position.x * pages_per_u)), 0, page_cols_ - 1);
+    int y0 = Math::clamp(static_cast<int>(Math::floor(uv_rect.position.y * pages_per_v)), 0, page_rows_ - 1);
+    int x1 = Math::clamp(static_cast<int>(Math::ceil(end.x * pages_per_u)) - 1, x0, page_cols_ - 1);
+    int y1 = Math::clamp(static_cast<int>(Math::ceil(end.y * pages_per_v)) - 1, y0, page_rows_ - 1);
+
+    int requested = 0;
+    std::vector<bool> visible(pages_.size(), false);
+    for (int y = y0; y <= y1; y++) {
+        for (int x = x0; x <= x1; x++) {
+            visible[y * page_cols_ + x] = true;
+            if (request_page(Vector2i(x, y))) {
+                requested++;
+            }
+        }
+    }
+
+    // Evict least recently used pages outside the visible range
+    int resident = get_resident_page_count();
+    while (resident > max_resident_pages_) {
+        int oldest = -1;
+        for (size_t i = 0; i < pages_.size(); i++) {
+            if (visible[i] || pages_[i].texture.is_null()) {
+                continue;
+            }
+            if (oldest < 0 || pages_[i].last_used < pages_[oldest].last_used) {
+                oldest = static_cast<int>(i);
+            }
+        }
+        if (oldest < 0) {
+            break;
+        }
+        unload_page(Vector2i(oldest % page_cols_, oldest / page_cols_));
+        resident--;
+    }
+
+    return requested;
+}
+
+Rect2 PLATEAUBasemapAtlas::get_page_uv_rect(const Vector2i &page) const {
+    int index = get_page_index(page);
+    if (index < 0) {
+        return Rect2();
+    }
+    Rect2i tiles = get_page_tile_rect(index);
+    return Rect2(static_cast<real_t>(tiles.position.x) / cols_,
+                 static_cast<real_t>(tiles.position.y) / rows_,
+                 static_cast<real_t>(tiles.size.x) / cols_,
+                 static_cast<real_t>(tiles.size.y) / rows_);
+}
+
+Vector2i PLATEAUBasemapAtlas::get_page_for_uv(const Vector2 &uv) const {
+    if (page_cols_ == 0 || page_rows_ == 0) {
+        return Vector2i(-1, -1);
+    }
+    int col = Math::clamp(static_cast<int>(Math::floor(uv.x * cols_)), 0, cols_ - 1);
+    int row = Math::clamp(static_cast<int>(Math::floor(uv.y * rows_)), 0, rows_ - 1);
+    return Vector2i(col / tiles_per_page_, row / tiles_per_page_);
+}
+
+Ref<StandardMaterial3D> PLATEAUBasemapAtlas::create_page_material(const Vector2i &page) const {
+    int index = get_page_index(page);
+    ERR_FAIL_COND_V_MSG(index < 0, Ref<StandardMaterial3D>(), "PLATEAUBasemapAtlas: Page out of range");
+
+    // Page-local UV = grid UV * (grid / page) - page_origin / page
+    Rect2i tiles = get_page_tile_rect(index);
+    Ref<StandardMaterial3D> material;
+    material.instantiate();
+    material->set_texture(BaseMaterial3D::TEXTURE_ALBEDO, pages_[index].texture);
+    material->set_flag(BaseMaterial3D::FLAG_USE_TEXTURE_REPEAT, false);
+    material->set_uv1_scale(Vector3(static_cast<real_t>(cols_) / tiles.size.x,
+                                    static_cast<real_t>(rows_) / tiles.size.y, 1.0));
+    material->set_uv1_offset(Vector3(-static_cast<real_t>(tiles.position.x) / tiles.size.x,
+                                     -static_cast<real_t>(tiles.position.y) / tiles.size.y, 0.0));
+    return material;
+}
+
+int PLATEAUBasemapAtlas::get_resident_page_count() const {
+    int count = 0;
+    for (const PageState &state : pages_) {
+        if (state.texture.is_valid()) {
+            count++;
+        }
+    }
+    return count;
+}
+
+int64_t PLATEAUBasemapAtlas::get_resident_memory() const {
+    int64_t total = 0;
+    for (const PageState &state : pages_) {
+        total += state.memory;
+    }
+    return total;
+}
+
+void PLATEAUBasemapAtlas::clear() {
+    wait_for_pending_pages();
+    for (int i = 0; i < static_cast<int>(pages_.size()); i++) {
+        unload_page(Vector2i(i % page_cols_, i / page_cols_));
+    }
+}
+
+Ref<Image> PLATEAUBasemapAtlas::build_page_image(int page_index) const {
+    Rect2i tiles = get_page_tile_rect(page_index);
+
+    // Load tiles without filling the tiles' own image caches
+    int tile_count = tiles.size.x * tiles.size.y;
+    std::vector<Ref<Image>> images(tile_count);
+    int tile_width = 0;
+    int tile_height = 0;
+    for (int i = 0; i < tile_count; i++) {
+        int col = tiles.position.x + i % tiles.size.x;
+        int row = tiles.position.y + i / tiles.size.x;
+        int tile_index = tile_grid_[static_cast<size_t>(row) * cols_ + col];
+        if (tile_index < 0) {
+            continue;
+        }
+        Ref<PLATEAUVectorTile> tile = tiles_[tile_index];
+        Ref<Image> image = tile->load_image_uncached();
+        if (image.is_null() || image->is_empty()) {
+            continue;
+        }
+        if (tile_width == 0) {
+            tile_width = image->get_width();
+            tile_height = image->get_height();
+        }
+        if (image->get_width() != tile_width || image->get_height() != tile_height) {
+            image->resize(tile_width, tile_height);
+        }
+        if (image->get_format() != Image::FORMAT_RGBA8) {
+            image->convert(Image::FORMAT_RGBA8);
+        }
+        images[i] = image;
+    }
+
+    if (tile_width == 0) {
+        // No tile in this page could be loaded
+        tile_width = 256;
+        tile_height = 256;
+    }
+
+    int width = tiles.size.x * tile_width;
+    int height = tiles.size.y * tile_height;
+    PackedByteArray data;
+    data.resize(static_cast<int64_t>(width) * height * 4);
+    uint8_t *dst = data.ptrw();
+
+    const uint8_t gray[4] = {
+        static_cast<uint8_t>(ATLAS_MISSING_TILE_COLOR.r * 255.0f + 0.5f),
+        static_cast<uint8_t>(ATLAS_MISSING_TILE_COLOR.g * 255.0f + 0.5f),
+        static_cast<uint8_t>(ATLAS_MISSING_TILE_COLOR.b * 255.0f + 0.5f),
+        255
+    };
+
+    size_t page_row_bytes = static_cast<size_t>(width) * 4;
+    for (int i = 0; i < tile_count; i++) {
+        size_t x = static_cast<size_t>(i % tiles.size.x) * tile_width;
+        size_t y = static_cast<size_t>(i / tiles.size.x) * tile_height;
+        uint8_t *origin = dst + y * page_row_bytes + x * 4;
+
+        if (images[i].is_valid()) {
+            PackedByteArray src_data = images[i]->get_data();
+            copy_tile_rows(origin, page_row_bytes, src_data.ptr(), tile_width, tile_height, 4);
+        } else {
+            fill_tile_rows(origin, page_row_bytes, gray, tile_width, tile_height, 4);
+        }
+    }
+
+    return Image::create_from_data(width, height, false, Image::FORMAT_RGBA8, data);
+}
+
+void PLATEAUBasemapAtlas::_load_page_task(int page_index, int compress_mode, bool generate_mipmaps) {
+    Ref<Image> image = build_page_image(page_index);
+
+    if (image.is_valid()) {
+        if (generate_mipmaps) {
+            image->generate_mipmaps();
+        }
+        if (compress_mode >= 0 && !atlas_compress_unavailable.load()) {
+            Error err = image->compress(static_cast<Image::CompressMode>(compress_mode));
+            if (err != OK && !atlas_compress_unavailable.exchange(true)) {
+                // Keep the uncompressed page rather than failing the load; reported once
+                UtilityFunctions::printerr("PLATEAUBasemapAtlas: Page compression is unavailable, pages stay uncompressed");
+            }
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(pages_mutex_);
+        // Dropped if the page was cancelled while loading
+        if (page_index < static_cast<int>(pages_.size()) && pages_[page_index].loading) {
+            pages_[page_index].pending_image = image;
+            pages_[page_index].load_finished = true;
+        }
+    }
+    call_deferred("_finish_page", page_index);
+}
+
+void PLATEAUBasemapAtlas::_finish_page(int page_index) {
+    Ref<Image> image;
+    int64_t task_id = -1;
+    {
+        std::lock_guard<std::mutex> lock(pages_mutex_);
+        if (page_index < 0 || page_index >= static_cast<int>(pages_.size())) {
+            return;
+        }
+        PageState &state = pages_[page_index];
+        // Cancelled, or a stale call for a load that was restarted and hasn't finished yet
+        if (!state.loading || !state.load_finished) {
+            return;
+        }
+        image = state.pending_image;
+        task_id = state.task_id;
+        state.pending_image = Ref<Image>();
+        state.task_id = -1;
+        state.loading = false;
+        state.load_finished = false;
+    }
+
+    // The task has already stored its result; this only releases it
+    if (task_id >= 0) {
+        WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+    }
+
+    // Building the page failed; the page can be requested again
+    if (image.is_null()) {
+        UtilityFunctions::printerr("PLATEAUBasemapAtlas: Failed to build page ", page_index);
+        return;
+    }
+
+    PageState &state = pages_[page_index];
+    state.texture = ImageTexture::create_from_image(image);
+    state.memory = image->get_data().size();
+
+    Vector2i page(page_index % page_cols_, page_index / page_cols_);
+    emit_signal("page_loaded", page, state.texture);
+}
+
+void PLATEAUBasemapAtlas::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("set_tiles", "tiles"), &PLATEAUBasemapAtlas::set_tiles);
+    ClassDB::bind_method(D_METHOD("get_tile_grid_size"), &PLATEAUBasemapAtlas::get_tile_grid_size);
+
+    ClassDB::bind_method(D_METHOD("set_tiles_per_page", "tiles"), &PLATEAUBasemapAtlas::set_tiles_per_page);
+    ClassDB::bind_method(D_METHOD("get_tiles_per_page"), &PLATEAUBasemapAtlas::get_tiles_per_page);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "tiles_per_page"), "set_tiles_per_page", "get_tiles_per_page");
+
+    ClassDB::bind_method(D_METHOD("set_compress", "enable"), &PLATEAUBasemapAtlas::set_compress);
+    ClassDB::bind_method(D_METHOD("get_compress"), &PLATEAUBasemapAtlas::get_compress);
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "compress"), "set_compress", "get_compress");
+
+    ClassDB::bind_method(D_METHOD("set_generate_mipmaps", "enable"), &PLATEAUBasemapAtlas::set_generate_mipmaps);
+    ClassDB::bind_method(D_METHOD("get_generate_mipmaps"), &PLATEAUBasemapAtlas::get_generate_mipmaps);
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "generate_mipmaps"), "set_generate_mipmaps", "get_generate_mipmaps");
+
+    ClassDB::bind_method(D_METHOD("set_max_resident_pages", "count"), &PLATEAUBasemapAtlas::set_max_resident_pages);
+    ClassDB::bind_method(D_METHOD("get_max_resident_pages"), &PLATEAUBasemapAtlas::get_max_resident_pages);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "max_resident_pages"), "set_max_resident_pages", "get_max_resident_pages");
+
+    ClassDB::bind_method(D_METHOD("get_page_grid_size"), &PLATEAUBasemapAtlas::get_page_grid_size);
+    ClassDB::bind_method(D_METHOD("request_page", "page"), &PLATEAUBasemapAtlas::request_page);
+    ClassDB::bind_method(D_METHOD("is_page_resident", "page"), &PLATEAUBasemapAtlas::is_page_resident);
+    ClassDB::bind_method(D_METHOD("get_page_texture", "page"), &PLATEAUBasemapAtlas::get_page_texture);
+    ClassDB::bind_method(D_METHOD("unload_page", "page"), &PLATEAUBasemapAtlas::unload_page);
+    ClassDB::bind_method(D_METHOD("update_visible_pages", "uv_rect"), &PLATEAUBasemapAtlas::update_visible_pages);
+    ClassDB::bind_method(D_METHOD("get_page_uv_rect", "page"), &PLATEAUBasemapAtlas::get_page_uv_rect);
+    ClassDB::bind_method(D_METHOD("get_page_for_uv", "uv"), &PLATEAUBasemapAtlas::get_page_for_uv);
+    ClassDB::bind_method(D_METHOD("create_page_material", "page"), &PLATEAUBasemapAtlas::create_page_material);
+    ClassDB::bind_method(D_METHOD("get_resident_page_count"), &PLATEAUBasemapAtlas::get_resident_page_count);
+    ClassDB::bind_method(D_METHOD("get_resident_memory"), &PLATEAUBasemapAtlas::get_resident_memory);
+    ClassDB::bind_method(D_METHOD("clear"), &PLATEAUBasemapAtlas::clear);
+
+    ClassDB::bind_method(D_METHOD("_finish_page", "page_index"), &PLATEAUBasemapAtlas::_finish_page);
+
+    ADD_SIGNAL(MethodInfo("page_loaded",
+        PropertyInfo(Variant::VECTOR2I, "page"),
+        PropertyInfo(Variant::OBJECT, "texture", PROPERTY_HINT_RESOURCE_TYPE, "Texture2D")));
+    ADD_SIGNAL(MethodInfo("page_unloaded", PropertyInfo(Variant::VECTOR2I, "page")));
+}
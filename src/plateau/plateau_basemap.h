@@ -1,10 +1,12 @@
 #pragma once
 
 #include "plateau_platform.h"
+#include "plateau_tile_pack.h"
 
 #include <godot_cpp/classes/ref_counted.hpp>
 #include <godot_cpp/classes/image.hpp>
 #include <godot_cpp/classes/image_texture.hpp>
+#include <godot_cpp/classes/standard_material3d.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/typed_array.hpp>
 
@@ -13,6 +15,10 @@
 #include <plateau/basemap/tile_projection.h>
 #endif
 
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 namespace godot {
 
 // Tile source presets
@@ -62,6 +68,7 @@ private:
  * PLATEAUVectorTile - Downloaded map tile information
  *
  * Contains tile coordinate, local image path, and download status.
+ * Tiles stored in a PLATEAUTilePack have no image path and are read from the pack instead.
  */
 class PLATEAUVectorTile : public RefCounted {
     GDCLASS(PLATEAUVectorTile, RefCounted)
@@ -79,9 +86,16 @@ public:
     void set_success(bool success);
     bool is_success() const;
 
+    // Pack holding the tile data (used when image_path is empty)
+    void set_tile_pack(const Ref<PLATEAUTilePack> &pack);
+    Ref<PLATEAUTilePack> get_tile_pack() const;
+
     // Load the tile image as Godot Image (cached after first load)
     Ref<Image> load_image() const;
 
+    // Load the tile image without touching the cache (safe to call from worker threads)
+    Ref<Image> load_image_uncached() const;
+
     // Load the tile image as ImageTexture
     Ref<ImageTexture> load_texture() const;
 
@@ -95,6 +109,7 @@ private:
     Ref<PLATEAUTileCoordinate> coordinate_;
     String image_path_;
     bool success_;
+    Ref<PLATEAUTilePack> tile_pack_;
 
     // Cached image to avoid redundant disk reads
     mutable Ref<Image> cached_image_;
@@ -128,6 +143,10 @@ private:
  *         var texture = tile.load_texture()
  *         # Use texture...
  *
+ * # Or fetch concurrently with the native HTTP client (resumes from tiles already on disk)
+ * downloader.max_connections = 8
+ * tiles = downloader.fetch_all()
+ *
  * # Create combined texture
  * var combined = downloader.create_combined_texture(tiles)
  * ```
@@ -178,8 +197,7 @@ public:
     // Download single tile at index
     Ref<PLATEAUVectorTile> download(int index);
 
-    // Download single tile by coordinate
-    // NOTE: C++ HTTP is disabled due to OpenSSL crash. Use GDScript HTTPRequest instead.
+    // Download single tile by coordinate (uses the native fetcher, see fetch_tiles)
     Ref<PLATEAUVectorTile> download_tile(const Ref<PLATEAUTileCoordinate> &coord);
 
     // Get the download URL for a tile coordinate
@@ -191,10 +209,46 @@ public:
     // Download all tiles in extent
     TypedArray<PLATEAUVectorTile> download_all();
 
+    // Native concurrent fetcher (Godot HTTPClient, works on all platforms).
+    // Tiles already present at get_tile_file_path() are reused, so interrupted fetches resume.
+    TypedArray<PLATEAUVectorTile> fetch_tiles(const TypedArray<PLATEAUTileCoordinate> &coords);
+    TypedArray<PLATEAUVectorTile> fetch_all();
+
+    // Async version - emits fetch_progress and fetch_completed
+    void fetch_tiles_async(const TypedArray<PLATEAUTileCoordinate> &coords);
+    bool is_fetching() const;
+
+    // Number of parallel keep-alive connections (default 4)
+    void set_max_connections(int count);
+    int get_max_connections() const;
+
+    // Retries per tile after the first attempt (default 3)
+    void set_max_retries(int count);
+    int get_max_retries() const;
+
+    // Delay before the first retry; doubled for each further retry (default 250 ms)
+    void set_retry_delay_ms(int delay);
+    int get_retry_delay_ms() const;
+
+    // Per-request timeout (default 30000 ms)
+    void set_timeout_ms(int timeout);
+    int get_timeout_ms() const;
+
+    // Statistics of the last fetch: {requested, downloaded, cached, failed, bytes, seconds}
+    Dictionary get_last_fetch_stats() const;
+
+    // Optional single-file store; when set (and writable), fetch_tiles() stores tiles in it
+    // instead of one file per tile
+    void set_tile_pack(const Ref<PLATEAUTilePack> &pack);
+    Ref<PLATEAUTilePack> get_tile_pack() const;
+
     // Create a combined texture from downloaded tiles
     // Tiles are arranged in a grid matching their geographic positions
     Ref<ImageTexture> create_combined_texture(const TypedArray<PLATEAUVectorTile> &tiles);
 
+    // Same as create_combined_texture() but returns the Image (safe to call from worker threads)
+    Ref<Image> create_combined_image(const TypedArray<PLATEAUVectorTile> &tiles);
+
     // Get the expected file path for a tile at index
     String get_tile_path(int index) const;
 
@@ -216,6 +270,18 @@ private:
     int tile_source_;
     String url_template_;
 
+    int max_connections_;
+    int max_retries_;
+    int retry_delay_ms_;
+    int timeout_ms_;
+    Dictionary last_fetch_stats_;
+    mutable std::mutex fetch_stats_mutex_;  // fetch_tiles_async() writes the stats on a worker thread
+    Ref<PLATEAUTilePack> tile_pack_;
+
+    std::atomic<bool> is_fetching_{false};
+    TypedArray<PLATEAUTileCoordinate> pending_fetch_coords_;
+    void _fetch_thread_func();
+
 #ifndef PLATEAU_MOBILE_PLATFORM
     plateau::geometry::Extent extent_;
     std::unique_ptr<VectorTileDownloader> downloader_;
@@ -226,6 +292,121 @@ private:
     void update_url_from_source();
 };
 
+
+/**
+ * PLATEAUBasemapAtlas - Streams basemap tiles as separately loaded texture pages
+ *
+ * Instead of one combined image (which exceeds GPU limits at high zoom levels), tiles are
+ * grouped into square pages of tiles_per_page x tiles_per_page tiles. Pages are assembled,
+ * mipmapped and compressed (S3TC, BPTC or ETC2, whichever the renderer supports; editor builds
+ * only) on worker threads, and only pages marked visible stay resident.
+ *
+ * UVs use the same layout as create_combined_texture(): (0, 0) is the top-left of the tile
+ * grid and (1, 1) the bottom-right. Each page gets a material that remaps those UVs.
+ *
+ * Usage:
+ * ```gdscript
+ * var atlas = PLATEAUBasemapAtlas.new()
+ * atlas.tiles_per_page = 8
+ * atlas.set_tiles(downloader.download_all())
+ * atlas.page_loaded.connect(func(page, texture): chunk_for_page(page).material_override = atlas.create_page_material(page))
+ * atlas.update_visible_pages(Rect2(0.25, 0.25, 0.5, 0.5))  # visible part of the map in UV space
+ * ```
+ */
+class PLATEAUBasemapAtlas : public RefCounted {
+    GDCLASS(PLATEAUBasemapAtlas, RefCounted)
+
+public:
+    PLATEAUBasemapAtlas();
+    ~PLATEAUBasemapAtlas();
+
+    // Tiles to serve (images are loaded per page on demand)
+    void set_tiles(const TypedArray<PLATEAUVectorTile> &tiles);
+    Vector2i get_tile_grid_size() const;
+
+    // Page size in tiles per side (default 8, i.e. 2048 px pages for 256 px tiles)
+    void set_tiles_per_page(int tiles);
+    int get_tiles_per_page() const;
+
+    // Compress pages with a GPU format supported by the renderer
+    void set_compress(bool enable);
+    bool get_compress() const;
+
+    void set_generate_mipmaps(bool enable);
+    bool get_generate_mipmaps() const;
+
+    // Pages outside the visible set are unloaded beyond this count (least recently used first)
+    void set_max_resident_pages(int count);
+    int get_max_resident_pages() const;
+
+    Vector2i get_page_grid_size() const;
+
+    // Start loading a page on a worker thread; page_loaded is emitted when it is ready
+    bool request_page(const Vector2i &page);
+    bool is_page_resident(const Vector2i &page) const;
+    Ref<Texture2D> get_page_texture(const Vector2i &page) const;
+    void unload_page(const Vector2i &page);
+
+    // Request pages overlapping uv_rect and evict pages not used recently.
+    // Returns the number of newly requested pages
+    int update_visible_pages(const Rect2 &uv_rect);
+
+    // UV mapping between the combined tile grid and pages
+    Rect2 get_page_uv_rect(const Vector2i &page) const;
+    Vector2i get_page_for_uv(const Vector2 &uv) const;
+
+    // Material sampling the page with UV1 remapped from combined-grid UVs
+    Ref<StandardMaterial3D> create_page_material(const Vector2i &page) const;
+
+    int get_resident_page_count() const;
+    int64_t get_resident_memory() const;
+
+    // Unload all pages (waits for pending loads)
+    void clear();
+
+    // Internal: worker entry and main-thread completion
+    void _load_page_task(int page_index, int compress_mode, bool generate_mipmaps);
+    void _finish_page(int page_index);
+
+protected:
+    static void _bind_methods();
+
+private:
+    struct PageState {
+        Ref<ImageTexture> texture;
+        Ref<Image> pending_image;
+        int64_t task_id = -1;
+        bool loading = false;
+        bool load_finished = false;     // Task stored its result (pending_image may be null on failure)
+        uint64_t last_used = 0;
+        int64_t memory = 0;
+    };
+
+    TypedArray<PLATEAUVectorTile> tiles_;
+    std::vector<int> tile_grid_;   // tile index per grid cell, -1 if missing
+    int min_col_;
+    int min_row_;
+    int cols_;
+    int rows_;
+
+    int tiles_per_page_;
+    bool compress_;
+    bool generate_mipmaps_;
+    int max_resident_pages_;
+
+    std::vector<PageState> pages_;
+    int page_cols_;
+    int page_rows_;
+    uint64_t use_counter_;
+    mutable std::mutex pages_mutex_;
+
+    int get_page_index(const Vector2i &page) const;
+    void rebuild_pages();
+    void wait_for_pending_pages();
+    Rect2i get_page_tile_rect(int page_index) const;
+    Ref<Image> build_page_image(int page_index) const;
+};
+
 } // namespace godot
 
 VARIANT_ENUM_CAST(godot::PLATEAUTileSource);
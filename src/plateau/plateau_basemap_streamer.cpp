@@ -0,0 +1,700 @@
+#include "plateau_basemap_streamer.h"
+#include "plateau_platform.h"
+#include <godot_cpp/classes/viewport.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#include <godot_cpp/core/object.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace godot;
+
+// Failed chunk loads are retried after this delay, doubled per consecutive failure
+static const uint64_t LOAD_RETRY_DELAY_MS = 1000;
+static const uint64_t LOAD_RETRY_MAX_DELAY_MS = 60000;
+
+// Projects the chunk's mosaic onto its meshes from above using positions in the streamer's
+// local space: uv = drape_inverse * (local.xz - drape_origin).
+static const char *DRAPE_SHADER_CODE = R"(
+shader_type spatial;
+
+uniform sampler2D basemap : source_color, filter_linear_mipmap, repeat_disable;
+uniform bool has_basemap = false;
+uniform vec4 fallback_color : source_color = vec4(0.5, 0.5, 0.5, 1.0);
+uniform mat4 drape_transform = mat4(1.0);
+uniform vec2 drape_origin = vec2(0.0);
+uniform vec4 drape_inverse = vec4(1.0, 0.0, 0.0, 1.0);
+
+varying vec2 drape_xz;
+
+void vertex() {
+	drape_xz = (drape_transform * MODEL_MATRIX * vec4(VERTEX, 1.0)).xz;
+}
+
+void fragment() {
+	vec3 color = fallback_color.rgb;
+	if (has_basemap) {
+		vec2 d = drape_xz - drape_origin;
+		vec2 uv = vec2(dot(drape_inverse.xy, d), dot(drape_inverse.zw, d));
+		color = texture(basemap, uv).rgb;
+	}
+	ALBEDO = color;
+	ROUGHNESS = 1.0;
+}
+)";
+
+// Update interval of the zoom selection in seconds
+static const double STREAMER_UPDATE_INTERVAL = 0.2;
+
+// Web Mercator ground resolution of one texel of a 256 px tile at zoom 0 on the equator (m)
+static const double WEB_MERCATOR_RESOLUTION_Z0 = 156543.03392804097;
+
+PLATEAUBasemapStreamer::PLATEAUBasemapStreamer() :
+    terrain_root_(nullptr),
+    camera_(nullptr),
+    min_zoom_(10),
+    max_zoom_(18),
+    texels_per_pixel_(1.0f),
+    max_tiles_per_chunk_(16),
+    max_concurrent_loads_(4),
+    download_missing_(true),
+    update_timer_(STREAMER_UPDATE_INTERVAL) {
+    shader_.instantiate();
+    shader_->set_code(DRAPE_SHADER_CODE);
+}
+
+PLATEAUBasemapStreamer::~PLATEAUBasemapStreamer() {
+    wait_for_loads();
+}
+
+void PLATEAUBasemapStreamer::_ready() {
+    if (chunks_.empty() && terrain_root_) {
+        refresh_chunks();
+    }
+    set_process(true);
+}
+
+void PLATEAUBasemapStreamer::_process(double delta) {
+    update_timer_ += delta;
+    if (update_timer_ < STREAMER_UPDATE_INTERVAL) {
+        return;
+    }
+    update_timer_ = 0.0;
+
+    Camera3D *camera = get_tracked_camera();
+    if (!camera || chunks_.empty()) {
+        return;
+    }
+
+    // Materials map world positions into this node's space; keep that in sync if we move
+    Transform3D drape_transform = get_global_transform().affine_inverse();
+    if (drape_transform != drape_transform_) {
+        drape_transform_ = drape_transform;
+        for (ChunkState &chunk : chunks_) {
+            if (chunk.material.is_valid()) {
+                chunk.material->set_shader_parameter("drape_transform", Projection(drape_transform_));
+            }
+        }
+    }
+
+    // Pixel footprint per meter of distance for a perspective camera (vertical FOV)
+    double viewport_height = 1080.0;
+    Viewport *viewport = camera->get_viewport();
+    if (viewport) {
+        viewport_height = std::max(1.0f, viewport->get_visible_rect().size.y);
+    }
+    double pixel_size_per_meter = 2.0 * std::tan(Math::deg_to_rad(camera->get_fov()) * 0.5) / viewport_height;
+
+    update_chunks(to_local(camera->get_global_position()), pixel_size_per_meter);
+}
+
+Camera3D *PLATEAUBasemapStreamer::get_tracked_camera() const {
+    if (camera_) {
+        return camera_;
+    }
+
+    Viewport *viewport = get_viewport();
+    if (viewport) {
+        return viewport->get_camera_3d();
+    }
+
+    return nullptr;
+}
+
+void PLATEAUBasemapStreamer::set_downloader(const Ref<PLATEAUVectorTileDownloader> &downloader) {
+    wait_for_loads();
+    downloader_ = downloader;
+}
+
+Ref<PLATEAUVectorTileDownloader> PLATEAUBasemapStreamer::get_downloader() const {
+    return downloader_;
+}
+
+void PLATEAUBasemapStreamer::set_geo_reference(const Ref<PLATEAUGeoReference> &geo_reference) {
+    wait_for_loads();
+    geo_reference_ = geo_reference;
+    if (is_inside_tree() && terrain_root_) {
+        refresh_chunks();
+    }
+}
+
+Ref<PLATEAUGeoReference> PLATEAUBasemapStreamer::get_geo_reference() const {
+    return geo_reference_;
+}
+
+void PLATEAUBasemapStreamer::set_terrain_root(Node3D *root) {
+    terrain_root_ = root;
+    if (is_inside_tree()) {
+        refresh_chunks();
+    }
+}
+
+Node3D *PLATEAUBasemapStreamer::get_terrain_root() const {
+    return terrain_root_;
+}
+
+void PLATEAUBasemapStreamer::set_camera(Camera3D *camera) {
+    camera_ = camera;
+}
+
+Camera3D *PLATEAUBasemapStreamer::get_camera() const {
+    return camera_;
+}
+
+void PLATEAUBasemapStreamer::set_min_zoom(int zoom) {
+    min_zoom_ = Math::clamp(zoom, 0, 24);
+    max_zoom_ = std::max(max_zoom_, min_zoom_);
+}
+
+int PLATEAUBasemapStreamer::get_min_zoom() const {
+    return min_zoom_;
+}
+
+void PLATEAUBasemapStreamer::set_max_zoom(int zoom) {
+    max_zoom_ = Math::clamp(zoom, 0, 24);
+    min_zoom_ = std::min(min_zoom_, max_zoom_);
+}
+
+int PLATEAUBasemapStreamer::get_max_zoom() const {
+    return max_zoom_;
+}
+
+void PLATEAUBasemapStreamer::set_texels_per_pixel(float ratio) {
+    texels_per_pixel_ = std::max(ratio, 0.01f);
+}
+
+float PLATEAUBasemapStreamer::get_texels_per_pixel() const {
+    return texels_per_pixel_;
+}
+
+void PLATEAUBasemapStreamer::set_max_tiles_per_chunk(int count) {
+    max_tiles_per_chunk_ = std::max(count, 1);
+}
+
+int PLATEAUBasemapStreamer::get_max_tiles_per_chunk() const {
+    return max_tiles_per_chunk_;
+}
+
+void PLATEAUBasemapStreamer::set_max_concurrent_loads(int count) {
+    max_concurrent_loads_ = std::max(count, 1);
+}
+
+int PLATEAUBasemapStreamer::get_max_concurrent_loads() const {
+    return max_concurrent_loads_;
+}
+
+void PLATEAUBasemapStreamer::set_download_missing(bool enable) {
+    download_missing_ = enable;
+}
+
+bool PLATEAUBasemapStreamer::get_download_missing() const {
+    return download_missing_;
+}
+
+// ============================================================================
+// Chunk management
+// ============================================================================
+
+void PLATEAUBasemapStreamer::refresh_chunks() {
+    clear();
+    chunks_.clear();
+
+    ERR_FAIL_COND_MSG(!is_inside_tree(), "PLATEAUBasemapStreamer: Must be inside the scene tree to scan chunks");
+    if (!terrain_root_ || !terrain_root_->is_inside_tree()) {
+        return;
+    }
+
+    Transform3D to_streamer = get_global_transform().affine_inverse();
+    int child_count = terrain_root_->get_child_count();
+    for (int i = 0; i < child_count; i++) {
+        Node3D *child = Object::cast_to<Node3D>(terrain_root_->get_child(i));
+        if (!child) {
+            continue;
+        }
+
+        // The chunk itself and every mesh below it (e.g. all LOD levels) share one texture
+        std::vector<MeshInstance3D *> meshes;
+        if (MeshInstance3D *mesh = Object::cast_to<MeshInstance3D>(child)) {
+            meshes.push_back(mesh);
+        }
+        TypedArray<Node> descendants = child->find_children("*", "MeshInstance3D", true, false);
+        for (int j = 0; j < descendants.size(); j++) {
+            MeshInstance3D *mesh = Object::cast_to<MeshInstance3D>(static_cast<Object *>(descendants[j]));
+            if (mesh) {
+                meshes.push_back(mesh);
+            }
+        }
+
+        ChunkState chunk;
+        chunk.node_id = ObjectID(child->get_instance_id());
+        bool has_bounds = false;
+        for (MeshInstance3D *mesh : meshes) {
+            if (mesh->get_mesh().is_null()) {
+                continue;
+            }
+            chunk.mesh_ids.push_back(ObjectID(mesh->get_instance_id()));
+            AABB bounds = (to_streamer * mesh->get_global_transform()).xform(mesh->get_aabb());
+            chunk.bounds = has_bounds ? chunk.bounds.merge(bounds) : bounds;
+            has_bounds = true;
+        }
+        if (!has_bounds) {
+            continue;
+        }
+
+        if (geo_reference_.is_valid()) {
+            chunk.latitude = geo_reference_->unproject(chunk.bounds.get_center()).x;
+        }
+        chunks_.push_back(chunk);
+    }
+}
+
+int PLATEAUBasemapStreamer::compute_zoom(double pixel_footprint, double latitude) const {
+    // Largest texel that is still no bigger than pixel_footprint / texels_per_pixel
+    double meters_per_texel_z0 = WEB_MERCATOR_RESOLUTION_Z0 * std::cos(Math::deg_to_rad(latitude));
+    double scale = meters_per_texel_z0 * texels_per_pixel_ / std::max(pixel_footprint, 1e-6);
+    int zoom = static_cast<int>(std::ceil(std::log2(std::max(scale, 1.0))));
+    return Math::clamp(zoom, min_zoom_, max_zoom_);
+}
+
+bool PLATEAUBasemapStreamer::compute_tile_range(const ChunkState &chunk, int zoom, Rect2i &out_range) const {
+    if (geo_reference_.is_null()) {
+        return false;
+    }
+
+    // Geographic extent of the chunk from its four XZ corners
+    Vector3 min = chunk.bounds.position;
+    Vector3 max = chunk.bounds.get_end();
+    double center_y = chunk.bounds.get_center().y;
+    double min_lat = 90.0, max_lat = -90.0, min_lon = 180.0, max_lon = -180.0;
+    const Vector3 corners[4] = {
+        Vector3(min.x, center_y, min.z), Vector3(max.x, center_y, min.z),
+        Vector3(min.x, center_y, max.z), Vector3(max.x, center_y, max.z)
+    };
+    for (const Vector3 &corner : corners) {
+        Vector3 geo = geo_reference_->unproject(corner);
+        min_lat = std::min(min_lat, static_cast<double>(geo.x));
+        max_lat = std::max(max_lat, static_cast<double>(geo.x));
+        min_lon = std::min(min_lon, static_cast<double>(geo.y));
+        max_lon = std::max(max_lon, static_cast<double>(geo.y));
+    }
+
+    Ref<PLATEAUTileCoordinate> north_west = PLATEAUVectorTileDownloader::project(max_lat, min_lon, zoom);
+    Ref<PLATEAUTileCoordinate> south_east = PLATEAUVectorTileDownloader::project(min_lat, max_lon, zoom);
+    if (north_west.is_null() || south_east.is_null()) {
+        return false;
+    }
+
+    int col0 = std::min(north_west->get_column(), south_east->get_column());
+    int col1 = std::max(north_west->get_column(), south_east->get_column());
+    int row0 = std::min(north_west->get_row(), south_east->get_row());
+    int row1 = std::max(north_west->get_row(), south_east->get_row());
+    out_range = Rect2i(col0, row0, col1 - col0 + 1, row1 - row0 + 1);
+    return true;
+}
+
+void PLATEAUBasemapStreamer::update_chunks(const Vector3 &local_camera_position, double pixel_size_per_meter) {
+#ifdef PLATEAU_MOBILE_PLATFORM
+    PLATEAU_MOBILE_UNSUPPORTED();
+#endif
+
+#ifndef PLATEAU_MOBILE_PLATFORM
+    if (downloader_.is_null() || geo_reference_.is_null()) {
+        return;
+    }
+
+    uint64_t now_ms = Time::get_singleton()->get_ticks_msec();
+    for (ChunkState &chunk : chunks_) {
+        if (!ObjectDB::get_instance(chunk.node_id)) {
+            continue;
+        }
+        if (now_ms < chunk.retry_at_ms) {
+            continue;
+        }
+
+        // Distance to the closest point of the chunk bounds
+        Vector3 min = chunk.bounds.position;
+        Vector3 max = chunk.bounds.get_end();
+        Vector3 closest(Math::clamp(local_camera_position.x, min.x, max.x),
+                        Math::clamp(local_camera_position.y, min.y, max.y),
+                        Math::clamp(local_camera_position.z, min.z, max.z));
+        chunk.distance = local_camera_position.distance_to(closest);
+
+        double footprint = std::max(chunk.distance, 1.0) * pixel_size_per_meter;
+        int zoom = compute_zoom(footprint, chunk.latitude);
+
+        // Keep one level of extra detail instead of flickering between two zoom levels
+        int current = chunk.loading || chunk.queued ? chunk.target_zoom : chunk.zoom;
+        if (current >= 0 && zoom == current - 1) {
+            continue;
+        }
+        if (zoom == current) {
+            continue;
+        }
+
+        // Coarsen until the chunk fits in max_tiles_per_chunk tiles
+        Rect2i range;
+        bool has_range = compute_tile_range(chunk, zoom, range);
+        while (has_range && range.size.x * range.size.y > max_tiles_per_chunk_ && zoom > min_zoom_) {
+            zoom--;
+            has_range = compute_tile_range(chunk, zoom, range);
+        }
+        if (!has_range || zoom == current) {
+            continue;
+        }
+
+        chunk.target_zoom = zoom;
+        chunk.tile_range = range;
+        chunk.queued = chunk.target_zoom != chunk.zoom;
+    }
+
+    start_pending_loads();
+#endif
+}
+
+void PLATEAUBasemapStreamer::start_pending_loads() {
+    int in_flight = 0;
+    for (const ChunkState &chunk : chunks_) {
+        if (chunk.loading) {
+            in_flight++;
+        }
+    }
+
+    // Nearest chunks first
+    while (in_flight < max_concurrent_loads_) {
+        int next = -1;
+        for (size_t i = 0; i < chunks_.size(); i++) {
+            const ChunkState &chunk = chunks_[i];
+            if (!chunk.queued || chunk.loading) {
+                continue;
+            }
+            if (next < 0 || chunk.distance < chunks_[next].distance) {
+                next = static_cast<int>(i);
+            }
+        }
+        if (next < 0) {
+            break;
+        }
+
+        ChunkState &chunk = chunks_[next];
+        chunk.queued = false;
+        chunk.loading = true;
+        chunk.task_id = WorkerThreadPool::get_singleton()->add_task(
+            callable_mp(this, &PLATEAUBasemapStreamer::_load_chunk_task)
+                .bind(next, chunk.generation, chunk.target_zoom, chunk.tile_range));
+        in_flight++;
+    }
+}
+
+void PLATEAUBasemapStreamer::_load_chunk_task(int chunk_index, int generation, int zoom, const Rect2i &tile_range) {
+    LoadResult result;
+    result.chunk_index = chunk_index;
+    result.generation = generation;
+    result.zoom = zoom;
+
+    Ref<PLATEAUTilePack> pack = downloader_->get_tile_pack();
+
+    // Resolve every tile of the range from the pack or disk, collecting the missing ones
+    TypedArray<PLATEAUVectorTile> tiles;
+    TypedArray<PLATEAUTileCoordinate> missing;
+    std::vector<int> missing_indices;
+    for (int row = tile_range.position.y; row < tile_range.get_end().y; row++) {
+        for (int col = tile_range.position.x; col < tile_range.get_end().x; col++) {
+            Ref<PLATEAUTileCoordinate> coord;
+            coord.instantiate();
+            coord->set_column(col);
+            coord->set_row(row);
+            coord->set_zoom_level(zoom);
+
+            Ref<PLATEAUVectorTile> tile;
+            tile.instantiate();
+            tile->set_coordinate(coord);
+
+            if (pack.is_valid() && pack->has_tile(zoom, col, row)) {
+                tile->set_tile_pack(pack);
+                tile->set_success(true);
+            } else {
+                String path = downloader_->get_tile_file_path(coord);
+                if (!path.is_empty() && FileAccess::file_exists(path)) {
+                    tile->set_image_path(path);
+                    tile->set_success(true);
+                } else {
+                    missing.push_back(coord);
+                    missing_indices.push_back(tiles.size());
+                }
+            }
+            tiles.push_back(tile);
+        }
+    }
+
+    if (download_missing_ && !missing.is_empty()) {
+        std::lock_guard<std::mutex> lock(fetch_mutex_);
+        TypedArray<PLATEAUVectorTile> fetched = downloader_->fetch_tiles(missing);
+        for (int i = 0; i < fetched.size() && i < static_cast<int>(missing_indices.size()); i++) {
+            tiles[missing_indices[i]] = fetched[i];
+        }
+    }
+
+    // Missing tiles still carry coordinates, so the mosaic always spans the full range
+    result.image = downloader_->create_combined_image(tiles);
+    if (result.image.is_valid()) {
+        result.image->generate_mipmaps();
+    }
+
+    // Local XZ of the mosaic corners (north-west, north-east, south-west)
+    Ref<PLATEAUTileCoordinate> first;
+    first.instantiate();
+    first->set_column(tile_range.position.x);
+    first->set_row(tile_range.position.y);
+    first->set_zoom_level(zoom);
+    Ref<PLATEAUTileCoordinate> last;
+    last.instantiate();
+    last->set_column(tile_range.get_end().x - 1);
+    last->set_row(tile_range.get_end().y - 1);
+    last->set_zoom_level(zoom);
+
+    Dictionary north_west = PLATEAUVectorTileDownloader::unproject(first);
+    Dictionary south_east = PLATEAUVectorTileDownloader::unproject(last);
+    if (geo_reference_.is_valid() && !north_west.is_empty() && !south_east.is_empty()) {
+        double north = north_west["max_lat"];
+        double west = north_west["min_lon"];
+        double south = south_east["min_lat"];
+        double east = south_east["max_lon"];
+        Vector3 nw = geo_reference_->project(Vector3(north, west, 0.0));
+        Vector3 ne = geo_reference_->project(Vector3(north, east, 0.0));
+        Vector3 sw = geo_reference_->project(Vector3(south, west, 0.0));
+        result.drape_origin = Vector2(nw.x, nw.z);
+        result.drape_u = Vector2(ne.x - nw.x, ne.z - nw.z);
+        result.drape_v = Vector2(sw.x - nw.x, sw.z - nw.z);
+    } else {
+        result.image.unref();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        results_.push_back(result);
+    }
+    call_deferred("_apply_loaded_chunks");
+}
+
+void PLATEAUBasemapStreamer::_apply_loaded_chunks() {
+    std::vector<LoadResult> results;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        results.swap(results_);
+    }
+
+    for (const LoadResult &result : results) {
+        apply_result(result);
+    }
+    start_pending_loads();
+}
+
+void PLATEAUBasemapStreamer::apply_result(const LoadResult &result) {
+    if (result.chunk_index < 0 || result.chunk_index >= static_cast<int>(chunks_.size())) {
+        return;
+    }
+    ChunkState &chunk = chunks_[result.chunk_index];
+    if (chunk.generation != result.generation) {
+        return;
+    }
+
+    if (chunk.task_id >= 0) {
+        // The task has already posted its result; this only releases it
+        WorkerThreadPool::get_singleton()->wait_for_task_completion(chunk.task_id);
+        chunk.task_id = -1;
+    }
+    chunk.loading = false;
+
+    double det = result.drape_u.x * result.drape_v.y - result.drape_v.x * result.drape_u.y;
+    if (result.image.is_null() || Math::is_zero_approx(det)) {
+        // Keep the previous texture and zoom, so a later update requests the failed zoom again
+        uint64_t delay = std::min(LOAD_RETRY_DELAY_MS << std::min(chunk.failed_loads, 6), LOAD_RETRY_MAX_DELAY_MS);
+        chunk.failed_loads++;
+        chunk.retry_at_ms = Time::get_singleton()->get_ticks_msec() + delay;
+        if (chunk.target_zoom == result.zoom) {
+            chunk.target_zoom = chunk.zoom;
+            chunk.queued = false;
+        }
+        return;
+    }
+    chunk.zoom = result.zoom;
+    chunk.queued = chunk.target_zoom != chunk.zoom;
+    chunk.failed_loads = 0;
+    chunk.retry_at_ms = 0;
+
+    Vector4 inverse(result.drape_v.y / det, -result.drape_v.x / det,
+                    -result.drape_u.y / det, result.drape_u.x / det);
+
+    chunk.texture = ImageTexture::create_from_image(result.image);
+    if (chunk.material.is_null()) {
+        chunk.material = create_chunk_material();
+    }
+    chunk.material->set_shader_parameter("basemap", chunk.texture);
+    chunk.material->set_shader_parameter("has_basemap", true);
+    chunk.material->set_shader_parameter("drape_origin", result.drape_origin);
+    chunk.material->set_shader_parameter("drape_inverse", inverse);
+
+    for (const ObjectID &mesh_id : chunk.mesh_ids) {
+        MeshInstance3D *mesh = Object::cast_to<MeshInstance3D>(ObjectDB::get_instance(mesh_id));
+        if (mesh && mesh->get_material_override() != chunk.material) {
+            mesh->set_material_override(chunk.material);
+        }
+    }
+
+    emit_signal("chunk_texture_loaded", result.chunk_index, result.zoom);
+}
+
+Ref<ShaderMaterial> PLATEAUBasemapStreamer::create_chunk_material() {
+    Ref<ShaderMaterial> material;
+    material.instantiate();
+    material->set_shader(shader_);
+    material->set_shader_parameter("drape_transform", Projection(drape_transform_));
+    return material;
+}
+
+void PLATEAUBasemapStreamer::wait_for_loads() {
+    WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+    for (ChunkState &chunk : chunks_) {
+        if (chunk.task_id >= 0 && pool) {
+            pool->wait_for_task_completion(chunk.task_id);
+        }
+        chunk.task_id = -1;
+        if (chunk.loading) {
+            // Results of finished tasks are dropped by the generation check
+            chunk.loading = false;
+            chunk.queued = chunk.target_zoom != chunk.zoom;
+            chunk.generation++;
+        }
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    results_.clear();
+}
+
+void PLATEAUBasemapStreamer::clear() {
+    wait_for_loads();
+    for (ChunkState &chunk : chunks_) {
+        for (const ObjectID &mesh_id : chunk.mesh_ids) {
+            MeshInstance3D *mesh = Object::cast_to<MeshInstance3D>(ObjectDB::get_instance(mesh_id));
+            if (mesh && chunk.material.is_valid() && mesh->get_material_override() == chunk.material) {
+                mesh->set_material_override(Ref<Material>());
+            }
+        }
+        chunk.material.unref();
+        chunk.texture.unref();
+        chunk.zoom = -1;
+        chunk.target_zoom = -1;
+        chunk.queued = false;
+        chunk.failed_loads = 0;
+        chunk.retry_at_ms = 0;
+        chunk.generation++;
+    }
+}
+
+int PLATEAUBasemapStreamer::get_chunk_count() const {
+    return static_cast<int>(chunks_.size());
+}
+
+int PLATEAUBasemapStreamer::get_chunk_zoom(int chunk_index) const {
+    ERR_FAIL_INDEX_V(chunk_index, static_cast<int>(chunks_.size()), -1);
+    return chunks_[chunk_index].texture.is_valid() ? chunks_[chunk_index].zoom : -1;
+}
+
+int PLATEAUBasemapStreamer::get_loaded_chunk_count() const {
+    int count = 0;
+    for (const ChunkState &chunk : chunks_) {
+        if (chunk.texture.is_valid()) {
+            count++;
+        }
+    }
+    return count;
+}
+
+int PLATEAUBasemapStreamer::get_pending_load_count() const {
+    int count = 0;
+    for (const ChunkState &chunk : chunks_) {
+        if (chunk.loading || chunk.queued) {
+            count++;
+        }
+    }
+    return count;
+}
+
+void PLATEAUBasemapStreamer::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("set_downloader", "downloader"), &PLATEAUBasemapStreamer::set_downloader);
+    ClassDB::bind_method(D_METHOD("get_downloader"), &PLATEAUBasemapStreamer::get_downloader);
+    ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "downloader", PROPERTY_HINT_RESOURCE_TYPE, "PLATEAUVectorTileDownloader"), "set_downloader", "get_downloader");
+
+    ClassDB::bind_method(D_METHOD("set_geo_reference", "geo_reference"), &PLATEAUBasemapStreamer::set_geo_reference);
+    ClassDB::bind_method(D_METHOD("get_geo_reference"), &PLATEAUBasemapStreamer::get_geo_reference);
+    ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "geo_reference", PROPERTY_HINT_RESOURCE_TYPE, "PLATEAUGeoReference"), "set_geo_reference", "get_geo_reference");
+
+    ClassDB::bind_method(D_METHOD("set_terrain_root", "root"), &PLATEAUBasemapStreamer::set_terrain_root);
+    ClassDB::bind_method(D_METHOD("get_terrain_root"), &PLATEAUBasemapStreamer::get_terrain_root);
+    ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "terrain_root", PROPERTY_HINT_NODE_TYPE, "Node3D"), "set_terrain_root", "get_terrain_root");
+
+    ClassDB::bind_method(D_METHOD("set_camera", "camera"), &PLATEAUBasemapStreamer::set_camera);
+    ClassDB::bind_method(D_METHOD("get_camera"), &PLATEAUBasemapStreamer::get_camera);
+    ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "camera", PROPERTY_HINT_NODE_TYPE, "Camera3D"), "set_camera", "get_camera");
+
+    ClassDB::bind_method(D_METHOD("set_min_zoom", "zoom"), &PLATEAUBasemapStreamer::set_min_zoom);
+    ClassDB::bind_method(D_METHOD("get_min_zoom"), &PLATEAUBasemapStreamer::get_min_zoom);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "min_zoom"), "set_min_zoom", "get_min_zoom");
+
+    ClassDB::bind_method(D_METHOD("set_max_zoom", "zoom"), &PLATEAUBasemapStreamer::set_max_zoom);
+    ClassDB::bind_method(D_METHOD("get_max_zoom"), &PLATEAUBasemapStreamer::get_max_zoom);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "max_zoom"), "set_max_zoom", "get_max_zoom");
+
+    ClassDB::bind_method(D_METHOD("set_texels_per_pixel", "ratio"), &PLATEAUBasemapStreamer::set_texels_per_pixel);
+    ClassDB::bind_method(D_METHOD("get_texels_per_pixel"), &PLATEAUBasemapStreamer::get_texels_per_pixel);
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "texels_per_pixel"), "set_texels_per_pixel", "get_texels_per_pixel");
+
+    ClassDB::bind_method(D_METHOD("set_max_tiles_per_chunk", "count"), &PLATEAUBasemapStreamer::set_max_tiles_per_chunk);
+    ClassDB::bind_method(D_METHOD("get_max_tiles_per_chunk"), &PLATEAUBasemapStreamer::get_max_tiles_per_chunk);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "max_tiles_per_chunk"), "set_max_tiles_per_chunk", "get_max_tiles_per_chunk");
+
+    ClassDB::bind_method(D_METHOD("set_max_concurrent_loads", "count"), &PLATEAUBasemapStreamer::set_max_concurrent_loads);
+    ClassDB::bind_method(D_METHOD("get_max_concurrent_loads"), &PLATEAUBasemapStreamer::get_max_concurrent_loads);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "max_concurrent_loads"), "set_max_concurrent_loads", "get_max_concurrent_loads");
+
+    ClassDB::bind_method(D_METHOD("set_download_missing", "enable"), &PLATEAUBasemapStreamer::set_download_missing);
+    ClassDB::bind_method(D_METHOD("get_download_missing"), &PLATEAUBasemapStreamer::get_download_missing);
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "download_missing"), "set_download_missing", "get_download_missing");
+
+    ClassDB::bind_method(D_METHOD("refresh_chunks"), &PLATEAUBasemapStreamer::refresh_chunks);
+    ClassDB::bind_method(D_METHOD("update_chunks", "local_camera_position", "pixel_size_per_meter"),
+                         &PLATEAUBasemapStreamer::update_chunks);
+    ClassDB::bind_method(D_METHOD("compute_zoom", "pixel_footprint", "latitude"), &PLATEAUBasemapStreamer::compute_zoom);
+    ClassDB::bind_method(D_METHOD("clear"), &PLATEAUBasemapStreamer::clear);
+
+    ClassDB::bind_method(D_METHOD("get_chunk_count"), &PLATEAUBasemapStreamer::get_chunk_count);
+    ClassDB::bind_method(D_METHOD("get_chunk_zoom", "chunk_index"), &PLATEAUBasemapStreamer::get_chunk_zoom);
+    ClassDB::bind_method(D_METHOD("get_loaded_chunk_count"), &PLATEAUBasemapStreamer::get_loaded_chunk_count);
+    ClassDB::bind_method(D_METHOD("get_pending_load_count"), &PLATEAUBasemapStreamer::get_pending_load_count);
+
+    ClassDB::bind_method(D_METHOD("_apply_loaded_chunks"), &PLATEAUBasemapStreamer::_apply_loaded_chunks);
+
+    ADD_SIGNAL(MethodInfo("chunk_texture_loaded", PropertyInfo(Variant::INT, "chunk_index"), PropertyInfo(Variant::INT, "zoom")));
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <godot_cpp/classes/node3d.hpp>
+#include <godot_cpp/classes/camera3d.hpp>
+#include <godot_cpp/classes/mesh_instance3d.hpp>
+#include <godot_cpp/classes/shader.hpp>
+#include <godot_cpp/classes/shader_material.hpp>
+#include <godot_cpp/classes/image_texture.hpp>
+#include <godot_cpp/core/class_db.hpp>
+
+#include "plateau_basemap.h"
+#include "plateau_geo_reference.h"
+
+#include <mutex>
+#include <vector>
+
+namespace godot {
+
+/**
+ * PLATEAUBasemapStreamer - Drapes basemap tiles on terrain chunks with per-chunk zoom levels
+ *
+ * Each direct child of terrain_root is treated as one chunk (e.g. the Chunk_x_y nodes from
+ * PLATEAUTerrain.create_chunked_terrain(), or a single terrain MeshInstance3D). For every
+ * chunk the streamer picks the tile zoom whose texel size matches the chunk's on-screen pixel
+ * size at its camera distance. The covering tiles are loaded (and fetched if missing) on worker
+ * threads, combined into one mipmapped texture and projected onto the chunk's meshes from above.
+ * Near chunks get sharp imagery; far chunks fall back to coarse, cheap zoom levels.
+ *
+ * The streamer's local space must match the geo_reference coordinate space (i.e. place it
+ * where the city model is placed).
+ *
+ * Usage:
+ * ```gdscript
+ * var streamer = PLATEAUBasemapStreamer.new()
+ * streamer.downloader = downloader        # url_template, destination or tile_pack
+ * streamer.geo_reference = geo_ref
+ * streamer.terrain_root = terrain.create_chunked_terrain(8, 8)
+ * add_child(streamer)
+ * streamer.add_child(streamer.terrain_root)
+ * ```
+ */
+class PLATEAUBasemapStreamer : public Node3D {
+    GDCLASS(PLATEAUBasemapStreamer, Node3D)
+
+public:
+    PLATEAUBasemapStreamer();
+    ~PLATEAUBasemapStreamer();
+
+    // Lifecycle
+    void _ready() override;
+    void _process(double delta) override;
+
+    // Tile source: URL, destination directory / tile pack and fetch settings
+    void set_downloader(const Ref<PLATEAUVectorTileDownloader> &downloader);
+    Ref<PLATEAUVectorTileDownloader> get_downloader() const;
+
+    // Maps this node's local space to latitude / longitude
+    void set_geo_reference(const Ref<PLATEAUGeoReference> &geo_reference);
+    Ref<PLATEAUGeoReference> get_geo_reference() const;
+
+    // Node whose children are the terrain chunks
+    void set_terrain_root(Node3D *root);
+    Node3D *get_terrain_root() const;
+
+    // Camera driving zoom selection (defaults to the viewport camera)
+    void set_camera(Camera3D *camera);
+    Camera3D *get_camera() const;
+
+    // Zoom range (default 10 - 18)
+    void set_min_zoom(int zoom);
+    int get_min_zoom() const;
+    void set_max_zoom(int zoom);
+    int get_max_zoom() const;
+
+    // Target tile texels per screen pixel (higher = sharper, more tiles)
+    void set_texels_per_pixel(float ratio);
+    float get_texels_per_pixel() const;
+
+    // Upper bound on tiles combined for one chunk; the zoom is lowered until it fits
+    void set_max_tiles_per_chunk(int count);
+    int get_max_tiles_per_chunk() const;
+
+    // Chunk loads running at the same time
+    void set_max_concurrent_loads(int count);
+    int get_max_concurrent_loads() const;
+
+    // Fetch tiles that are not on disk / in the pack yet
+    void set_download_missing(bool enable);
+    bool get_download_missing() const;
+
+    // Rescan terrain_root for chunks (call after changing its children)
+    void refresh_chunks();
+
+    // Re-select zoom levels for a camera in this node's local space.
+    // pixel_size_per_meter is the screen pixel footprint in meters at 1 m distance
+    void update_chunks(const Vector3 &local_camera_position, double pixel_size_per_meter);
+
+    // Zoom whose texel size matches the given pixel footprint (meters) at a latitude
+    int compute_zoom(double pixel_footprint, double latitude) const;
+
+    // Drop all loaded textures
+    void clear();
+
+    // Statistics
+    int get_chunk_count() const;
+    int get_chunk_zoom(int chunk_index) const;
+    int get_loaded_chunk_count() const;
+    int get_pending_load_count() const;
+
+    // Internal: worker entry and main-thread completion
+    void _load_chunk_task(int chunk_index, int generation, int zoom, const Rect2i &tile_range);
+    void _apply_loaded_chunks();
+
+protected:
+    static void _bind_methods();
+
+private:
+    struct ChunkState {
+        ObjectID node_id;
+        std::vector<ObjectID> mesh_ids;
+        AABB bounds;                // In this node's local space
+        double latitude = 0.0;
+        double distance = 0.0;      // Camera distance at the last update
+
+        int zoom = -1;              // Zoom of the applied texture
+        int target_zoom = -1;       // Zoom being loaded (or queued)
+        Rect2i tile_range;          // Tiles of target_zoom (column, row, count x, count y)
+        int generation = 0;
+        bool loading = false;
+        bool queued = false;        // target_zoom differs from zoom and needs a load
+        int64_t task_id = -1;
+        int failed_loads = 0;       // Consecutive failed loads
+        uint64_t retry_at_ms = 0;   // No new load is requested before this tick after a failure
+
+        Ref<ShaderMaterial> material;
+        Ref<ImageTexture> texture;
+    };
+
+    struct LoadResult {
+        int chunk_index;
+        int generation;
+        int zoom;
+        Ref<Image> image;
+        Vector2 drape_origin;       // Local XZ of the mosaic's north-west corner
+        Vector2 drape_u;            // Local XZ step for one texture width (east)
+        Vector2 drape_v;            // Local XZ step for one texture height (south)
+    };
+
+    Ref<PLATEAUVectorTileDownloader> downloader_;
+    Ref<PLATEAUGeoReference> geo_reference_;
+    Node3D *terrain_root_;
+    Camera3D *camera_;
+
+    int min_zoom_;
+    int max_zoom_;
+    float texels_per_pixel_;
+    int max_tiles_per_chunk_;
+    int max_concurrent_loads_;
+    bool download_missing_;
+
+    std::vector<ChunkState> chunks_;
+    std::vector<LoadResult> results_;
+    mutable std::mutex mutex_;
+    std::mutex fetch_mutex_;        // fetch_tiles() on the shared downloader is not reentrant
+    Ref<Shader> shader_;
+    Transform3D drape_transform_;   // World -> this node's local space, as passed to materials
+    double update_timer_;
+
+    Camera3D *get_tracked_camera() const;
+    bool compute_tile_range(const ChunkState &chunk, int zoom, Rect2i &out_range) const;
+    void start_pending_loads();
+    void wait_for_loads();
+    void apply_result(const LoadResult &result);
+    Ref<ShaderMaterial> create_chunk_material();
+};
+
+} // namespace godot
@@ -94,7 +94,19 @@ String PLATEAUMeshData::get_name() const {
 }
 
 void PLATEAUMeshData::set_mesh(const Ref<ArrayMesh> &mesh) {
+    // Track in-place edits (add_surface_from_arrays, clear_surfaces, ...) so a cached
+    // native mesh never outlives the geometry it was built from
+    Callable on_changed = callable_mp(this, &PLATEAUMeshData::_on_mesh_changed);
+    if (mesh_.is_valid() && mesh_->is_connected("changed", on_changed)) {
+        mesh_->disconnect("changed", on_changed);
+    }
+
     mesh_ = mesh;
+
+    if (mesh_.is_valid() && !mesh_->is_connected("changed", on_changed)) {
+        mesh_->connect("changed", on_changed);
+    }
+    clear_native_mesh();
 }
 
 Ref<ArrayMesh> PLATEAUMeshData::get_mesh() const {
@@ -212,6 +224,7 @@ String PLATEAUMeshData::get_gml_id_from_uv(const Vector2 &uv) const {
 // Texture path methods for export
 void PLATEAUMeshData::set_texture_paths(const PackedStringArray &paths) {
     texture_paths_ = paths;
+    clear_native_mesh();
 }
 
 PackedStringArray PLATEAUMeshData::get_texture_paths() const {
@@ -220,6 +233,7 @@ PackedStringArray PLATEAUMeshData::get_texture_paths() const {
 
 void PLATEAUMeshData::add_texture_path(const String &path) {
     texture_paths_.push_back(path);
+    clear_native_mesh();
 }
 
 String PLATEAUMeshData::get_texture_path(int surface_index) const {
@@ -233,6 +247,30 @@ int PLATEAUMeshData::get_texture_path_count() const {
     return texture_paths_.size();
 }
 
+void PLATEAUMeshData::set_native_mesh(const std::shared_ptr<const PlateauMesh> &native_mesh) {
+    std::lock_guard<std::mutex> lock(native_mesh_mutex_);
+    native_mesh_ = native_mesh;
+}
+
+std::shared_ptr<const PlateauMesh> PLATEAUMeshData::get_native_mesh() const {
+    std::lock_guard<std::mutex> lock(native_mesh_mutex_);
+    return native_mesh_;
+}
+
+bool PLATEAUMeshData::has_native_mesh() const {
+    std::lock_guard<std::mutex> lock(native_mesh_mutex_);
+    return native_mesh_ != nullptr;
+}
+
+void PLATEAUMeshData::clear_native_mesh() {
+    std::lock_guard<std::mutex> lock(native_mesh_mutex_);
+    native_mesh_.reset();
+}
+
+void PLATEAUMeshData::_on_mesh_changed() {
+    clear_native_mesh();
+}
+
 void PLATEAUMeshData::_bind_methods() {
     ClassDB::bind_method(D_METHOD("set_name", "name"), &PLATEAUMeshData::set_name);
     ClassDB::bind_method(D_METHOD("get_name"), &PLATEAUMeshData::get_name);
@@ -277,6 +315,10 @@ void PLATEAUMeshData::_bind_methods() {
     ClassDB::bind_method(D_METHOD("get_texture_path", "surface_index"), &PLATEAUMeshData::get_texture_path);
     ClassDB::bind_method(D_METHOD("get_texture_path_count"), &PLATEAUMeshData::get_texture_path_count);
 
+    // Native mesh cache
+    ClassDB::bind_method(D_METHOD("has_native_mesh"), &PLATEAUMeshData::has_native_mesh);
+    ClassDB::bind_method(D_METHOD("clear_native_mesh"), &PLATEAUMeshData::clear_native_mesh);
+
     // CityObjectType enum constants
     BIND_CONSTANT(COT_GenericCityObject);
     BIND_CONSTANT(COT_Building);
@@ -399,7 +441,7 @@ TypedArray<PLATEAUMeshData> PLATEAUCityModel::extract_meshes(const Ref<PLATEAUMe
         // Convert each root node
         for (size_t i = 0; i < model->getRootNodeCount(); i++) {
             const PlateauNode &node = model->getRootNodeAt(i);
-            Ref<PLATEAUMeshData> mesh_data = convert_node(node);
+            Ref<PLATEAUMeshData> mesh_data = convert_node(node, model);
             if (mesh_data.is_valid()) {
                 result.push_back(mesh_data);
             }
@@ -434,7 +476,8 @@ Vector3 PLATEAUCityModel::get_center_point(int coordinate_zone_id) const {
     return Vector3(center.x, center.y, center.z);
 }
 
-Ref<PLATEAUMeshData> PLATEAUCityModel::convert_node(const plateau::polygonMesh::Node &node) {
+Ref<PLATEAUMeshData> PLATEAUCityModel::convert_node(const plateau::polygonMesh::Node &node,
+                                                    const std::shared_ptr<const plateau::polygonMesh::Model> &owner) {
     Ref<PLATEAUMeshData> mesh_data;
     mesh_data.instantiate();
 
@@ -452,6 +495,12 @@ Ref<PLATEAUMeshData> PLATEAUCityModel::convert_node(const plateau::polygonMesh::
             mesh_data->set_mesh(godot_mesh);
             mesh_data->set_city_object_list(city_object_list);
             mesh_data->set_texture_paths(texture_paths);
+
+            // Share the extracted mesh without copying; the aliasing pointer keeps
+            // the whole Model alive for as long as any mesh data references it
+            if (keep_native_meshes_ && owner) {
+                mesh_data->set_native_mesh(std::shared_ptr<const PlateauMesh>(owner, mesh));
+            }
         }
     }
 
@@ -506,7 +555,7 @@ Ref<PLATEAUMeshData> PLATEAUCityModel::convert_node(const plateau::polygonMesh::
     // Convert children recursively
     for (size_t i = 0; i < node.getChildCount(); i++) {
         const PlateauNode &child = node.getChildAt(i);
-        Ref<PLATEAUMeshData> child_data = convert_node(child);
+        Ref<PLATEAUMeshData> child_data = convert_node(child, owner);
         if (child_data.is_valid()) {
             mesh_data->add_child(child_data);
         }
@@ -945,6 +994,14 @@ int PLATEAUCityModel::get_log_level() const {
     return log_level_;
 }
 
+void PLATEAUCityModel::set_keep_native_meshes(bool keep) {
+    keep_native_meshes_ = keep;
+}
+
+bool PLATEAUCityModel::get_keep_native_meshes() const {
+    return keep_native_meshes_;
+}
+
 void PLATEAUCityModel::_bind_methods() {
     ClassDB::bind_method(D_METHOD("load", "gml_path"), &PLATEAUCityModel::load);
     ClassDB::bind_method(D_METHOD("is_loaded"), &PLATEAUCityModel::is_loaded);
@@ -966,6 +1023,10 @@ void PLATEAUCityModel::_bind_methods() {
     ClassDB::bind_method(D_METHOD("get_log_level"), &PLATEAUCityModel::get_log_level);
     ADD_PROPERTY(PropertyInfo(Variant::INT, "log_level", PROPERTY_HINT_ENUM, "None,Error,Warning,Info,Debug"), "set_log_level", "get_log_level");
 
+    ClassDB::bind_method(D_METHOD("set_keep_native_meshes", "keep"), &PLATEAUCityModel::set_keep_native_meshes);
+    ClassDB::bind_method(D_METHOD("get_keep_native_meshes"), &PLATEAUCityModel::get_keep_native_meshes);
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "keep_native_meshes"), "set_keep_native_meshes", "get_keep_native_meshes");
+
     // Log level enum constants
     BIND_CONSTANT(LOG_LEVEL_NONE);
     BIND_CONSTANT(LOG_LEVEL_ERROR);
@@ -1062,7 +1123,7 @@ void PLATEAUCityModel::_finalize_meshes_on_main_thread() {
     if (pending_model_) {
         for (size_t i = 0; i < pending_model_->getRootNodeCount(); i++) {
             const PlateauNode &node = pending_model_->getRootNodeAt(i);
-            Ref<PLATEAUMeshData> mesh_data = convert_node(node);
+            Ref<PLATEAUMeshData> mesh_data = convert_node(node, pending_model_);
             if (mesh_data.is_valid()) {
                 result.push_back(mesh_data);
             }
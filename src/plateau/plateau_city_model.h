@@ -9,6 +9,8 @@
 #include <godot_cpp/variant/dictionary.hpp>
 
 #include <atomic>
+#include <memory>
+#include <mutex>
 
 #include <citygml/citygml.h>
 #include <citygml/citymodel.h>
@@ -133,10 +135,20 @@ public:
     String get_texture_path(int surface_index) const;
     int get_texture_path_count() const;
 
+    // Native libplateau mesh backing this data, either the mesh it was extracted from
+    // (PLATEAUCityModel.keep_native_meshes) or a cached conversion of the ArrayMesh.
+    // Dropped automatically when the ArrayMesh is replaced or emits "changed".
+    void set_native_mesh(const std::shared_ptr<const plateau::polygonMesh::Mesh> &native_mesh);
+    std::shared_ptr<const plateau::polygonMesh::Mesh> get_native_mesh() const;
+    bool has_native_mesh() const;
+    void clear_native_mesh();
+
 protected:
     static void _bind_methods();
 
 private:
+    void _on_mesh_changed();
+
     String name_;
     Ref<ArrayMesh> mesh_;
     Transform3D transform_;
@@ -150,6 +162,10 @@ private:
 
     // Texture paths for each surface (for export)
     PackedStringArray texture_paths_;
+
+    // Native mesh shared with converters to skip ArrayMesh round-trips
+    std::shared_ptr<const plateau::polygonMesh::Mesh> native_mesh_;
+    mutable std::mutex native_mesh_mutex_;
 };
 
 // Main class for loading CityGML and extracting meshes
@@ -190,6 +206,12 @@ public:
     void set_log_level(int level);
     int get_log_level() const;
 
+    // Keep extracted libplateau meshes alive alongside the Godot meshes so converters
+    // (aligner, exporter, granularity converter, terrain) can use them without copying
+    // back out of ArrayMesh. Trades memory for conversion speed; default off.
+    void set_keep_native_meshes(bool keep);
+    bool get_keep_native_meshes() const;
+
 protected:
     static void _bind_methods();
 
@@ -198,6 +220,7 @@ private:
     String gml_path_;
     bool is_loaded_;
     int log_level_ = LOG_LEVEL_WARNING;  // Default: show warnings and errors
+    bool keep_native_meshes_ = false;
 
     // Async processing state
     std::atomic<bool> is_processing_{false};
@@ -217,7 +240,9 @@ private:
     mutable HashMap<String, Ref<StandardMaterial3D>> material_cache_;
 
     // Helper methods for mesh conversion
-    Ref<PLATEAUMeshData> convert_node(const plateau::polygonMesh::Node &node);
+    // owner keeps the extracted Model alive when native meshes are retained
+    Ref<PLATEAUMeshData> convert_node(const plateau::polygonMesh::Node &node,
+                                      const std::shared_ptr<const plateau::polygonMesh::Model> &owner);
     Ref<ArrayMesh> convert_mesh(const plateau::polygonMesh::Mesh &mesh, plateau::polygonMesh::CityObjectList &out_city_object_list, PackedStringArray &out_texture_paths);
     Ref<StandardMaterial3D> create_material(const plateau::polygonMesh::SubMesh &sub_mesh);
 
@@ -1,5 +1,19 @@
 #include "plateau_dataset_source.h"
+#include "plateau_gml_file.h"
+#include "plateau_parallel.h"
 #include <godot_cpp/variant/utility_functions.hpp>
+#include <godot_cpp/classes/dir_access.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/time.hpp>
+
+#include <plateau/dataset/gml_file.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace godot;
 
@@ -129,7 +143,9 @@ void PLATEAUDatasetGroup::_bind_methods() {
 // ============================================================================
 
 PLATEAUGmlFileInfo::PLATEAUGmlFileInfo()
-    : max_lod_(0), package_type_(0) {
+    : max_lod_(0), package_type_(0),
+      min_lat_(0.0), min_lon_(0.0), max_lat_(0.0), max_lon_(0.0), has_envelope_(false),
+      file_size_(0), modified_time_(0) {
 }
 
 PLATEAUGmlFileInfo::~PLATEAUGmlFileInfo() {
@@ -167,6 +183,45 @@ int64_t PLATEAUGmlFileInfo::get_package_type() const {
     return package_type_;
 }
 
+void PLATEAUGmlFileInfo::set_envelope(double min_lat, double min_lon, double max_lat, double max_lon) {
+    min_lat_ = min_lat;
+    min_lon_ = min_lon;
+    max_lat_ = max_lat;
+    max_lon_ = max_lon;
+    has_envelope_ = true;
+}
+
+Dictionary PLATEAUGmlFileInfo::get_envelope() const {
+    Dictionary result;
+    if (has_envelope_) {
+        result["min_lat"] = min_lat_;
+        result["max_lat"] = max_lat_;
+        result["min_lon"] = min_lon_;
+        result["max_lon"] = max_lon_;
+    }
+    return result;
+}
+
+bool PLATEAUGmlFileInfo::has_envelope() const {
+    return has_envelope_;
+}
+
+void PLATEAUGmlFileInfo::set_file_size(int64_t size) {
+    file_size_ = size;
+}
+
+int64_t PLATEAUGmlFileInfo::get_file_size() const {
+    return file_size_;
+}
+
+void PLATEAUGmlFileInfo::set_modified_time(int64_t time) {
+    modified_time_ = time;
+}
+
+int64_t PLATEAUGmlFileInfo::get_modified_time() const {
+    return modified_time_;
+}
+
 void PLATEAUGmlFileInfo::_bind_methods() {
     ClassDB::bind_method(D_METHOD("set_path", "path"), &PLATEAUGmlFileInfo::set_path);
     ClassDB::bind_method(D_METHOD("get_path"), &PLATEAUGmlFileInfo::get_path);
@@ -183,14 +238,187 @@ void PLATEAUGmlFileInfo::_bind_methods() {
     ClassDB::bind_method(D_METHOD("set_package_type", "type"), &PLATEAUGmlFileInfo::set_package_type);
     ClassDB::bind_method(D_METHOD("get_package_type"), &PLATEAUGmlFileInfo::get_package_type);
     ADD_PROPERTY(PropertyInfo(Variant::INT, "package_type"), "set_package_type", "get_package_type");
+
+    ClassDB::bind_method(D_METHOD("set_envelope", "min_lat", "min_lon", "max_lat", "max_lon"), &PLATEAUGmlFileInfo::set_envelope);
+    ClassDB::bind_method(D_METHOD("get_envelope"), &PLATEAUGmlFileInfo::get_envelope);
+    ClassDB::bind_method(D_METHOD("has_envelope"), &PLATEAUGmlFileInfo::has_envelope);
+
+    ClassDB::bind_method(D_METHOD("set_file_size", "size"), &PLATEAUGmlFileInfo::set_file_size);
+    ClassDB::bind_method(D_METHOD("get_file_size"), &PLATEAUGmlFileInfo::get_file_size);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "file_size"), "set_file_size", "get_file_size");
+
+    ClassDB::bind_method(D_METHOD("set_modified_time", "time"), &PLATEAUGmlFileInfo::set_modified_time);
+    ClassDB::bind_method(D_METHOD("get_modified_time"), &PLATEAUGmlFileInfo::get_modified_time);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "modified_time"), "set_modified_time", "get_modified_time");
 }
 
 // ============================================================================
 // PLATEAUDatasetSource
 // ============================================================================
 
+static const uint32_t GML_INDEX_MAGIC = 0x49474C50; // "PLGI"
+static const uint32_t GML_INDEX_VERSION = 2;
+static const int GML_INDEX_RECORD_SIZE = 64;
+
+// Collect .gml files under udx/ (paths relative to root_path). The tree is walked
+// breadth first and all directories of one level are listed in parallel.
+// Appearance directories only hold textures and are skipped.
+static void walk_gml_files(const String &root_path, std::vector<String> &out_files) {
+    std::vector<String> level;
+    level.push_back("udx");
+
+    while (!level.empty()) {
+        std::vector<PackedStringArray> files(level.size());
+        std::vector<PackedStringArray> directories(level.size());
+        plateau_parallel::parallel_for(0, level.size(), [&](size_t i) {
+            String directory = root_path.path_join(level[i]);
+            files[i] = DirAccess::get_files_at(directory);
+            directories[i] = DirAccess::get_directories_at(directory);
+        }, 1);
+
+        std::vector<String> next_level;
+        for (size_t i = 0; i < level.size(); i++) {
+            for (int j = 0; j < files[i].size(); j++) {
+                if (files[i][j].get_extension().to_lower() == "gml") {
+                    out_files.push_back(level[i].path_join(files[i][j]));
+                }
+            }
+            for (int j = 0; j < directories[i].size(); j++) {
+                if (!directories[i][j].ends_with("_appearance")) {
+                    next_level.push_back(level[i].path_join(directories[i][j]));
+                }
+            }
+        }
+        level.swap(next_level);
+    }
+}
+
+// ============================================================================
+// Spatial index helpers
+// ============================================================================
+
+static const size_t SPATIAL_NODE_CAPACITY = 16;
+static const double METERS_PER_DEGREE = 111319.49079327357; // WGS84 equator, 2 * pi * 6378137 / 360
+
+struct SpatialBox {
+    double min_lat;
+    double min_lon;
+    double max_lat;
+    double max_lon;
+    uint32_t id;
+};
+
+// Sort-Tile-Recursive order: vertical slices by longitude, then latitude inside each slice,
+// so every run of SPATIAL_NODE_CAPACITY boxes is spatially compact
+static void sort_tile_recursive(std::vector<SpatialBox> &boxes) {
+    size_t node_count = (boxes.size() + SPATIAL_NODE_CAPACITY - 1) / SPATIAL_NODE_CAPACITY;
+    size_t slice_count = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(node_count))));
+    size_t slice_size = std::max<size_t>(1, slice_count) * SPATIAL_NODE_CAPACITY;
+
+    std::sort(boxes.begin(), boxes.end(), [](const SpatialBox &a, const SpatialBox &b) {
+        return a.min_lon + a.max_lon < b.min_lon + b.max_lon;
+    });
+    for (size_t start = 0; start < boxes.size(); start += slice_size) {
+        size_t end = std::min(start + slice_size, boxes.size());
+        std::sort(boxes.begin() + start, boxes.begin() + end, [](const SpatialBox &a, const SpatialBox &b) {
+            return a.min_lat + a.max_lat < b.min_lat + b.max_lat;
+        });
+    }
+}
+
+static inline bool boxes_intersect(double a_min_lat, double a_min_lon, double a_max_lat, double a_max_lon,
+                                   double b_min_lat, double b_min_lon, double b_max_lat, double b_max_lon) {
+    return a_min_lat <= b_max_lat && b_min_lat <= a_max_lat &&
+           a_min_lon <= b_max_lon && b_min_lon <= a_max_lon;
+}
+
+// Even-odd rule; x = longitude, y = latitude
+static bool point_in_polygon(double x, double y, const PackedVector2Array &polygon) {
+    bool inside = false;
+    int count = polygon.size();
+    for (int i = 0, j = count - 1; i < count; j = i++) {
+        double xi = polygon[i].x, yi = polygon[i].y;
+        double xj = polygon[j].x, yj = polygon[j].y;
+        if ((yi > y) != (yj > y) && x < (xj - xi) * (y - yi) / (yj - yi) + xi) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+static bool segments_intersect(double ax, double ay, double bx, double by,
+                               double cx, double cy, double dx, double dy) {
+    auto cross = [](double ox, double oy, double px, double py, double qx, double qy) {
+        return (px - ox) * (qy - oy) - (py - oy) * (qx - ox);
+    };
+    double d1 = cross(cx, cy, dx, dy, ax, ay);
+    double d2 = cross(cx, cy, dx, dy, bx, by);
+    double d3 = cross(ax, ay, bx, by, cx, cy);
+    double d4 = cross(ax, ay, bx, by, dx, dy);
+    if (((d1 > 0 && d2 < 0) || (d1 < 0 && d2 > 0)) && ((d3 > 0 && d4 < 0) || (d3 < 0 && d4 > 0))) {
+        return true;
+    }
+    // Touching or collinear cases count as intersecting
+    auto on_segment = [](double ox, double oy, double px, double py, double qx, double qy) {
+        return std::min(ox, px) <= qx && qx <= std::max(ox, px) && std::min(oy, py) <= qy && qy <= std::max(oy, py);
+    };
+    return (d1 == 0 && on_segment(cx, cy, dx, dy, ax, ay)) ||
+           (d2 == 0 && on_segment(cx, cy, dx, dy, bx, by)) ||
+           (d3 == 0 && on_segment(ax, ay, bx, by, cx, cy)) ||
+           (d4 == 0 && on_segment(ax, ay, bx, by, dx, dy));
+}
+
+static bool envelope_intersects_polygon(double min_lat, double min_lon, double max_lat, double max_lon,
+                                        const PackedVector2Array &polygon) {
+    // Envelope inside the polygon
+    if (point_in_polygon(min_lon, min_lat, polygon)) {
+        return true;
+    }
+    int count = polygon.size();
+    // Polygon inside the envelope
+    if (polygon[0].x >= min_lon && polygon[0].x <= max_lon && polygon[0].y >= min_lat && polygon[0].y <= max_lat) {
+        return true;
+    }
+    // Crossing edges
+    const double corners[4][2] = { { min_lon, min_lat }, { max_lon, min_lat }, { max_lon, max_lat }, { min_lon, max_lat } };
+    for (int i = 0, j = count - 1; i < count; j = i++) {
+        for (int k = 0; k < 4; k++) {
+            const double *c0 = corners[k];
+            const double *c1 = corners[(k + 1) % 4];
+            if (segments_intersect(polygon[j].x, polygon[j].y, polygon[i].x, polygon[i].y, c0[0], c0[1], c1[0], c1[1])) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static void append_index_string(std::vector<uint8_t> &buffer, const String &value) {
+    CharString utf8 = value.utf8();
+    uint16_t length = static_cast<uint16_t>(std::min<int64_t>(utf8.length(), 0xFFFF));
+    size_t offset = buffer.size();
+    buffer.resize(offset + 2 + length);
+    memcpy(buffer.data() + offset, &length, 2);
+    memcpy(buffer.data() + offset + 2, utf8.get_data(), length);
+}
+
+static bool read_index_string(const uint8_t *&ptr, const uint8_t *end, String &out) {
+    if (end - ptr < 2) {
+        return false;
+    }
+    uint16_t length;
+    memcpy(&length, ptr, 2);
+    ptr += 2;
+    if (end - ptr < length) {
+        return false;
+    }
+    out = String::utf8(reinterpret_cast<const char *>(ptr), length);
+    ptr += length;
+    return true;
+}
+
 PLATEAUDatasetSource::PLATEAUDatasetSource()
-    : is_valid_(false) {
+    : is_valid_(false), indexed_(false), spatial_dirty_(true) {
 }
 
 PLATEAUDatasetSource::~PLATEAUDatasetSource() {
@@ -219,6 +447,62 @@ Ref<PLATEAUDatasetSource> PLATEAUDatasetSource::create_local(const String &local
     return source;
 }
 
+Ref<PLATEAUDatasetSource> PLATEAUDatasetSource::create_local_indexed(const String &local_path, const String &index_path, bool revalidate) {
+    Ref<PLATEAUDatasetSource> source;
+    source.instantiate();
+
+    String root_path = local_path.replace("\\", "/").trim_suffix("/");
+    ERR_FAIL_COND_V_MSG(!DirAccess::dir_exists_absolute(root_path.path_join("udx")), source,
+        "PLATEAUDatasetSource: udx directory not found in " + local_path);
+
+    source->indexed_ = true;
+    source->root_path_ = root_path;
+
+    // The index lives next to the data; read-only datasets keep it in user:// instead
+    String dataset_index_path = root_path.path_join(".plateau_gml_index");
+    String fallback_index_path = String("user://plateau_gml_index").path_join(root_path.md5_text() + ".idx");
+    if (!index_path.is_empty()) {
+        source->index_path_ = index_path;
+    } else if (!FileAccess::file_exists(dataset_index_path) && FileAccess::file_exists(fallback_index_path)) {
+        source->index_path_ = fallback_index_path;
+    } else {
+        source->index_path_ = dataset_index_path;
+    }
+
+    uint64_t start_ms = Time::get_singleton()->get_ticks_msec();
+    bool loaded = source->load_index(source->index_path_);
+
+    Error err = OK;
+    if (loaded && !revalidate) {
+        Dictionary stats;
+        stats["files"] = static_cast<int64_t>(source->entries_.size());
+        stats["reused"] = static_cast<int64_t>(source->entries_.size());
+        stats["scanned"] = 0;
+        stats["removed"] = 0;
+        stats["failed"] = 0;
+        stats["loaded_from_index"] = true;
+        stats["elapsed_ms"] = static_cast<int64_t>(Time::get_singleton()->get_ticks_msec() - start_ms);
+        source->last_scan_stats_ = stats;
+    } else {
+        err = source->scan_dataset(!loaded);
+        source->last_scan_stats_["loaded_from_index"] = loaded;
+        source->last_scan_stats_["elapsed_ms"] = static_cast<int64_t>(Time::get_singleton()->get_ticks_msec() - start_ms);
+    }
+
+    if (err != OK && index_path.is_empty() && source->index_path_ != fallback_index_path) {
+        source->index_path_ = fallback_index_path;
+        err = source->save_index(fallback_index_path);
+    }
+    if (err != OK) {
+        UtilityFunctions::printerr("PLATEAUDatasetSource: Failed to save GML index: ", source->index_path_);
+    }
+
+    source->is_valid_ = true;
+    UtilityFunctions::print("PLATEAUDatasetSource: Indexed ", static_cast<int64_t>(source->entries_.size()),
+        " GML files from ", local_path, " in ", source->last_scan_stats_["elapsed_ms"], " ms");
+    return source;
+}
+
 String PLATEAUDatasetSource::get_default_server_url() {
     // Same value as libplateau's getDefaultServerUrl() in src/network/client.cpp
     return "https://api.plateau.reearth.io";
@@ -247,7 +531,7 @@ PackedStringArray PLATEAUDatasetSource::build_auth_headers(const String &custom_
 }
 
 bool PLATEAUDatasetSource::is_valid() const {
-    return is_valid_ && accessor_ != nullptr;
+    return is_valid_ && (indexed_ || accessor_ != nullptr);
 }
 
 int64_t PLATEAUDatasetSource::get_available_packages() const {
@@ -255,6 +539,14 @@ int64_t PLATEAUDatasetSource::get_available_packages() const {
         return PACKAGE_NONE;
     }
 
+    if (indexed_) {
+        int64_t packages = PACKAGE_NONE;
+        for (const GmlIndexEntry &entry : entries_) {
+            packages |= entry.package_type;
+        }
+        return packages;
+    }
+
     try {
         auto packages = accessor_->getPackages();
         return static_cast<int64_t>(packages);
@@ -269,6 +561,15 @@ TypedArray<PLATEAUGmlFileInfo> PLATEAUDatasetSource::get_gml_files(int64_t packa
 
     ERR_FAIL_COND_V_MSG(!is_valid(), result, "PLATEAUDatasetSource: Source is not valid.");
 
+    if (indexed_) {
+        for (const GmlIndexEntry &entry : entries_) {
+            if (entry.package_type & package_flags) {
+                result.push_back(make_file_info(entry));
+            }
+        }
+        return result;
+    }
+
     try {
         auto package = static_cast<plateau::dataset::PredefinedCityModelPackage>(package_flags);
         auto gml_files = accessor_->getGmlFiles(package);
@@ -281,6 +582,10 @@ TypedArray<PLATEAUGmlFileInfo> PLATEAUDatasetSource::get_gml_files(int64_t packa
                 auto grid_code = gml_file.getGridCode();
                 if (grid_code) {
                     info->set_mesh_code(String(grid_code->get().c_str()));
+                    if (grid_code->isValid()) {
+                        auto extent = grid_code->getExtent();
+                        info->set_envelope(extent.min.latitude, extent.min.longitude, extent.max.latitude, extent.max.longitude);
+                    }
                 }
                 info->set_max_lod(gml_file.getMaxLod());
                 info->set_package_type(static_cast<int64_t>(gml_file.getPackage()));
@@ -304,6 +609,16 @@ PackedStringArray PLATEAUDatasetSource::get_mesh_codes() {
         return result;
     }
 
+    if (indexed_) {
+        std::unordered_set<std::string> seen;
+        for (const GmlIndexEntry &entry : entries_) {
+            if (!entry.mesh_code.is_empty() && seen.insert(entry.mesh_code.utf8().get_data()).second) {
+                result.push_back(entry.mesh_code);
+            }
+        }
+        return result;
+    }
+
     try {
         const auto &grid_codes = accessor_->getGridCodes();
         for (const auto &code : grid_codes) {
@@ -324,6 +639,22 @@ Ref<PLATEAUDatasetSource> PLATEAUDatasetSource::filter_by_mesh_codes(const Packe
 
     ERR_FAIL_COND_V_MSG(!is_valid(), filtered, "PLATEAUDatasetSource: Source is not valid.");
 
+    if (indexed_) {
+        // A code matches files of the same area or inside it (e.g. a 2nd level code selects its 3rd level meshes)
+        filtered->indexed_ = true;
+        filtered->root_path_ = root_path_;
+        for (const GmlIndexEntry &entry : entries_) {
+            for (int i = 0; i < codes.size(); i++) {
+                if (!codes[i].is_empty() && entry.mesh_code.begins_with(codes[i])) {
+                    filtered->entries_.push_back(entry);
+                    break;
+                }
+            }
+        }
+        filtered->is_valid_ = true;
+        return filtered;
+    }
+
     try {
         std::vector<std::shared_ptr<plateau::dataset::GridCode>> grid_codes;
         for (int i = 0; i < codes.size(); i++) {
@@ -343,8 +674,479 @@ Ref<PLATEAUDatasetSource> PLATEAUDatasetSource::filter_by_mesh_codes(const Packe
     return filtered;
 }
 
+void PLATEAUDatasetSource::ensure_spatial_index() {
+    if (!spatial_dirty_) {
+        return;
+    }
+
+    // Sources from create_local() are listed once through libplateau, using the mesh code extent
+    if (!indexed_ && entries_.empty() && accessor_) {
+        try {
+            auto gml_files = accessor_->getGmlFiles(static_cast<plateau::dataset::PredefinedCityModelPackage>(PACKAGE_ALL));
+            if (gml_files) {
+                for (auto &gml_file : *gml_files) {
+                    GmlIndexEntry entry;
+                    entry.path = String::utf8(gml_file.getPath().c_str());
+                    entry.package_type = static_cast<int64_t>(gml_file.getPackage());
+                    entry.max_lod = gml_file.getMaxLod();
+                    auto grid_code = gml_file.getGridCode();
+                    if (grid_code && grid_code->isValid()) {
+                        entry.mesh_code = String::utf8(grid_code->get().c_str());
+                        auto extent = grid_code->getExtent();
+                        entry.min_lat = extent.min.latitude;
+                        entry.min_lon = extent.min.longitude;
+                        entry.max_lat = extent.max.latitude;
+                        entry.max_lon = extent.max.longitude;
+                        entry.has_envelope = true;
+                    }
+                    entries_.push_back(entry);
+                }
+            }
+        } catch (const std::exception &e) {
+            UtilityFunctions::printerr("PLATEAUDatasetSource exception: ", String(e.what()));
+        }
+    }
+
+    spatial_levels_.clear();
+    spatial_items_.clear();
+    spatial_dirty_ = false;
+
+    std::vector<SpatialBox> boxes;
+    boxes.reserve(entries_.size());
+    for (size_t i = 0; i < entries_.size(); i++) {
+        const GmlIndexEntry &entry = entries_[i];
+        if (entry.has_envelope) {
+            boxes.push_back({ entry.min_lat, entry.min_lon, entry.max_lat, entry.max_lon, static_cast<uint32_t>(i) });
+        }
+    }
+    if (boxes.empty()) {
+        return;
+    }
+
+    // Bulk-load bottom up: order the boxes of a level, then group runs of them into parent nodes
+    sort_tile_recursive(boxes);
+    spatial_items_.reserve(boxes.size());
+    for (const SpatialBox &box : boxes) {
+        spatial_items_.push_back(box.id);
+    }
+
+    while (true) {
+        std::vector<SpatialNode> level;
+        level.reserve((boxes.size() + SPATIAL_NODE_CAPACITY - 1) / SPATIAL_NODE_CAPACITY);
+        for (size_t start = 0; start < boxes.size(); start += SPATIAL_NODE_CAPACITY) {
+            size_t end = std::min(start + SPATIAL_NODE_CAPACITY, boxes.size());
+            SpatialNode node = { boxes[start].min_lat, boxes[start].min_lon, boxes[start].max_lat, boxes[start].max_lon,
+                                 static_cast<uint32_t>(start), static_cast<uint32_t>(end - start) };
+            for (size_t i = start + 1; i < end; i++) {
+                node.min_lat = std::min(node.min_lat, boxes[i].min_lat);
+                node.min_lon = std::min(node.min_lon, boxes[i].min_lon);
+                node.max_lat = std::max(node.max_lat, boxes[i].max_lat);
+                node.max_lon = std::max(node.max_lon, boxes[i].max_lon);
+            }
+            level.push_back(node);
+        }
+
+        if (level.size() <= SPATIAL_NODE_CAPACITY) {
+            spatial_levels_.push_back(std::move(level));
+            break;
+        }
+
+        // Reorder this level so that the next level's groups are contiguous
+        boxes.clear();
+        for (size_t i = 0; i < level.size(); i++) {
+            boxes.push_back({ level[i].min_lat, level[i].min_lon, level[i].max_lat, level[i].max_lon, static_cast<uint32_t>(i) });
+        }
+        sort_tile_recursive(boxes);
+        std::vector<SpatialNode> ordered;
+        ordered.reserve(level.size());
+        for (const SpatialBox &box : boxes) {
+            ordered.push_back(level[box.id]);
+        }
+        spatial_levels_.push_back(std::move(ordered));
+    }
+}
+
+void PLATEAUDatasetSource::search_spatial_index(double min_lat, double min_lon, double max_lat, double max_lon,
+                                                std::vector<uint32_t> &out_entries) const {
+    if (spatial_levels_.empty()) {
+        return;
+    }
+
+    std::vector<std::pair<size_t, uint32_t>> stack;
+    size_t top = spatial_levels_.size() - 1;
+    for (uint32_t i = 0; i < spatial_levels_[top].size(); i++) {
+        stack.emplace_back(top, i);
+    }
+
+    while (!stack.empty()) {
+        auto [level, index] = stack.back();
+        stack.pop_back();
+        const SpatialNode &node = spatial_levels_[level][index];
+        if (!boxes_intersect(node.min_lat, node.min_lon, node.max_lat, node.max_lon, min_lat, min_lon, max_lat, max_lon)) {
+            continue;
+        }
+
+        if (level > 0) {
+            for (uint32_t i = node.first; i < node.first + node.count; i++) {
+                stack.emplace_back(level - 1, i);
+            }
+            continue;
+        }
+
+        for (uint32_t i = node.first; i < node.first + node.count; i++) {
+            const GmlIndexEntry &entry = entries_[spatial_items_[i]];
+            if (boxes_intersect(entry.min_lat, entry.min_lon, entry.max_lat, entry.max_lon, min_lat, min_lon, max_lat, max_lon)) {
+                out_entries.push_back(spatial_items_[i]);
+            }
+        }
+    }
+
+    // Keep the entries_ (path) order
+    std::sort(out_entries.begin(), out_entries.end());
+}
+
+TypedArray<PLATEAUGmlFileInfo> PLATEAUDatasetSource::query_bounds(double min_lat, double min_lon, double max_lat, double max_lon,
+                                                                  int64_t package_flags, int min_lod) {
+    TypedArray<PLATEAUGmlFileInfo> result;
+    ERR_FAIL_COND_V_MSG(!is_valid(), result, "PLATEAUDatasetSource: Source is not valid.");
+
+    ensure_spatial_index();
+    std::vector<uint32_t> candidates;
+    search_spatial_index(min_lat, min_lon, max_lat, max_lon, candidates);
+
+    for (uint32_t index : candidates) {
+        const GmlIndexEntry &entry = entries_[index];
+        if ((entry.package_type & package_flags) && entry.max_lod >= min_lod) {
+            result.push_back(make_file_info(entry));
+        }
+    }
+    return result;
+}
+
+TypedArray<PLATEAUGmlFileInfo> PLATEAUDatasetSource::query_polygon(const PackedVector2Array &polygon,
+                                                                   int64_t package_flags, int min_lod) {
+    TypedArray<PLATEAUGmlFileInfo> result;
+    ERR_FAIL_COND_V_MSG(!is_valid(), result, "PLATEAUDatasetSource: Source is not valid.");
+    ERR_FAIL_COND_V_MSG(polygon.size() < 3, result, "PLATEAUDatasetSource: Polygon needs at least 3 vertices.");
+
+    double min_lat = polygon[0].y, max_lat = polygon[0].y;
+    double min_lon = polygon[0].x, max_lon = polygon[0].x;
+    for (int i = 1; i < polygon.size(); i++) {
+        min_lon = std::min(min_lon, static_cast<double>(polygon[i].x));
+        max_lon = std::max(max_lon, static_cast<double>(polygon[i].x));
+        min_lat = std::min(min_lat, static_cast<double>(polygon[i].y));
+        max_lat = std::max(max_lat, static_cast<double>(polygon[i].y));
+    }
+
+    ensure_spatial_index();
+    std::vector<uint32_t> candidates;
+    search_spatial_index(min_lat, min_lon, max_lat, max_lon, candidates);
+
+    for (uint32_t index : candidates) {
+        const GmlIndexEntry &entry = entries_[index];
+        if (!(entry.package_type & package_flags) || entry.max_lod < min_lod) {
+            continue;
+        }
+        if (envelope_intersects_polygon(entry.min_lat, entry.min_lon, entry.max_lat, entry.max_lon, polygon)) {
+            result.push_back(make_file_info(entry));
+        }
+    }
+    return result;
+}
+
+TypedArray<PLATEAUGmlFileInfo> PLATEAUDatasetSource::query_radius(double latitude, double longitude, double radius_meters,
+                                                                  int64_t package_flags, int min_lod) {
+    TypedArray<PLATEAUGmlFileInfo> result;
+    ERR_FAIL_COND_V_MSG(!is_valid(), result, "PLATEAUDatasetSource: Source is not valid.");
+    ERR_FAIL_COND_V_MSG(radius_meters < 0.0, result, "PLATEAUDatasetSource: Radius must not be negative.");
+
+    // Local equirectangular approximation around the query point (accurate for city-scale radii)
+    double meters_per_lon = METERS_PER_DEGREE * Math::max(Math::cos(Math::deg_to_rad(latitude)), 1e-6);
+    double lat_radius = radius_meters / METERS_PER_DEGREE;
+    double lon_radius = radius_meters / meters_per_lon;
+
+    ensure_spatial_index();
+    std::vector<uint32_t> candidates;
+    search_spatial_index(latitude - lat_radius, longitude - lon_radius, latitude + lat_radius, longitude + lon_radius, candidates);
+
+    double radius_sq = radius_meters * radius_meters;
+    for (uint32_t index : candidates) {
+        const GmlIndexEntry &entry = entries_[index];
+        if (!(entry.package_type & package_flags) || entry.max_lod < min_lod) {
+            continue;
+        }
+        // Distance from the point to the nearest point of the envelope
+        double dy = (Math::clamp(latitude, entry.min_lat, entry.max_lat) - latitude) * METERS_PER_DEGREE;
+        double dx = (Math::clamp(longitude, entry.min_lon, entry.max_lon) - longitude) * meters_per_lon;
+        if (dx * dx + dy * dy <= radius_sq) {
+            result.push_back(make_file_info(entry));
+        }
+    }
+    return result;
+}
+
+bool PLATEAUDatasetSource::is_indexed() const {
+    return indexed_;
+}
+
+String PLATEAUDatasetSource::get_index_path() const {
+    return index_path_;
+}
+
+Error PLATEAUDatasetSource::refresh_index() {
+    ERR_FAIL_COND_V_MSG(!indexed_ || index_path_.is_empty(), ERR_UNCONFIGURED,
+        "PLATEAUDatasetSource: Source was not created with create_local_indexed().");
+
+    uint64_t start_ms = Time::get_singleton()->get_ticks_msec();
+    Error err = scan_dataset(false);
+    last_scan_stats_["loaded_from_index"] = true;
+    last_scan_stats_["elapsed_ms"] = static_cast<int64_t>(Time::get_singleton()->get_ticks_msec() - start_ms);
+    return err;
+}
+
+Dictionary PLATEAUDatasetSource::get_last_scan_stats() const {
+    return last_scan_stats_;
+}
+
+bool PLATEAUDatasetSource::read_entry_metadata(const String &root_path, GmlIndexEntry &entry) {
+    String absolute_path = root_path.path_join(entry.path);
+
+    // Package and grid code come from the file name
+    try {
+        plateau::dataset::GmlFile gml_file(absolute_path.utf8().get_data());
+        if (!gml_file.isValid()) {
+            return false;
+        }
+        entry.package_type = static_cast<int64_t>(gml_file.getPackage());
+
+        auto grid_code = gml_file.getGridCode();
+        if (grid_code && grid_code->isValid()) {
+            entry.mesh_code = String::utf8(grid_code->get().c_str());
+            auto extent = grid_code->getExtent();
+            entry.min_lat = extent.min.latitude;
+            entry.min_lon = extent.min.longitude;
+            entry.max_lat = extent.max.latitude;
+            entry.max_lon = extent.max.longitude;
+            entry.has_envelope = true;
+        }
+    } catch (const std::exception &) {
+        return false;
+    }
+
+    // Envelope and max LOD from a byte scan of the content; the grid extent is kept if there is no envelope
+    PLATEAUGmlFile::PrescanResult scan;
+    if (!PLATEAUGmlFile::prescan_file(absolute_path, true, scan)) {
+        return false;
+    }
+    // Files without any lodN element count as LOD 0, as with libplateau's getMaxLod
+    entry.max_lod = std::max(scan.max_lod, 0);
+    entry.size = scan.file_size;
+    if (scan.has_envelope) {
+        entry.min_lat = scan.min_lat;
+        entry.min_lon = scan.min_lon;
+        entry.max_lat = scan.max_lat;
+        entry.max_lon = scan.max_lon;
+        entry.has_envelope = true;
+    }
+    return true;
+}
+
+Error PLATEAUDatasetSource::scan_dataset(bool force_save) {
+    std::vector<String> paths;
+    walk_gml_files(root_path_, paths);
+
+    std::unordered_map<std::string, size_t> previous;
+    previous.reserve(entries_.size());
+    for (size_t i = 0; i < entries_.size(); i++) {
+        previous.emplace(entries_[i].path.utf8().get_data(), i);
+    }
+
+    // Pass 1: stat every file and reuse index entries whose mtime is unchanged
+    std::vector<GmlIndexEntry> scanned(paths.size());
+    std::vector<uint8_t> needs_read(paths.size(), 0);
+    plateau_parallel::parallel_for(0, paths.size(), [&](size_t i) {
+        GmlIndexEntry &entry = scanned[i];
+        uint64_t modified_time = FileAccess::get_modified_time(root_path_.path_join(paths[i]));
+        auto it = previous.find(paths[i].utf8().get_data());
+        if (it != previous.end() && entries_[it->second].modified_time == modified_time) {
+            entry = entries_[it->second];
+        } else {
+            entry.path = paths[i];
+            entry.modified_time = modified_time;
+            needs_read[i] = 1;
+        }
+    }, 256);
+
+    // Pass 2: read new and changed files, spread evenly over the threads
+    std::vector<size_t> to_read;
+    for (size_t i = 0; i < paths.size(); i++) {
+        if (needs_read[i]) {
+            to_read.push_back(i);
+        }
+    }
+    std::vector<uint8_t> read_ok(to_read.size(), 0);
+    plateau_parallel::parallel_for(0, to_read.size(), [&](size_t i) {
+        read_ok[i] = read_entry_metadata(root_path_, scanned[to_read[i]]) ? 1 : 0;
+    }, 4);
+
+    int64_t failed = 0;
+    for (size_t i = 0; i < to_read.size(); i++) {
+        if (!read_ok[i]) {
+            needs_read[to_read[i]] = 2;
+            failed++;
+        }
+    }
+
+    std::vector<GmlIndexEntry> entries;
+    entries.reserve(paths.size());
+    for (size_t i = 0; i < paths.size(); i++) {
+        if (needs_read[i] != 2) {
+            entries.push_back(std::move(scanned[i]));
+        }
+    }
+    std::sort(entries.begin(), entries.end(), [](const GmlIndexEntry &a, const GmlIndexEntry &b) {
+        return a.path < b.path;
+    });
+
+    int64_t read_count = static_cast<int64_t>(to_read.size()) - failed;
+    int64_t reused = static_cast<int64_t>(entries.size()) - read_count;
+    int64_t removed = static_cast<int64_t>(entries_.size()) - reused;
+    entries_.swap(entries);
+    spatial_dirty_ = true;
+
+    Dictionary stats;
+    stats["files"] = static_cast<int64_t>(entries_.size());
+    stats["reused"] = reused;
+    stats["scanned"] = read_count;
+    stats["removed"] = removed;
+    stats["failed"] = failed;
+    last_scan_stats_ = stats;
+
+    if (!force_save && read_count == 0 && removed == 0) {
+        return OK;
+    }
+    return save_index(index_path_);
+}
+
+bool PLATEAUDatasetSource::load_index(const String &path) {
+    if (!FileAccess::file_exists(path)) {
+        return false;
+    }
+    Ref<FileAccess> file = FileAccess::open(path, FileAccess::READ);
+    if (file.is_null() || file->get_length() < 12) {
+        return false;
+    }
+    if (file->get_32() != GML_INDEX_MAGIC || file->get_32() != GML_INDEX_VERSION) {
+        return false;
+    }
+    uint32_t count = file->get_32();
+
+    // Read the whole index in one call and parse it from memory
+    PackedByteArray raw = file->get_buffer(static_cast<int64_t>(file->get_length() - 12));
+    const uint8_t *ptr = raw.ptr();
+    const uint8_t *end = ptr + raw.size();
+
+    std::vector<GmlIndexEntry> entries;
+    entries.reserve(count);
+    for (uint32_t i = 0; i < count; i++) {
+        if (end - ptr < GML_INDEX_RECORD_SIZE) {
+            return false;
+        }
+        GmlIndexEntry entry;
+        int32_t max_lod;
+        uint32_t flags;
+        memcpy(&entry.package_type, ptr, 8);
+        memcpy(&max_lod, ptr + 8, 4);
+        memcpy(&flags, ptr + 12, 4);
+        memcpy(&entry.min_lat, ptr + 16, 8);
+        memcpy(&entry.min_lon, ptr + 24, 8);
+        memcpy(&entry.max_lat, ptr + 32, 8);
+        memcpy(&entry.max_lon, ptr + 40, 8);
+        memcpy(&entry.size, ptr + 48, 8);
+        memcpy(&entry.modified_time, ptr + 56, 8);
+        ptr += GML_INDEX_RECORD_SIZE;
+        entry.max_lod = std::max(max_lod, 0);
+        entry.has_envelope = (flags & 1) != 0;
+
+        if (!read_index_string(ptr, end, entry.path) || !read_index_string(ptr, end, entry.mesh_code)) {
+            return false;
+        }
+        entries.push_back(std::move(entry));
+    }
+
+    entries_.swap(entries);
+    spatial_dirty_ = true;
+    return true;
+}
+
+Error PLATEAUDatasetSource::save_index(const String &path) const {
+    ERR_FAIL_COND_V(path.is_empty(), ERR_INVALID_PARAMETER);
+
+    std::vector<uint8_t> buffer;
+    buffer.reserve(entries_.size() * (GML_INDEX_RECORD_SIZE + 64));
+    for (const GmlIndexEntry &entry : entries_) {
+        size_t offset = buffer.size();
+        buffer.resize(offset + GML_INDEX_RECORD_SIZE);
+        uint8_t *ptr = buffer.data() + offset;
+        int32_t max_lod = entry.max_lod;
+        uint32_t flags = entry.has_envelope ? 1 : 0;
+        memcpy(ptr, &entry.package_type, 8);
+        memcpy(ptr + 8, &max_lod, 4);
+        memcpy(ptr + 12, &flags, 4);
+        memcpy(ptr + 16, &entry.min_lat, 8);
+        memcpy(ptr + 24, &entry.min_lon, 8);
+        memcpy(ptr + 32, &entry.max_lat, 8);
+        memcpy(ptr + 40, &entry.max_lon, 8);
+        memcpy(ptr + 48, &entry.size, 8);
+        memcpy(ptr + 56, &entry.modified_time, 8);
+        append_index_string(buffer, entry.path);
+        append_index_string(buffer, entry.mesh_code);
+    }
+
+    PackedByteArray raw;
+    raw.resize(static_cast<int64_t>(buffer.size()));
+    if (!buffer.empty()) {
+        memcpy(raw.ptrw(), buffer.data(), buffer.size());
+    }
+
+    // Write to a temporary file first so an interrupted save keeps the previous index
+    DirAccess::make_dir_recursive_absolute(path.get_base_dir());
+    String temp_path = path + ".part";
+    {
+        Ref<FileAccess> file = FileAccess::open(temp_path, FileAccess::WRITE);
+        if (file.is_null()) {
+            return ERR_CANT_CREATE;
+        }
+        file->store_32(GML_INDEX_MAGIC);
+        file->store_32(GML_INDEX_VERSION);
+        file->store_32(static_cast<uint32_t>(entries_.size()));
+        file->store_buffer(raw);
+    }
+
+    if (FileAccess::file_exists(path)) {
+        DirAccess::remove_absolute(path);
+    }
+    return DirAccess::rename_absolute(temp_path, path);
+}
+
+Ref<PLATEAUGmlFileInfo> PLATEAUDatasetSource::make_file_info(const GmlIndexEntry &entry) const {
+    Ref<PLATEAUGmlFileInfo> info;
+    info.instantiate();
+    info->set_path(root_path_.path_join(entry.path));
+    info->set_mesh_code(entry.mesh_code);
+    info->set_max_lod(entry.max_lod);
+    info->set_package_type(entry.package_type);
+    if (entry.has_envelope) {
+        info->set_envelope(entry.min_lat, entry.min_lon, entry.max_lat, entry.max_lon);
+    }
+    info->set_file_size(entry.size);
+    info->set_modified_time(static_cast<int64_t>(entry.modified_time));
+    return info;
+}
+
 void PLATEAUDatasetSource::_bind_methods() {
     ClassDB::bind_static_method("PLATEAUDatasetSource", D_METHOD("create_local", "local_path"), &PLATEAUDatasetSource::create_local);
+    ClassDB::bind_static_method("PLATEAUDatasetSource", D_METHOD("create_local_indexed", "local_path", "index_path", "revalidate"), &PLATEAUDatasetSource::create_local_indexed, DEFVAL(""), DEFVAL(true));
     ClassDB::bind_static_method("PLATEAUDatasetSource", D_METHOD("get_default_server_url"), &PLATEAUDatasetSource::get_default_server_url);
     ClassDB::bind_static_method("PLATEAUDatasetSource", D_METHOD("get_mock_server_url"), &PLATEAUDatasetSource::get_mock_server_url);
     ClassDB::bind_static_method("PLATEAUDatasetSource", D_METHOD("build_auth_headers", "custom_token", "use_default_token"), &PLATEAUDatasetSource::build_auth_headers, DEFVAL(""), DEFVAL(true));
@@ -354,6 +1156,13 @@ void PLATEAUDatasetSource::_bind_methods() {
     ClassDB::bind_method(D_METHOD("get_gml_files", "package_flags"), &PLATEAUDatasetSource::get_gml_files);
     ClassDB::bind_method(D_METHOD("get_mesh_codes"), &PLATEAUDatasetSource::get_mesh_codes);
     ClassDB::bind_method(D_METHOD("filter_by_mesh_codes", "codes"), &PLATEAUDatasetSource::filter_by_mesh_codes);
+    ClassDB::bind_method(D_METHOD("query_bounds", "min_lat", "min_lon", "max_lat", "max_lon", "package_flags", "min_lod"), &PLATEAUDatasetSource::query_bounds, DEFVAL(PACKAGE_ALL), DEFVAL(0));
+    ClassDB::bind_method(D_METHOD("query_polygon", "polygon", "package_flags", "min_lod"), &PLATEAUDatasetSource::query_polygon, DEFVAL(PACKAGE_ALL), DEFVAL(0));
+    ClassDB::bind_method(D_METHOD("query_radius", "latitude", "longitude", "radius_meters", "package_flags", "min_lod"), &PLATEAUDatasetSource::query_radius, DEFVAL(PACKAGE_ALL), DEFVAL(0));
+    ClassDB::bind_method(D_METHOD("is_indexed"), &PLATEAUDatasetSource::is_indexed);
+    ClassDB::bind_method(D_METHOD("get_index_path"), &PLATEAUDatasetSource::get_index_path);
+    ClassDB::bind_method(D_METHOD("refresh_index"), &PLATEAUDatasetSource::refresh_index);
+    ClassDB::bind_method(D_METHOD("get_last_scan_stats"), &PLATEAUDatasetSource::get_last_scan_stats);
 
     // Package type enum
     BIND_ENUM_CONSTANT(PACKAGE_NONE);
@@ -4,10 +4,13 @@
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/typed_array.hpp>
 #include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/packed_vector2_array.hpp>
 
 #include <plateau/dataset/dataset_source.h>
 #include <plateau/dataset/i_dataset_accessor.h>
 
+#include <vector>
+
 namespace godot {
 
 // Predefined city model package types (bitmask)
@@ -126,6 +129,18 @@ public:
     void set_package_type(int64_t type);
     int64_t get_package_type() const;
 
+    // Geographic envelope (degrees). Returns Dictionary with keys: min_lat, max_lat, min_lon, max_lon
+    void set_envelope(double min_lat, double min_lon, double max_lat, double max_lon);
+    Dictionary get_envelope() const;
+    bool has_envelope() const;
+
+    // File size in bytes and modification time (Unix time) when the file was indexed
+    void set_file_size(int64_t size);
+    int64_t get_file_size() const;
+
+    void set_modified_time(int64_t time);
+    int64_t get_modified_time() const;
+
 protected:
     static void _bind_methods();
 
@@ -134,6 +149,13 @@ private:
     String mesh_code_;
     int max_lod_;
     int64_t package_type_;
+    double min_lat_;
+    double min_lon_;
+    double max_lat_;
+    double max_lon_;
+    bool has_envelope_;
+    int64_t file_size_;
+    int64_t modified_time_;
 };
 
 /**
@@ -147,6 +169,16 @@ private:
  *     print(file_info.get_path())
  * ```
  *
+ * Large datasets can be opened through a persisted metadata index instead:
+ * ```gdscript
+ * # First run walks udx/ in parallel and writes the index; later runs only re-read changed files
+ * var source = PLATEAUDatasetSource.create_local_indexed("C:/path/to/plateau/data")
+ * print(source.get_last_scan_stats())
+ *
+ * # Files around a point, buildings with LOD2 or higher only
+ * var files = source.query_radius(35.6812, 139.7671, 1500.0, PLATEAUDatasetSource.PACKAGE_BUILDING, 2)
+ * ```
+ *
  * For server access, use HTTPRequest in GDScript directly.
  */
 class PLATEAUDatasetSource : public RefCounted {
@@ -159,6 +191,11 @@ public:
     // Create from local path
     static Ref<PLATEAUDatasetSource> create_local(const String &local_path);
 
+    // Create from local path using a persisted GML metadata index
+    // - index_path: defaults to <local_path>/.plateau_gml_index (user:// if the dataset is read-only)
+    // - revalidate: walk udx/ and re-read new files and files whose mtime changed; false trusts an existing index
+    static Ref<PLATEAUDatasetSource> create_local_indexed(const String &local_path, const String &index_path = "", bool revalidate = true);
+
     // Get default server URL
     static String get_default_server_url();
 
@@ -186,12 +223,78 @@ public:
     // Filter by mesh codes
     Ref<PLATEAUDatasetSource> filter_by_mesh_codes(const PackedStringArray &codes);
 
+    // Spatial queries over file envelopes (degrees), backed by an R-tree built on first use.
+    // Only files of a package in package_flags with max LOD >= min_lod are returned
+    TypedArray<PLATEAUGmlFileInfo> query_bounds(double min_lat, double min_lon, double max_lat, double max_lon,
+                                                int64_t package_flags = PACKAGE_ALL, int min_lod = 0);
+    // polygon: vertices as Vector2(longitude, latitude)
+    TypedArray<PLATEAUGmlFileInfo> query_polygon(const PackedVector2Array &polygon,
+                                                 int64_t package_flags = PACKAGE_ALL, int min_lod = 0);
+    TypedArray<PLATEAUGmlFileInfo> query_radius(double latitude, double longitude, double radius_meters,
+                                                int64_t package_flags = PACKAGE_ALL, int min_lod = 0);
+
+    // Index state (sources from create_local_indexed)
+    bool is_indexed() const;
+    String get_index_path() const;
+
+    // Walk udx/ again, re-read new or changed files and save the index
+    Error refresh_index();
+
+    // Statistics of the last scan: files, reused, scanned, removed, failed, loaded_from_index, elapsed_ms
+    Dictionary get_last_scan_stats() const;
+
 protected:
     static void _bind_methods();
 
 private:
+    struct GmlIndexEntry {
+        String path;                // Relative to root_path_ (e.g. "udx/bldg/53394601_bldg_6697_op.gml")
+        String mesh_code;
+        int64_t package_type = 0;
+        int max_lod = 0;
+        double min_lat = 0.0;
+        double min_lon = 0.0;
+        double max_lat = 0.0;
+        double max_lon = 0.0;
+        bool has_envelope = false;
+        int64_t size = 0;
+        uint64_t modified_time = 0;
+    };
+
+    // Packed R-tree node; children are contiguous in the level below (or in spatial_items_ for leaves)
+    struct SpatialNode {
+        double min_lat;
+        double min_lon;
+        double max_lat;
+        double max_lon;
+        uint32_t first;
+        uint32_t count;
+    };
+
     std::shared_ptr<plateau::dataset::IDatasetAccessor> accessor_;
     bool is_valid_;
+
+    // Index backend (used instead of accessor_ when indexed_ is true)
+    bool indexed_;
+    String root_path_;
+    String index_path_;
+    std::vector<GmlIndexEntry> entries_;
+    Dictionary last_scan_stats_;
+
+    // Spatial index over entries_ (rebuilt lazily after entries_ changes)
+    std::vector<std::vector<SpatialNode>> spatial_levels_;  // [0] = leaves, back() = root level
+    std::vector<uint32_t> spatial_items_;                    // entries_ indices in leaf order
+    bool spatial_dirty_;
+
+    static bool read_entry_metadata(const String &root_path, GmlIndexEntry &entry);
+    bool load_index(const String &path);
+    Error save_index(const String &path) const;
+    Error scan_dataset(bool force_save);
+    Ref<PLATEAUGmlFileInfo> make_file_info(const GmlIndexEntry &entry) const;
+
+    void ensure_spatial_index();
+    void search_spatial_index(double min_lat, double min_lon, double max_lat, double max_lon,
+                              std::vector<uint32_t> &out_entries) const;
 };
 
 } // namespace godot
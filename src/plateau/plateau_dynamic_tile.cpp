@@ -1,12 +1,89 @@
 #include "plateau_dynamic_tile.h"
 
+#include <godot_cpp/classes/array_mesh.hpp>
 #include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/geometry_instance3d.hpp>
+#include <godot_cpp/classes/json.hpp>
+#include <godot_cpp/classes/mesh_instance3d.hpp>
+#include <godot_cpp/classes/performance.hpp>
 #include <godot_cpp/classes/scene_tree.hpp>
 #include <godot_cpp/classes/viewport.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
+#include <chrono>
+#include <cstring>
+
 namespace godot {
 
+// Binary meta store layout (little-endian, fixed-size records so the file can be
+// read in place or memory-mapped):
+//   Header  : char magic[4] "PTMS", u32 version, u32 tile_count, u32 string_count,
+//             f64 reference_point[3]
+//   Records : tile_count x { u32 address_id, u32 group_id, i32 zoom_level, i32 lod,
+//                            f32 position[3], f32 size[3] }
+//   Strings : string_count x { u32 offset, u32 length }, then UTF-8 bytes
+static const char META_STORE_MAGIC[4] = { 'P', 'T', 'M', 'S' };
+static const uint32_t META_STORE_VERSION = 1;
+static const size_t META_STORE_HEADER_SIZE = 40;
+static const size_t META_STORE_RECORD_SIZE = 40;
+static const size_t META_STORE_STRING_ENTRY_SIZE = 8;
+
+// Number of recent load latencies kept for percentile statistics
+static const size_t QUEUE_LATENCY_SAMPLE_COUNT = 256;
+
+// Keys returned by get_statistics()
+static const char *STATISTIC_KEYS[] = {
+    "frame_tiles_queued",
+    "frame_tiles_loaded",
+    "frame_tiles_unloaded",
+    "frame_resource_load_msec",
+    "frame_instantiate_msec",
+    "update_distances_msec",
+    "update_load_states_msec",
+    "update_hole_filling_msec",
+    "update_force_high_resolution_msec",
+    "update_sort_msec",
+    "update_apply_msec",
+    "update_total_msec",
+    "resident_tiles",
+    "resident_bytes",
+    "retained_tiles",
+    "load_queue_size",
+    "unload_queue_size",
+    "queue_latency_p50_msec",
+    "queue_latency_p90_msec",
+    "queue_latency_p99_msec",
+};
+
+// Statistics exposed as Godot custom performance monitors
+static const char *PERFORMANCE_MONITOR_KEYS[] = {
+    "frame_tiles_queued",
+    "frame_tiles_loaded",
+    "frame_tiles_unloaded",
+    "frame_resource_load_msec",
+    "frame_instantiate_msec",
+    "update_total_msec",
+    "resident_tiles",
+    "resident_bytes",
+    "queue_latency_p90_msec",
+};
+
+template <typename T>
+static T read_binary(const uint8_t *ptr) {
+    T value;
+    memcpy(&value, ptr, sizeof(T));
+    return value;
+}
+
+template <typename T>
+static void write_binary(std::vector<uint8_t> &buffer, T value) {
+    size_t offset = buffer.size();
+    buffer.resize(offset + sizeof(T));
+    memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
 // ============================================================================
 // PLATEAUDynamicTile
 // ============================================================================
@@ -16,7 +93,8 @@ PLATEAUDynamicTile::PLATEAUDynamicTile() :
     load_state_(LOAD_STATE_NONE),
     next_load_state_(LOAD_STATE_NONE),
     distance_from_camera_(0.0f),
-    loaded_instance_(nullptr) {
+    loaded_instance_(nullptr),
+    estimated_bytes_(0) {
 }
 
 PLATEAUDynamicTile::~PLATEAUDynamicTile() {
@@ -82,6 +160,10 @@ void PLATEAUDynamicTile::set_loaded_instance(Node3D *instance) {
     loaded_instance_ = instance;
 }
 
+int64_t PLATEAUDynamicTile::get_estimated_bytes() const {
+    return estimated_bytes_;
+}
+
 void PLATEAUDynamicTile::set_parent_tile(const Ref<PLATEAUDynamicTile> &parent) {
     parent_tile_ = parent;
 }
@@ -127,7 +209,11 @@ bool PLATEAUDynamicTile::has_any_children_loaded() const {
 }
 
 float PLATEAUDynamicTile::calculate_distance(const Vector3 &camera_pos, bool ignore_y) const {
-    Vector3 center = extent_.get_center();
+    return calculate_distance_to_extent(extent_, camera_pos, ignore_y);
+}
+
+float PLATEAUDynamicTile::calculate_distance_to_extent(const AABB &extent, const Vector3 &camera_pos, bool ignore_y) {
+    Vector3 center = extent.get_center();
 
     if (ignore_y) {
         // 2D distance (XZ plane)
@@ -136,10 +222,10 @@ float PLATEAUDynamicTile::calculate_distance(const Vector3 &camera_pos, bool ign
         return tile_pos.distance_to(cam_pos);
     } else {
         // 3D distance to closest point on AABB
-        Vector3 closest = extent_.get_center();
-        closest.x = CLAMP(camera_pos.x, extent_.position.x, extent_.position.x + extent_.size.x);
-        closest.y = CLAMP(camera_pos.y, extent_.position.y, extent_.position.y + extent_.size.y);
-        closest.z = CLAMP(camera_pos.z, extent_.position.z, extent_.position.z + extent_.size.z);
+        Vector3 closest = extent.get_center();
+        closest.x = CLAMP(camera_pos.x, extent.position.x, extent.position.x + extent.size.x);
+        closest.y = CLAMP(camera_pos.y, extent.position.y, extent.position.y + extent.size.y);
+        closest.z = CLAMP(camera_pos.z, extent.position.z, extent.position.z + extent.size.z);
         return camera_pos.distance_to(closest);
     }
 }
@@ -165,6 +251,7 @@ void PLATEAUDynamicTile::_bind_methods() {
     ClassDB::bind_method(D_METHOD("get_load_state"), &PLATEAUDynamicTile::get_load_state);
     ClassDB::bind_method(D_METHOD("get_distance_from_camera"), &PLATEAUDynamicTile::get_distance_from_camera);
     ClassDB::bind_method(D_METHOD("get_loaded_instance"), &PLATEAUDynamicTile::get_loaded_instance);
+    ClassDB::bind_method(D_METHOD("get_estimated_bytes"), &PLATEAUDynamicTile::get_estimated_bytes);
     ClassDB::bind_method(D_METHOD("set_parent_tile", "parent"), &PLATEAUDynamicTile::set_parent_tile);
     ClassDB::bind_method(D_METHOD("get_parent_tile"), &PLATEAUDynamicTile::get_parent_tile);
     ClassDB::bind_method(D_METHOD("add_child_tile", "child"), &PLATEAUDynamicTile::add_child_tile);
@@ -263,18 +350,32 @@ void PLATEAUDynamicTileMetaInfo::_bind_methods() {
 // PLATEAUDynamicTileMetaStore
 // ============================================================================
 
-PLATEAUDynamicTileMetaStore::PLATEAUDynamicTileMetaStore() {
+PLATEAUDynamicTileMetaStore::PLATEAUDynamicTileMetaStore() :
+    binary_tile_count_(0),
+    binary_string_count_(0) {
 }
 
 PLATEAUDynamicTileMetaStore::~PLATEAUDynamicTileMetaStore() {
 }
 
 void PLATEAUDynamicTileMetaStore::set_tile_meta_infos(const TypedArray<PLATEAUDynamicTileMetaInfo> &infos) {
+    binary_data_.clear();
+    binary_tile_count_ = 0;
+    binary_string_count_ = 0;
     tile_meta_infos_ = infos;
 }
 
 TypedArray<PLATEAUDynamicTileMetaInfo> PLATEAUDynamicTileMetaStore::get_tile_meta_infos() const {
-    return tile_meta_infos_;
+    if (!is_binary_backed()) {
+        return tile_meta_infos_;
+    }
+
+    TypedArray<PLATEAUDynamicTileMetaInfo> infos;
+    infos.resize(binary_tile_count_);
+    for (int i = 0; i < binary_tile_count_; i++) {
+        infos[i] = create_meta_info_from_binary(i);
+    }
+    return infos;
 }
 
 void PLATEAUDynamicTileMetaStore::set_reference_point(const Vector3 &point) {
@@ -287,21 +388,122 @@ Vector3 PLATEAUDynamicTileMetaStore::get_reference_point() const {
 
 void PLATEAUDynamicTileMetaStore::add_tile_meta_info(const Ref<PLATEAUDynamicTileMetaInfo> &info) {
     if (info.is_valid()) {
+        materialize_binary();
         tile_meta_infos_.append(info);
     }
 }
 
 int PLATEAUDynamicTileMetaStore::get_tile_count() const {
+    if (is_binary_backed()) {
+        return binary_tile_count_;
+    }
     return tile_meta_infos_.size();
 }
 
 Ref<PLATEAUDynamicTileMetaInfo> PLATEAUDynamicTileMetaStore::get_tile_meta_info(int index) const {
-    if (index < 0 || index >= tile_meta_infos_.size()) {
+    if (index < 0 || index >= get_tile_count()) {
         return Ref<PLATEAUDynamicTileMetaInfo>();
     }
+    if (is_binary_backed()) {
+        return create_meta_info_from_binary(index);
+    }
     return tile_meta_infos_[index];
 }
 
+String PLATEAUDynamicTileMetaStore::get_tile_address(int index) const {
+    if (is_binary_backed()) {
+        const uint8_t *record = get_binary_record(index);
+        return record ? get_binary_string(read_binary<uint32_t>(record)) : String();
+    }
+    Ref<PLATEAUDynamicTileMetaInfo> info = get_tile_meta_info(index);
+    return info.is_valid() ? info->get_address() : String();
+}
+
+AABB PLATEAUDynamicTileMetaStore::get_tile_extent(int index) const {
+    if (is_binary_backed()) {
+        const uint8_t *record = get_binary_record(index);
+        if (!record) {
+            return AABB();
+        }
+        AABB extent;
+        extent.position = Vector3(read_binary<float>(record + 16), read_binary<float>(record + 20), read_binary<float>(record + 24));
+        extent.size = Vector3(read_binary<float>(record + 28), read_binary<float>(record + 32), read_binary<float>(record + 36));
+        return extent;
+    }
+    Ref<PLATEAUDynamicTileMetaInfo> info = get_tile_meta_info(index);
+    return info.is_valid() ? info->get_extent() : AABB();
+}
+
+int PLATEAUDynamicTileMetaStore::get_tile_zoom_level(int index) const {
+    if (is_binary_backed()) {
+        const uint8_t *record = get_binary_record(index);
+        return record ? read_binary<int32_t>(record + 8) : 0;
+    }
+    Ref<PLATEAUDynamicTileMetaInfo> info = get_tile_meta_info(index);
+    return info.is_valid() ? info->get_zoom_level() : 0;
+}
+
+String PLATEAUDynamicTileMetaStore::get_tile_group_name(int index) const {
+    if (is_binary_backed()) {
+        const uint8_t *record = get_binary_record(index);
+        return record ? get_binary_string(read_binary<uint32_t>(record + 4)) : String();
+    }
+    Ref<PLATEAUDynamicTileMetaInfo> info = get_tile_meta_info(index);
+    return info.is_valid() ? info->get_group_name() : String();
+}
+
+int PLATEAUDynamicTileMetaStore::get_tile_lod(int index) const {
+    if (is_binary_backed()) {
+        const uint8_t *record = get_binary_record(index);
+        return record ? read_binary<int32_t>(record + 12) : 0;
+    }
+    Ref<PLATEAUDynamicTileMetaInfo> info = get_tile_meta_info(index);
+    return info.is_valid() ? info->get_lod() : 0;
+}
+
+bool PLATEAUDynamicTileMetaStore::is_binary_backed() const {
+    return !binary_data_.is_empty();
+}
+
+const uint8_t *PLATEAUDynamicTileMetaStore::get_binary_record(int index) const {
+    if (index < 0 || index >= binary_tile_count_) {
+        return nullptr;
+    }
+    return binary_data_.ptr() + META_STORE_HEADER_SIZE + static_cast<size_t>(index) * META_STORE_RECORD_SIZE;
+}
+
+String PLATEAUDynamicTileMetaStore::get_binary_string(uint32_t id) const {
+    if (id >= static_cast<uint32_t>(binary_string_count_)) {
+        return String();
+    }
+    const uint8_t *table = binary_data_.ptr() + META_STORE_HEADER_SIZE +
+                           static_cast<size_t>(binary_tile_count_) * META_STORE_RECORD_SIZE;
+    const uint8_t *entry = table + static_cast<size_t>(id) * META_STORE_STRING_ENTRY_SIZE;
+    const uint8_t *blob = table + static_cast<size_t>(binary_string_count_) * META_STORE_STRING_ENTRY_SIZE;
+    uint32_t offset = read_binary<uint32_t>(entry);
+    uint32_t length = read_binary<uint32_t>(entry + 4);
+    return String::utf8(reinterpret_cast<const char *>(blob + offset), length);
+}
+
+Ref<PLATEAUDynamicTileMetaInfo> PLATEAUDynamicTileMetaStore::create_meta_info_from_binary(int index) const {
+    Ref<PLATEAUDynamicTileMetaInfo> info;
+    info.instantiate();
+    info->set_address(get_tile_address(index));
+    info->set_extent(get_tile_extent(index));
+    info->set_zoom_level(get_tile_zoom_level(index));
+    info->set_group_name(get_tile_group_name(index));
+    info->set_lod(get_tile_lod(index));
+    return info;
+}
+
+void PLATEAUDynamicTileMetaStore::materialize_binary() {
+    if (!is_binary_backed()) {
+        return;
+    }
+    TypedArray<PLATEAUDynamicTileMetaInfo> infos = get_tile_meta_infos();
+    set_tile_meta_infos(infos);
+}
+
 Ref<PLATEAUDynamicTileMetaStore> PLATEAUDynamicTileMetaStore::from_json(const Dictionary &json) {
     Ref<PLATEAUDynamicTileMetaStore> store;
     store.instantiate();
@@ -348,18 +550,17 @@ Dictionary PLATEAUDynamicTileMetaStore::to_json() const {
     result["reference_point"] = rp;
 
     Array tiles;
-    for (int i = 0; i < tile_meta_infos_.size(); i++) {
-        Ref<PLATEAUDynamicTileMetaInfo> info = tile_meta_infos_[i];
-        if (info.is_null()) continue;
+    for (int i = 0; i < get_tile_count(); i++) {
+        if (!is_binary_backed() && Ref<PLATEAUDynamicTileMetaInfo>(tile_meta_infos_[i]).is_null()) continue;
 
         Dictionary tile_data;
-        tile_data["address"] = info->get_address();
-        tile_data["zoom_level"] = info->get_zoom_level();
-        tile_data["group_name"] = info->get_group_name();
-        tile_data["lod"] = info->get_lod();
+        tile_data["address"] = get_tile_address(i);
+        tile_data["zoom_level"] = get_tile_zoom_level(i);
+        tile_data["group_name"] = get_tile_group_name(i);
+        tile_data["lod"] = get_tile_lod(i);
 
         Dictionary ext;
-        AABB extent = info->get_extent();
+        AABB extent = get_tile_extent(i);
         ext["x"] = extent.position.x;
         ext["y"] = extent.position.y;
         ext["z"] = extent.position.z;
@@ -375,6 +576,132 @@ Dictionary PLATEAUDynamicTileMetaStore::to_json() const {
     return result;
 }
 
+PackedByteArray PLATEAUDynamicTileMetaStore::to_binary() const {
+    int tile_count = get_tile_count();
+
+    // Deduplicated string table (group names repeat across tiles)
+    std::vector<CharString> strings;
+    HashMap<String, uint32_t> string_ids;
+    auto intern = [&](const String &str) -> uint32_t {
+        const uint32_t *id = string_ids.getptr(str);
+        if (id) {
+            return *id;
+        }
+        uint32_t new_id = static_cast<uint32_t>(strings.size());
+        strings.push_back(str.utf8());
+        string_ids[str] = new_id;
+        return new_id;
+    };
+
+    std::vector<uint8_t> records;
+    records.reserve(static_cast<size_t>(tile_count) * META_STORE_RECORD_SIZE);
+    for (int i = 0; i < tile_count; i++) {
+        AABB extent = get_tile_extent(i);
+        write_binary<uint32_t>(records, intern(get_tile_address(i)));
+        write_binary<uint32_t>(records, intern(get_tile_group_name(i)));
+        write_binary<int32_t>(records, get_tile_zoom_level(i));
+        write_binary<int32_t>(records, get_tile_lod(i));
+        write_binary<float>(records, extent.position.x);
+        write_binary<float>(records, extent.position.y);
+        write_binary<float>(records, extent.position.z);
+        write_binary<float>(records, extent.size.x);
+        write_binary<float>(records, extent.size.y);
+        write_binary<float>(records, extent.size.z);
+    }
+
+    std::vector<uint8_t> buffer;
+    buffer.reserve(META_STORE_HEADER_SIZE + records.size() + strings.size() * META_STORE_STRING_ENTRY_SIZE);
+    buffer.insert(buffer.end(), META_STORE_MAGIC, META_STORE_MAGIC + 4);
+    write_binary<uint32_t>(buffer, META_STORE_VERSION);
+    write_binary<uint32_t>(buffer, static_cast<uint32_t>(tile_count));
+    write_binary<uint32_t>(buffer, static_cast<uint32_t>(strings.size()));
+    write_binary<double>(buffer, reference_point_.x);
+    write_binary<double>(buffer, reference_point_.y);
+    write_binary<double>(buffer, reference_point_.z);
+    buffer.insert(buffer.end(), records.begin(), records.end());
+
+    uint32_t string_offset = 0;
+    for (const CharString &str : strings) {
+        write_binary<uint32_t>(buffer, string_offset);
+        write_binary<uint32_t>(buffer, static_cast<uint32_t>(str.length()));
+        string_offset += static_cast<uint32_t>(str.length());
+    }
+    for (const CharString &str : strings) {
+        buffer.insert(buffer.end(), str.get_data(), str.get_data() + str.length());
+    }
+
+    PackedByteArray result;
+    result.resize(buffer.size());
+    memcpy(result.ptrw(), buffer.data(), buffer.size());
+    return result;
+}
+
+Ref<PLATEAUDynamicTileMetaStore> PLATEAUDynamicTileMetaStore::from_binary(const PackedByteArray &data) {
+    ERR_FAIL_COND_V_MSG(data.size() < static_cast<int64_t>(META_STORE_HEADER_SIZE), Ref<PLATEAUDynamicTileMetaStore>(),
+        "PLATEAUDynamicTileMetaStore: binary data is too small.");
+
+    const uint8_t *ptr = data.ptr();
+    ERR_FAIL_COND_V_MSG(memcmp(ptr, META_STORE_MAGIC, 4) != 0, Ref<PLATEAUDynamicTileMetaStore>(),
+        "PLATEAUDynamicTileMetaStore: invalid binary magic.");
+    ERR_FAIL_COND_V_MSG(read_binary<uint32_t>(ptr + 4) != META_STORE_VERSION, Ref<PLATEAUDynamicTileMetaStore>(),
+        "PLATEAUDynamicTileMetaStore: unsupported binary version.");
+
+    uint64_t tile_count = read_binary<uint32_t>(ptr + 8);
+    uint64_t string_count = read_binary<uint32_t>(ptr + 12);
+    uint64_t blob_start = META_STORE_HEADER_SIZE + tile_count * META_STORE_RECORD_SIZE +
+                          string_count * META_STORE_STRING_ENTRY_SIZE;
+    ERR_FAIL_COND_V_MSG(blob_start > static_cast<uint64_t>(data.size()) || tile_count > INT32_MAX,
+        Ref<PLATEAUDynamicTileMetaStore>(), "PLATEAUDynamicTileMetaStore: binary data is truncated.");
+
+    // Validate the string table once so accessors can read without bounds checks
+    uint64_t blob_size = data.size() - blob_start;
+    const uint8_t *table = ptr + META_STORE_HEADER_SIZE + tile_count * META_STORE_RECORD_SIZE;
+    for (uint64_t i = 0; i < string_count; i++) {
+        uint64_t offset = read_binary<uint32_t>(table + i * META_STORE_STRING_ENTRY_SIZE);
+        uint64_t length = read_binary<uint32_t>(table + i * META_STORE_STRING_ENTRY_SIZE + 4);
+        ERR_FAIL_COND_V_MSG(offset + length > blob_size, Ref<PLATEAUDynamicTileMetaStore>(),
+            "PLATEAUDynamicTileMetaStore: binary string table is corrupt.");
+    }
+    for (uint64_t i = 0; i < tile_count; i++) {
+        const uint8_t *record = ptr + META_STORE_HEADER_SIZE + i * META_STORE_RECORD_SIZE;
+        ERR_FAIL_COND_V_MSG(read_binary<uint32_t>(record) >= string_count || read_binary<uint32_t>(record + 4) >= string_count,
+            Ref<PLATEAUDynamicTileMetaStore>(), "PLATEAUDynamicTileMetaStore: binary record references an invalid string.");
+    }
+
+    Ref<PLATEAUDynamicTileMetaStore> store;
+    store.instantiate();
+    store->reference_point_ = Vector3(read_binary<double>(ptr + 16), read_binary<double>(ptr + 24), read_binary<double>(ptr + 32));
+    store->binary_data_ = data;
+    store->binary_tile_count_ = static_cast<int>(tile_count);
+    store->binary_string_count_ = static_cast<int>(string_count);
+    return store;
+}
+
+bool PLATEAUDynamicTileMetaStore::save_binary(const String &path) const {
+    Ref<FileAccess> file = FileAccess::open(path, FileAccess::WRITE);
+    ERR_FAIL_COND_V_MSG(file.is_null(), false, "PLATEAUDynamicTileMetaStore: cannot open file for writing: " + path);
+    file->store_buffer(to_binary());
+    return true;
+}
+
+Ref<PLATEAUDynamicTileMetaStore> PLATEAUDynamicTileMetaStore::load_binary(const String &path) {
+    ERR_FAIL_COND_V_MSG(!FileAccess::file_exists(path), Ref<PLATEAUDynamicTileMetaStore>(),
+        "PLATEAUDynamicTileMetaStore: file not found: " + path);
+    return from_binary(FileAccess::get_file_as_bytes(path));
+}
+
+bool PLATEAUDynamicTileMetaStore::convert_json_to_binary(const String &json_path, const String &binary_path) {
+    ERR_FAIL_COND_V_MSG(!FileAccess::file_exists(json_path), false,
+        "PLATEAUDynamicTileMetaStore: file not found: " + json_path);
+
+    Variant json = JSON::parse_string(FileAccess::get_file_as_string(json_path));
+    ERR_FAIL_COND_V_MSG(json.get_type() != Variant::DICTIONARY, false,
+        "PLATEAUDynamicTileMetaStore: invalid JSON meta store: " + json_path);
+
+    Ref<PLATEAUDynamicTileMetaStore> store = from_json(json);
+    return store->save_binary(binary_path);
+}
+
 void PLATEAUDynamicTileMetaStore::_bind_methods() {
     ClassDB::bind_method(D_METHOD("set_tile_meta_infos", "infos"), &PLATEAUDynamicTileMetaStore::set_tile_meta_infos);
     ClassDB::bind_method(D_METHOD("get_tile_meta_infos"), &PLATEAUDynamicTileMetaStore::get_tile_meta_infos);
@@ -383,8 +710,19 @@ void PLATEAUDynamicTileMetaStore::_bind_methods() {
     ClassDB::bind_method(D_METHOD("add_tile_meta_info", "info"), &PLATEAUDynamicTileMetaStore::add_tile_meta_info);
     ClassDB::bind_method(D_METHOD("get_tile_count"), &PLATEAUDynamicTileMetaStore::get_tile_count);
     ClassDB::bind_method(D_METHOD("get_tile_meta_info", "index"), &PLATEAUDynamicTileMetaStore::get_tile_meta_info);
+    ClassDB::bind_method(D_METHOD("get_tile_address", "index"), &PLATEAUDynamicTileMetaStore::get_tile_address);
+    ClassDB::bind_method(D_METHOD("get_tile_extent", "index"), &PLATEAUDynamicTileMetaStore::get_tile_extent);
+    ClassDB::bind_method(D_METHOD("get_tile_zoom_level", "index"), &PLATEAUDynamicTileMetaStore::get_tile_zoom_level);
+    ClassDB::bind_method(D_METHOD("get_tile_group_name", "index"), &PLATEAUDynamicTileMetaStore::get_tile_group_name);
+    ClassDB::bind_method(D_METHOD("get_tile_lod", "index"), &PLATEAUDynamicTileMetaStore::get_tile_lod);
     ClassDB::bind_static_method("PLATEAUDynamicTileMetaStore", D_METHOD("from_json", "json"), &PLATEAUDynamicTileMetaStore::from_json);
     ClassDB::bind_method(D_METHOD("to_json"), &PLATEAUDynamicTileMetaStore::to_json);
+    ClassDB::bind_method(D_METHOD("to_binary"), &PLATEAUDynamicTileMetaStore::to_binary);
+    ClassDB::bind_static_method("PLATEAUDynamicTileMetaStore", D_METHOD("from_binary", "data"), &PLATEAUDynamicTileMetaStore::from_binary);
+    ClassDB::bind_method(D_METHOD("save_binary", "path"), &PLATEAUDynamicTileMetaStore::save_binary);
+    ClassDB::bind_static_method("PLATEAUDynamicTileMetaStore", D_METHOD("load_binary", "path"), &PLATEAUDynamicTileMetaStore::load_binary);
+    ClassDB::bind_static_method("PLATEAUDynamicTileMetaStore", D_METHOD("convert_json_to_binary", "json_path", "binary_path"), &PLATEAUDynamicTileMetaStore::convert_json_to_binary);
+    ClassDB::bind_method(D_METHOD("is_binary_backed"), &PLATEAUDynamicTileMetaStore::is_binary_backed);
 
     ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "tile_meta_infos", PROPERTY_HINT_ARRAY_TYPE, "PLATEAUDynamicTileMetaInfo"), "set_tile_meta_infos", "get_tile_meta_infos");
     ADD_PROPERTY(PropertyInfo(Variant::VECTOR3, "reference_point"), "set_reference_point", "get_reference_point");
@@ -399,8 +737,26 @@ PLATEAUDynamicTileManager::PLATEAUDynamicTileManager() :
     camera_(nullptr),
     auto_update_(true),
     ignore_y_(true),
+    threaded_update_(true),
+    update_distance_threshold_(10.0f),
+    update_angle_threshold_(5.0f),
     is_processing_(false),
-    tiles_per_frame_(1) {
+    tiles_per_frame_(1),
+    retention_cache_enabled_(false),
+    retention_cache_max_bytes_(256ll * 1024 * 1024),
+    retention_cache_max_tiles_(64),
+    retention_cache_bytes_(0),
+    retention_cache_hits_(0),
+    retention_cache_misses_(0),
+    retention_cache_evictions_(0),
+    loaded_bytes_(0),
+    statistics_frame_(0),
+    performance_monitors_enabled_(false),
+    lod_transition_enabled_(false),
+    lod_transition_duration_(0.3f),
+    max_lod_transitions_(8),
+    generation_(0),
+    update_task_id_(-1) {
 
     // Default load distances
     load_distances_[11] = Vector2(-10000.0f, 500.0f);
@@ -409,6 +765,15 @@ PLATEAUDynamicTileManager::PLATEAUDynamicTileManager() :
 }
 
 PLATEAUDynamicTileManager::~PLATEAUDynamicTileManager() {
+    // The update job reads only its own snapshot, but must finish before members go away
+    if (update_task_id_ >= 0) {
+        WorkerThreadPool::get_singleton()->wait_for_task_completion(update_task_id_);
+    }
+
+    unregister_performance_monitors();
+
+    // Retained instances are detached from the tree, so they must be freed here
+    clear_retention_cache();
 }
 
 void PLATEAUDynamicTileManager::_ready() {
@@ -416,28 +781,28 @@ void PLATEAUDynamicTileManager::_ready() {
 }
 
 void PLATEAUDynamicTileManager::_process(double delta) {
+    roll_frame_statistics();
+
     if (!auto_update_ || state_ != STATE_OPERATING) {
         return;
     }
 
-    // Get camera position
-    Vector3 camera_pos;
-    if (camera_) {
-        camera_pos = camera_->get_global_position();
-    } else {
-        // Try to find current camera
-        Viewport *viewport = get_viewport();
-        if (viewport) {
-            Camera3D *current_camera = viewport->get_camera_3d();
-            if (current_camera) {
-                camera_pos = current_camera->get_global_position();
+    Camera3D *camera = get_tracked_camera();
+    if (camera) {
+        // Rotation also triggers an update since it changes the load priority by frustum
+        Transform3D camera_transform = camera->get_global_transform();
+        if (check_camera_transform_changed(camera_transform, update_distance_threshold_, update_angle_threshold_)) {
+            if (request_update(camera_transform.origin, get_camera_frustum(camera))) {
+                last_camera_transform_ = camera_transform;
             }
         }
+    } else if (check_camera_position_changed(Vector3(), update_distance_threshold_)) {
+        update_by_camera_position(Vector3());
     }
 
-    // Check if camera moved significantly
-    if (check_camera_position_changed(camera_pos, 10.0f)) {
-        update_by_camera_position(camera_pos);
+    // Advance parent -> children swaps before new loads are started
+    if (lod_transition_enabled_) {
+        update_lod_transitions(delta);
     }
 
     // Process load/unload queues
@@ -448,6 +813,31 @@ PLATEAUDynamicTileManager::ManagerState PLATEAUDynamicTileManager::get_state() c
     return state_;
 }
 
+Camera3D *PLATEAUDynamicTileManager::get_tracked_camera() const {
+    if (camera_) {
+        return camera_;
+    }
+
+    // Try to find current camera
+    Viewport *viewport = get_viewport();
+    if (viewport) {
+        return viewport->get_camera_3d();
+    }
+    return nullptr;
+}
+
+std::vector<Plane> PLATEAUDynamicTileManager::get_camera_frustum(Camera3D *camera) {
+    std::vector<Plane> frustum;
+    if (camera) {
+        TypedArray<Plane> planes = camera->get_frustum();
+        frustum.reserve(planes.size());
+        for (int i = 0; i < planes.size(); i++) {
+            frustum.push_back(planes[i]);
+        }
+    }
+    return frustum;
+}
+
 void PLATEAUDynamicTileManager::set_camera(Camera3D *camera) {
     camera_ = camera;
 }
@@ -510,6 +900,30 @@ PackedStringArray PLATEAUDynamicTileManager::get_force_high_resolution_addresses
     return force_high_resolution_addresses_;
 }
 
+void PLATEAUDynamicTileManager::set_threaded_update(bool enable) {
+    threaded_update_ = enable;
+}
+
+bool PLATEAUDynamicTileManager::get_threaded_update() const {
+    return threaded_update_;
+}
+
+void PLATEAUDynamicTileManager::set_update_distance_threshold(float distance) {
+    update_distance_threshold_ = MAX(distance, 0.0f);
+}
+
+float PLATEAUDynamicTileManager::get_update_distance_threshold() const {
+    return update_distance_threshold_;
+}
+
+void PLATEAUDynamicTileManager::set_update_angle_threshold(float degrees) {
+    update_angle_threshold_ = MAX(degrees, 0.0f);
+}
+
+float PLATEAUDynamicTileManager::get_update_angle_threshold() const {
+    return update_angle_threshold_;
+}
+
 void PLATEAUDynamicTileManager::initialize(const Ref<PLATEAUDynamicTileMetaStore> &meta_store) {
     if (meta_store.is_null()) {
         UtilityFunctions::push_error("PLATEAUDynamicTileManager: meta_store is null");
@@ -517,56 +931,148 @@ void PLATEAUDynamicTileManager::initialize(const Ref<PLATEAUDynamicTileMetaStore
     }
 
     state_ = STATE_INITIALIZING;
+    generation_++;
     tiles_.clear();
     address_to_tile_.clear();
+    address_to_index_.clear();
+    lod_transitions_.clear();
+    clear_retention_cache();
+    loaded_bytes_ = 0;
 
     // Create tiles from meta info
     for (int i = 0; i < meta_store->get_tile_count(); i++) {
-        Ref<PLATEAUDynamicTileMetaInfo> info = meta_store->get_tile_meta_info(i);
-        if (info.is_null()) continue;
+        if (!meta_store->is_binary_backed() && meta_store->get_tile_meta_info(i).is_null()) continue;
 
+        String address = meta_store->get_tile_address(i);
         Ref<PLATEAUDynamicTile> tile;
         tile.instantiate();
-        tile->set_address(info->get_address());
-        tile->set_zoom_level(info->get_zoom_level());
-        tile->set_extent(info->get_extent());
-        tile->set_group_name(info->get_group_name());
+        tile->set_address(address);
+        tile->set_zoom_level(meta_store->get_tile_zoom_level(i));
+        tile->set_extent(meta_store->get_tile_extent(i));
+        tile->set_group_name(meta_store->get_tile_group_name(i));
 
+        address_to_index_[address] = tiles_.size();
         tiles_.append(tile);
-        address_to_tile_[info->get_address()] = tile;
+        address_to_tile_[address] = tile;
     }
 
     // Build hierarchy
     build_tile_hierarchy();
+    build_tile_topology();
 
     state_ = STATE_OPERATING;
     emit_signal("initialized");
 }
 
 void PLATEAUDynamicTileManager::update_by_camera_position(const Vector3 &position) {
-    if (state_ != STATE_OPERATING || is_processing_.load()) {
-        return;
+    request_update(position, get_camera_frustum(get_tracked_camera()));
+}
+
+bool PLATEAUDynamicTileManager::is_updating() const {
+    return is_processing_.load();
+}
+
+bool PLATEAUDynamicTileManager::request_update(const Vector3 &position, const std::vector<Plane> &frustum) {
+    roll_frame_statistics();
+
+    if (state_ != STATE_OPERATING || is_processing_.load() || !topology_) {
+        return false;
     }
 
     is_processing_.store(true);
     last_camera_position_ = position;
 
-    // Calculate distances
-    calculate_distances(position);
+    // Snapshot everything the job reads, so the worker never touches Godot objects
+    UpdateJob job;
+    job.topology = topology_;
+    job.camera_position = position;
+    job.ignore_y = ignore_y_;
+    job.lod_transitions = lod_transition_enabled_;
+    job.frustum = frustum;
+    job.generation = generation_;
+
+    job.load_states.resize(tiles_.size());
+    for (int i = 0; i < tiles_.size(); i++) {
+        Ref<PLATEAUDynamicTile> tile = tiles_[i];
+        job.load_states[i] = static_cast<uint8_t>(tile.is_valid() ? tile->get_load_state() : PLATEAUDynamicTile::LOAD_STATE_NONE);
+    }
+
+    Array zoom_levels = load_distances_.keys();
+    for (int i = 0; i < zoom_levels.size(); i++) {
+        int zoom_level = zoom_levels[i];
+        job.load_distances[zoom_level] = load_distances_[zoom_levels[i]];
+    }
+
+    for (int i = 0; i < force_high_resolution_addresses_.size(); i++) {
+        const int *index = address_to_index_.getptr(force_high_resolution_addresses_[i]);
+        if (index) {
+            job.force_high_resolution.push_back(*index);
+        }
+    }
+
+    if (!threaded_update_) {
+        {
+            std::lock_guard<std::mutex> lock(update_mutex_);
+            compute_update(job, job_result_);
+        }
+        apply_update_result();
+        return true;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(update_mutex_);
+        pending_job_ = std::move(job);
+    }
+
+    update_task_id_ = WorkerThreadPool::get_singleton()->add_task(
+        callable_mp(this, &PLATEAUDynamicTileManager::_update_thread_func)
+    );
+    return true;
+}
+
+void PLATEAUDynamicTileManager::_update_thread_func() {
+    {
+        std::lock_guard<std::mutex> lock(update_mutex_);
+        compute_update(pending_job_, job_result_);
+        pending_job_ = UpdateJob();
+    }
+
+    // Apply on main thread (tiles and scene tree are not thread-safe)
+    callable_mp(this, &PLATEAUDynamicTileManager::apply_update_result).call_deferred();
+}
 
-    // Determine load states
-    determine_load_states();
+void PLATEAUDynamicTileManager::apply_update_result() {
+    roll_frame_statistics();
 
-    // Fill holes
-    fill_tile_holes();
+    if (update_task_id_ >= 0) {
+        // Already finished; releases the task slot
+        WorkerThreadPool::get_singleton()->wait_for_task_completion(update_task_id_);
+        update_task_id_ = -1;
+    }
 
-    // Apply force high resolution
-    if (force_high_resolution_addresses_.size() > 0) {
-        apply_force_high_resolution();
+    UpdateResult result;
+    {
+        std::lock_guard<std::mutex> lock(update_mutex_);
+        result = std::move(job_result_);
+        job_result_ = UpdateResult();
     }
 
-    // Execute load/unload
-    execute_load_unload();
+    uint64_t apply_start = get_time_usec();
+
+    // Discard results computed for a tile set that has since been replaced
+    if (state_ == STATE_OPERATING && result.generation == generation_ &&
+        result.distances.size() == static_cast<size_t>(tiles_.size())) {
+        for (int i = 0; i < tiles_.size(); i++) {
+            Ref<PLATEAUDynamicTile> tile = tiles_[i];
+            if (tile.is_null()) continue;
+            tile->set_distance(result.distances[i]);
+            tile->set_next_load_state(static_cast<PLATEAUDynamicTile::LoadState>(result.next_states[i]));
+        }
+        execute_load_unload(result);
+
+        last_update_timings_ = result.timings;
+        last_update_timings_.apply_usec = get_time_usec() - apply_start;
+    }
 
     is_processing_.store(false);
 }
@@ -587,6 +1093,7 @@ void PLATEAUDynamicTileManager::cancel_load() {
     while (!load_queue_.empty()) {
         load_queue_.pop();
     }
+    load_enqueue_usec_.clear();
 }
 
 TypedArray<PLATEAUDynamicTile> PLATEAUDynamicTileManager::get_tiles() const {
@@ -625,12 +1132,24 @@ bool PLATEAUDynamicTileManager::check_camera_position_changed(const Vector3 &pos
     }
 }
 
+bool PLATEAUDynamicTileManager::check_camera_transform_changed(const Transform3D &transform, float distance_threshold, float angle_threshold_degrees) const {
+    if (check_camera_position_changed(transform.origin, distance_threshold)) {
+        return true;
+    }
+
+    Vector3 last_forward = -last_camera_transform_.basis.get_column(2);
+    Vector3 new_forward = -transform.basis.get_column(2);
+    return Math::rad_to_deg(last_forward.angle_to(new_forward)) > angle_threshold_degrees;
+}
+
 Vector3 PLATEAUDynamicTileManager::get_last_camera_position() const {
     return last_camera_position_;
 }
 
 void PLATEAUDynamicTileManager::cleanup() {
     state_ = STATE_CLEANING_UP;
+    generation_++;
+    lod_transitions_.clear();
 
     for (int i = 0; i < tiles_.size(); i++) {
         Ref<PLATEAUDynamicTile> tile = tiles_[i];
@@ -641,9 +1160,497 @@ void PLATEAUDynamicTileManager::cleanup() {
 
     tiles_.clear();
     address_to_tile_.clear();
+    address_to_index_.clear();
+    topology_.reset();
+    clear_retention_cache();
+    loaded_bytes_ = 0;
     state_ = STATE_NONE;
 }
 
+void PLATEAUDynamicTileManager::set_retention_cache_enabled(bool enable) {
+    retention_cache_enabled_ = enable;
+    if (!retention_cache_enabled_) {
+        clear_retention_cache();
+    }
+}
+
+bool PLATEAUDynamicTileManager::get_retention_cache_enabled() const {
+    return retention_cache_enabled_;
+}
+
+void PLATEAUDynamicTileManager::set_retention_cache_max_bytes(int64_t bytes) {
+    retention_cache_max_bytes_ = MAX(bytes, (int64_t)0);
+    evict_retention_cache();
+}
+
+int64_t PLATEAUDynamicTileManager::get_retention_cache_max_bytes() const {
+    return retention_cache_max_bytes_;
+}
+
+void PLATEAUDynamicTileManager::set_retention_cache_max_tiles(int count) {
+    retention_cache_max_tiles_ = MAX(count, 0);
+    evict_retention_cache();
+}
+
+int PLATEAUDynamicTileManager::get_retention_cache_max_tiles() const {
+    return retention_cache_max_tiles_;
+}
+
+void PLATEAUDynamicTileManager::clear_retention_cache() {
+    for (const RetainedTile &entry : retention_lru_) {
+        if (entry.instance) {
+            memdelete(entry.instance);
+        }
+    }
+    retention_lru_.clear();
+    retention_index_.clear();
+    retention_cache_bytes_ = 0;
+}
+
+int PLATEAUDynamicTileManager::get_retention_cache_count() const {
+    return static_cast<int>(retention_lru_.size());
+}
+
+int64_t PLATEAUDynamicTileManager::get_retention_cache_bytes() const {
+    return retention_cache_bytes_;
+}
+
+int64_t PLATEAUDynamicTileManager::get_retention_cache_hits() const {
+    return retention_cache_hits_;
+}
+
+int64_t PLATEAUDynamicTileManager::get_retention_cache_misses() const {
+    return retention_cache_misses_;
+}
+
+int64_t PLATEAUDynamicTileManager::get_retention_cache_evictions() const {
+    return retention_cache_evictions_;
+}
+
+int64_t PLATEAUDynamicTileManager::get_resident_bytes() const {
+    return loaded_bytes_ + retention_cache_bytes_;
+}
+
+uint64_t PLATEAUDynamicTileManager::get_time_usec() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void PLATEAUDynamicTileManager::roll_frame_statistics() {
+    // Rolled over from every update entry point, so counters stay per-frame when auto_update is off
+    uint64_t frame = Engine::get_singleton()->get_process_frames();
+    if (frame != statistics_frame_) {
+        statistics_frame_ = frame;
+        last_frame_ = current_frame_;
+        current_frame_ = FrameStatistics();
+    }
+}
+
+void PLATEAUDynamicTileManager::record_queue_latency(uint64_t enqueue_usec) {
+    queue_latency_samples_.push_back(get_time_usec() - enqueue_usec);
+    if (queue_latency_samples_.size() > QUEUE_LATENCY_SAMPLE_COUNT) {
+        queue_latency_samples_.pop_front();
+    }
+}
+
+double PLATEAUDynamicTileManager::get_queue_latency_percentile(double percentile) const {
+    if (queue_latency_samples_.empty()) {
+        return 0.0;
+    }
+
+    std::vector<uint64_t> samples(queue_latency_samples_.begin(), queue_latency_samples_.end());
+    size_t rank = static_cast<size_t>(percentile * (samples.size() - 1) + 0.5);
+    std::nth_element(samples.begin(), samples.begin() + rank, samples.end());
+    return samples[rank] / 1000.0;
+}
+
+Dictionary PLATEAUDynamicTileManager::get_statistics() const {
+    Dictionary stats;
+    for (const char *key : STATISTIC_KEYS) {
+        stats[key] = get_statistic(key);
+    }
+    return stats;
+}
+
+Variant PLATEAUDynamicTileManager::get_statistic(const String &key) const {
+    // Computed per key: performance monitors query one value each, every frame
+    const UpdateTimings &t = last_update_timings_;
+
+    // Last frame
+    if (key == "frame_tiles_queued") return last_frame_.tiles_queued;
+    if (key == "frame_tiles_loaded") return last_frame_.tiles_loaded;
+    if (key == "frame_tiles_unloaded") return last_frame_.tiles_unloaded;
+    if (key == "frame_resource_load_msec") return last_frame_.resource_load_usec / 1000.0;
+    if (key == "frame_instantiate_msec") return last_frame_.instantiate_usec / 1000.0;
+
+    // Last tile selection (update_by_camera_position)
+    if (key == "update_distances_msec") return t.distances_usec / 1000.0;
+    if (key == "update_load_states_msec") return t.load_states_usec / 1000.0;
+    if (key == "update_hole_filling_msec") return t.hole_filling_usec / 1000.0;
+    if (key == "update_force_high_resolution_msec") return t.force_high_resolution_usec / 1000.0;
+    if (key == "update_sort_msec") return t.sort_usec / 1000.0;
+    if (key == "update_apply_msec") return t.apply_usec / 1000.0;
+    if (key == "update_total_msec") {
+        return (t.distances_usec + t.load_states_usec + t.hole_filling_usec +
+                t.force_high_resolution_usec + t.sort_usec + t.apply_usec) / 1000.0;
+    }
+
+    // Residency
+    if (key == "resident_tiles") {
+        int resident_tiles = 0;
+        for (int i = 0; i < tiles_.size(); i++) {
+            Ref<PLATEAUDynamicTile> tile = tiles_[i];
+            if (tile.is_valid() && tile->get_load_state() == PLATEAUDynamicTile::LOAD_STATE_LOADED) {
+                resident_tiles++;
+            }
+        }
+        return resident_tiles;
+    }
+    if (key == "resident_bytes") return get_resident_bytes();
+    if (key == "retained_tiles") return get_retention_cache_count();
+
+    // Queues
+    if (key == "load_queue_size") return static_cast<int64_t>(load_queue_.size());
+    if (key == "unload_queue_size") return static_cast<int64_t>(unload_queue_.size());
+    if (key == "queue_latency_p50_msec") return get_queue_latency_percentile(0.5);
+    if (key == "queue_latency_p90_msec") return get_queue_latency_percentile(0.9);
+    if (key == "queue_latency_p99_msec") return get_queue_latency_percentile(0.99);
+
+    return Variant();
+}
+
+void PLATEAUDynamicTileManager::set_performance_monitors_enabled(bool enable) {
+    if (enable == performance_monitors_enabled_) {
+        return;
+    }
+    performance_monitors_enabled_ = enable;
+    if (enable) {
+        register_performance_monitors();
+    } else {
+        unregister_performance_monitors();
+    }
+}
+
+bool PLATEAUDynamicTileManager::get_performance_monitors_enabled() const {
+    return performance_monitors_enabled_;
+}
+
+void PLATEAUDynamicTileManager::set_lod_transition_enabled(bool enable) {
+    lod_transition_enabled_ = enable;
+    if (!lod_transition_enabled_) {
+        clear_lod_transitions();
+    }
+}
+
+bool PLATEAUDynamicTileManager::get_lod_transition_enabled() const {
+    return lod_transition_enabled_;
+}
+
+void PLATEAUDynamicTileManager::set_lod_transition_duration(float seconds) {
+    lod_transition_duration_ = MAX(seconds, 0.0f);
+}
+
+float PLATEAUDynamicTileManager::get_lod_transition_duration() const {
+    return lod_transition_duration_;
+}
+
+void PLATEAUDynamicTileManager::set_max_lod_transitions(int count) {
+    max_lod_transitions_ = MAX(count, 0);
+}
+
+int PLATEAUDynamicTileManager::get_max_lod_transitions() const {
+    return max_lod_transitions_;
+}
+
+int PLATEAUDynamicTileManager::get_lod_transition_count() const {
+    return static_cast<int>(lod_transitions_.size());
+}
+
+bool PLATEAUDynamicTileManager::begin_lod_transition(const Ref<PLATEAUDynamicTile> &tile) {
+    // Only tiles replaced by higher-detail descendants need a transition
+    bool pending = has_pending_descendants(tile);
+    std::vector<Node3D *> descendants;
+    collect_loaded_descendants(tile, descendants);
+    if (!pending && descendants.empty()) {
+        return false;
+    }
+
+    // The cap bounds double residency; beyond it the parent is unloaded immediately
+    if (static_cast<int>(lod_transitions_.size()) >= max_lod_transitions_) {
+        return false;
+    }
+
+    // If every descendant is already visible, skip straight to fading the parent out
+    float elapsed = pending ? 0.0f : lod_transition_duration_ * 0.5f;
+    lod_transitions_.push_back({tile, !pending, elapsed});
+    return true;
+}
+
+void PLATEAUDynamicTileManager::update_lod_transitions(double delta) {
+    std::vector<Ref<PLATEAUDynamicTile>> finished;
+
+    for (size_t i = 0; i < lod_transitions_.size();) {
+        LodTransition &transition = lod_transitions_[i];
+        Ref<PLATEAUDynamicTile> tile = transition.tile;
+
+        std::vector<Node3D *> descendants;
+        collect_loaded_descendants(tile, descendants);
+
+        // Cancelled: the parent was unloaded elsewhere or is wanted again
+        if (tile->get_load_state() != PLATEAUDynamicTile::LOAD_STATE_LOADED ||
+            tile->next_load_state_ == PLATEAUDynamicTile::LOAD_STATE_LOADED) {
+            if (tile->get_loaded_instance()) {
+                set_instance_transparency(tile->get_loaded_instance(), 0.0f);
+            }
+            for (Node3D *instance : descendants) {
+                instance->set_visible(true);
+                set_instance_transparency(instance, 0.0f);
+            }
+            lod_transitions_.erase(lod_transitions_.begin() + i);
+            continue;
+        }
+
+        if (!transition.fading) {
+            if (has_pending_descendants(tile)) {
+                i++;
+                continue;
+            }
+            // All descendants have loaded: start the fade
+            transition.fading = true;
+            transition.elapsed = 0.0f;
+            for (Node3D *instance : descendants) {
+                set_instance_transparency(instance, 1.0f);
+                instance->set_visible(true);
+            }
+        }
+
+        // First half fades descendants in over the opaque parent, second half fades the parent out
+        transition.elapsed += static_cast<float>(delta);
+        float t = lod_transition_duration_ > 0.0f ? CLAMP(transition.elapsed / lod_transition_duration_, 0.0f, 1.0f) : 1.0f;
+        float children_transparency = CLAMP(1.0f - t * 2.0f, 0.0f, 1.0f);
+        float parent_transparency = CLAMP(t * 2.0f - 1.0f, 0.0f, 1.0f);
+        for (Node3D *instance : descendants) {
+            set_instance_transparency(instance, children_transparency);
+        }
+        set_instance_transparency(tile->get_loaded_instance(), parent_transparency);
+
+        if (t >= 1.0f) {
+            finished.push_back(tile);
+            lod_transitions_.erase(lod_transitions_.begin() + i);
+            continue;
+        }
+        i++;
+    }
+
+    for (const Ref<PLATEAUDynamicTile> &tile : finished) {
+        unload_tile(tile);
+    }
+}
+
+void PLATEAUDynamicTileManager::clear_lod_transitions() {
+    for (const LodTransition &transition : lod_transitions_) {
+        std::vector<Node3D *> instances;
+        collect_loaded_descendants(transition.tile, instances);
+        if (transition.tile->get_loaded_instance()) {
+            instances.push_back(transition.tile->get_loaded_instance());
+        }
+        for (Node3D *instance : instances) {
+            instance->set_visible(true);
+            set_instance_transparency(instance, 0.0f);
+        }
+    }
+    lod_transitions_.clear();
+}
+
+bool PLATEAUDynamicTileManager::is_in_lod_transition(const Ref<PLATEAUDynamicTile> &tile) const {
+    for (const LodTransition &transition : lod_transitions_) {
+        if (transition.tile == tile) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool PLATEAUDynamicTileManager::has_waiting_lod_transition_ancestor(const Ref<PLATEAUDynamicTile> &tile) const {
+    Ref<PLATEAUDynamicTile> ancestor = tile->get_parent_tile();
+    while (ancestor.is_valid()) {
+        for (const LodTransition &transition : lod_transitions_) {
+            if (transition.tile == ancestor && !transition.fading) {
+                return true;
+            }
+        }
+        ancestor = ancestor->get_parent_tile();
+    }
+    return false;
+}
+
+bool PLATEAUDynamicTileManager::has_pending_descendants(const Ref<PLATEAUDynamicTile> &tile) {
+    for (int i = 0; i < tile->child_tiles_.size(); i++) {
+        Ref<PLATEAUDynamicTile> child = tile->child_tiles_[i];
+        if (child.is_null()) continue;
+
+        PLATEAUDynamicTile::LoadState state = child->get_load_state();
+        if (child->next_load_state_ == PLATEAUDynamicTile::LOAD_STATE_LOADED &&
+            state != PLATEAUDynamicTile::LOAD_STATE_LOADED &&
+            state != PLATEAUDynamicTile::LOAD_STATE_ERROR) {
+            return true;
+        }
+        if (has_pending_descendants(child)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PLATEAUDynamicTileManager::collect_loaded_descendants(const Ref<PLATEAUDynamicTile> &tile, std::vector<Node3D *> &out_instances) {
+    for (int i = 0; i < tile->child_tiles_.size(); i++) {
+        Ref<PLATEAUDynamicTile> child = tile->child_tiles_[i];
+        if (child.is_null()) continue;
+
+        if (child->get_load_state() == PLATEAUDynamicTile::LOAD_STATE_LOADED && child->get_loaded_instance()) {
+            out_instances.push_back(child->get_loaded_instance());
+        }
+        collect_loaded_descendants(child, out_instances);
+    }
+}
+
+void PLATEAUDynamicTileManager::set_instance_transparency(Node *node, float transparency) {
+    if (node == nullptr) {
+        return;
+    }
+
+    GeometryInstance3D *geometry = Object::cast_to<GeometryInstance3D>(node);
+    if (geometry) {
+        geometry->set_transparency(transparency);
+    }
+    for (int i = 0; i < node->get_child_count(); i++) {
+        set_instance_transparency(node->get_child(i), transparency);
+    }
+}
+
+void PLATEAUDynamicTileManager::register_performance_monitors() {
+    Performance *performance = Performance::get_singleton();
+    if (!performance) {
+        return;
+    }
+
+    // Instance ID keeps monitor names unique when several managers exist
+    String prefix = "PLATEAUDynamicTileManager_" + String::num_uint64(get_instance_id()) + "/";
+    for (const char *key : PERFORMANCE_MONITOR_KEYS) {
+        String id = prefix + key;
+        if (performance->has_custom_monitor(id)) continue;
+
+        Array arguments;
+        arguments.push_back(String(key));
+        performance->add_custom_monitor(id, callable_mp(this, &PLATEAUDynamicTileManager::get_statistic), arguments);
+        registered_monitors_.push_back(id);
+    }
+}
+
+void PLATEAUDynamicTileManager::unregister_performance_monitors() {
+    Performance *performance = Performance::get_singleton();
+    if (performance) {
+        for (int i = 0; i < registered_monitors_.size(); i++) {
+            if (performance->has_custom_monitor(registered_monitors_[i])) {
+                performance->remove_custom_monitor(registered_monitors_[i]);
+            }
+        }
+    }
+    registered_monitors_.clear();
+}
+
+bool PLATEAUDynamicTileManager::retain_tile(const Ref<PLATEAUDynamicTile> &tile, Node3D *instance) {
+    if (!retention_cache_enabled_ || state_ != STATE_OPERATING || instance == nullptr) {
+        return false;
+    }
+
+    // Replace a stale entry for the same address (should not normally happen)
+    Node3D *stale = take_retained_tile(tile->get_address());
+    if (stale) {
+        memdelete(stale);
+    }
+
+    if (instance->get_parent() == this) {
+        remove_child(instance);
+    }
+
+    retention_lru_.push_front({tile->get_address(), instance, tile->get_estimated_bytes()});
+    retention_index_[tile->get_address()] = retention_lru_.begin();
+    retention_cache_bytes_ += tile->get_estimated_bytes();
+
+    evict_retention_cache();
+    return true;
+}
+
+Node3D *PLATEAUDynamicTileManager::take_retained_tile(const String &address) {
+    std::list<RetainedTile>::iterator *entry = retention_index_.getptr(address);
+    if (entry == nullptr) {
+        return nullptr;
+    }
+
+    std::list<RetainedTile>::iterator it = *entry;
+    Node3D *instance = it->instance;
+    retention_cache_bytes_ -= it->bytes;
+    retention_index_.erase(address);
+    retention_lru_.erase(it);
+    return instance;
+}
+
+void PLATEAUDynamicTileManager::evict_retention_cache() {
+    // A limit of 0 means "no limit" for that budget
+    while (!retention_lru_.empty()) {
+        bool over_count = retention_cache_max_tiles_ > 0 &&
+                          static_cast<int>(retention_lru_.size()) > retention_cache_max_tiles_;
+        bool over_bytes = retention_cache_max_bytes_ > 0 &&
+                          retention_cache_bytes_ > retention_cache_max_bytes_;
+        if (!over_count && !over_bytes) {
+            break;
+        }
+
+        RetainedTile &oldest = retention_lru_.back();
+        retention_cache_bytes_ -= oldest.bytes;
+        retention_index_.erase(oldest.address);
+        if (oldest.instance) {
+            memdelete(oldest.instance);
+        }
+        retention_lru_.pop_back();
+        retention_cache_evictions_++;
+    }
+}
+
+int64_t PLATEAUDynamicTileManager::estimate_instance_bytes(Node *node) {
+    if (node == nullptr) {
+        return 0;
+    }
+
+    int64_t bytes = 0;
+
+    MeshInstance3D *mesh_instance = Object::cast_to<MeshInstance3D>(node);
+    if (mesh_instance) {
+        Ref<ArrayMesh> mesh = mesh_instance->get_mesh();
+        if (mesh.is_valid()) {
+            for (int s = 0; s < mesh->get_surface_count(); s++) {
+                int64_t format = mesh->surface_get_format(s);
+                int64_t stride = 0;
+                if (format & Mesh::ARRAY_FORMAT_VERTEX) stride += sizeof(float) * 3;
+                if (format & Mesh::ARRAY_FORMAT_NORMAL) stride += sizeof(float) * 3;
+                if (format & Mesh::ARRAY_FORMAT_TANGENT) stride += sizeof(float) * 4;
+                if (format & Mesh::ARRAY_FORMAT_COLOR) stride += sizeof(float) * 4;
+                if (format & Mesh::ARRAY_FORMAT_TEX_UV) stride += sizeof(float) * 2;
+                if (format & Mesh::ARRAY_FORMAT_TEX_UV2) stride += sizeof(float) * 2;
+                bytes += stride * mesh->surface_get_array_len(s);
+                bytes += sizeof(int32_t) * mesh->surface_get_array_index_len(s);
+            }
+        }
+    }
+
+    for (int i = 0; i < node->get_child_count(); i++) {
+        bytes += estimate_instance_bytes(node->get_child(i));
+    }
+
+    return bytes;
+}
+
 void PLATEAUDynamicTileManager::build_tile_hierarchy() {
     // Group tiles by zoom level
     TypedArray<PLATEAUDynamicTile> z11 = get_tiles_by_zoom_level(11);
@@ -690,94 +1697,204 @@ void PLATEAUDynamicTileManager::build_tile_hierarchy() {
     }
 }
 
-void PLATEAUDynamicTileManager::calculate_distances(const Vector3 &camera_pos) {
+void PLATEAUDynamicTileManager::build_tile_topology() {
+    std::shared_ptr<TileTopology> topology = std::make_shared<TileTopology>(tiles_.size());
+
     for (int i = 0; i < tiles_.size(); i++) {
         Ref<PLATEAUDynamicTile> tile = tiles_[i];
-        if (tile.is_valid()) {
-            float distance = tile->calculate_distance(camera_pos, ignore_y_);
-            tile->set_distance(distance);
+        TileNode &node = (*topology)[i];
+        node.zoom_level = 0;
+        node.parent = -1;
+        if (tile.is_null()) continue;
+
+        node.extent = tile->get_extent();
+        node.zoom_level = tile->get_zoom_level();
+
+        Ref<PLATEAUDynamicTile> parent = tile->get_parent_tile();
+        if (parent.is_valid()) {
+            const int *parent_index = address_to_index_.getptr(parent->get_address());
+            if (parent_index) {
+                node.parent = *parent_index;
+            }
+        }
+
+        TypedArray<PLATEAUDynamicTile> children = tile->get_child_tiles();
+        node.children.reserve(children.size());
+        for (int j = 0; j < children.size(); j++) {
+            Ref<PLATEAUDynamicTile> child = children[j];
+            if (child.is_null()) continue;
+            const int *child_index = address_to_index_.getptr(child->get_address());
+            if (child_index) {
+                node.children.push_back(*child_index);
+            }
         }
     }
+
+    topology_ = topology;
 }
 
-void PLATEAUDynamicTileManager::determine_load_states() {
-    for (int i = 0; i < tiles_.size(); i++) {
-        Ref<PLATEAUDynamicTile> tile = tiles_[i];
-        if (tile.is_null()) continue;
+void PLATEAUDynamicTileManager::compute_update(const UpdateJob &job, UpdateResult &result) {
+    result = UpdateResult();
+    result.generation = job.generation;
 
-        float distance = tile->get_distance_from_camera();
-        bool in_range = tile->is_within_range(distance, load_distances_);
+    uint64_t t0 = get_time_usec();
+    calculate_distances(job, result);
+    uint64_t t1 = get_time_usec();
+    determine_load_states(job, result);
+    uint64_t t2 = get_time_usec();
+    if (!job.lod_transitions) {
+        // With LOD transitions, holes are covered on the main thread instead
+        // (parents are kept only until their children have loaded)
+        fill_tile_holes(job, result);
+    }
+    uint64_t t3 = get_time_usec();
+    if (!job.force_high_resolution.empty()) {
+        apply_force_high_resolution(job, result);
+    }
+    uint64_t t4 = get_time_usec();
+    sort_load_order(job, result);
+    uint64_t t5 = get_time_usec();
+
+    result.timings.distances_usec = t1 - t0;
+    result.timings.load_states_usec = t2 - t1;
+    result.timings.hole_filling_usec = t3 - t2;
+    result.timings.force_high_resolution_usec = t4 - t3;
+    result.timings.sort_usec = t5 - t4;
+}
+
+void PLATEAUDynamicTileManager::calculate_distances(const UpdateJob &job, UpdateResult &result) {
+    const TileTopology &topology = *job.topology;
+    result.distances.resize(topology.size());
+    for (size_t i = 0; i < topology.size(); i++) {
+        result.distances[i] = PLATEAUDynamicTile::calculate_distance_to_extent(
+            topology[i].extent, job.camera_position, job.ignore_y);
+    }
+}
 
-        if (in_range) {
-            tile->set_next_load_state(PLATEAUDynamicTile::LOAD_STATE_LOADED);
-        } else {
-            tile->set_next_load_state(PLATEAUDynamicTile::LOAD_STATE_UNLOADED);
+void PLATEAUDynamicTileManager::determine_load_states(const UpdateJob &job, UpdateResult &result) {
+    const TileTopology &topology = *job.topology;
+    result.next_states.resize(topology.size());
+    for (size_t i = 0; i < topology.size(); i++) {
+        bool in_range = false;
+        auto range = job.load_distances.find(topology[i].zoom_level);
+        if (range != job.load_distances.end()) {
+            float distance = result.distances[i];
+            in_range = distance >= range->second.x && distance < range->second.y;
         }
+
+        result.next_states[i] = in_range ? PLATEAUDynamicTile::LOAD_STATE_LOADED
+                                         : PLATEAUDynamicTile::LOAD_STATE_UNLOADED;
     }
 }
 
-void PLATEAUDynamicTileManager::fill_tile_holes() {
+void PLATEAUDynamicTileManager::fill_tile_holes(const UpdateJob &job, UpdateResult &result) {
+    const TileTopology &topology = *job.topology;
+
     // For each tile marked as unload, check if we need to fill holes
-    for (int i = 0; i < tiles_.size(); i++) {
-        Ref<PLATEAUDynamicTile> tile = tiles_[i];
-        if (tile.is_null()) continue;
+    for (size_t i = 0; i < topology.size(); i++) {
+        if (result.next_states[i] != PLATEAUDynamicTile::LOAD_STATE_UNLOADED) continue;
+
+        // If parent is unloaded and has any children that are loaded,
+        // keep it until the children that should be loaded appear
+        bool any_child_loaded = false;
+        for (int child : topology[i].children) {
+            if (job.load_states[child] == PLATEAUDynamicTile::LOAD_STATE_LOADED) {
+                any_child_loaded = true;
+                break;
+            }
+        }
+        if (!any_child_loaded) continue;
 
-        if (tile->next_load_state_ == PLATEAUDynamicTile::LOAD_STATE_UNLOADED) {
-            // If parent is unloaded and has any children that should be loaded,
-            // load all children to avoid holes
-            if (tile->has_any_children_loaded() ||
-                tile->next_load_state_ == PLATEAUDynamicTile::LOAD_STATE_LOADED) {
-
-                TypedArray<PLATEAUDynamicTile> children = tile->get_child_tiles();
-                for (int j = 0; j < children.size(); j++) {
-                    Ref<PLATEAUDynamicTile> child = children[j];
-                    if (child.is_valid() &&
-                        child->next_load_state_ == PLATEAUDynamicTile::LOAD_STATE_LOADED) {
-                        // Mark parent as needed to prevent holes
-                        tile->set_next_load_state(PLATEAUDynamicTile::LOAD_STATE_LOADED);
-                        break;
-                    }
-                }
+        for (int child : topology[i].children) {
+            if (result.next_states[child] == PLATEAUDynamicTile::LOAD_STATE_LOADED) {
+                // Mark parent as needed to prevent holes
+                result.next_states[i] = PLATEAUDynamicTile::LOAD_STATE_LOADED;
+                break;
             }
         }
     }
 }
 
-void PLATEAUDynamicTileManager::apply_force_high_resolution() {
-    for (int i = 0; i < force_high_resolution_addresses_.size(); i++) {
-        if (address_to_tile_.has(force_high_resolution_addresses_[i])) {
-            Ref<PLATEAUDynamicTile> tile = address_to_tile_[force_high_resolution_addresses_[i]];
-            if (tile.is_valid()) {
-                tile->set_next_load_state(PLATEAUDynamicTile::LOAD_STATE_LOADED);
-
-                // Unload parent tiles
-                Ref<PLATEAUDynamicTile> parent = tile->get_parent_tile();
-                while (parent.is_valid()) {
-                    parent->set_next_load_state(PLATEAUDynamicTile::LOAD_STATE_UNLOADED);
-                    parent = parent->get_parent_tile();
-                }
-            }
+void PLATEAUDynamicTileManager::apply_force_high_resolution(const UpdateJob &job, UpdateResult &result) {
+    const TileTopology &topology = *job.topology;
+
+    for (int index : job.force_high_resolution) {
+        result.next_states[index] = PLATEAUDynamicTile::LOAD_STATE_LOADED;
+
+        // Unload parent tiles
+        int parent = topology[index].parent;
+        while (parent >= 0) {
+            result.next_states[parent] = PLATEAUDynamicTile::LOAD_STATE_UNLOADED;
+            parent = topology[parent].parent;
         }
     }
 }
 
-void PLATEAUDynamicTileManager::execute_load_unload() {
-    // Sort by distance (closer tiles first for loading)
-    std::vector<std::pair<float, Ref<PLATEAUDynamicTile>>> sorted_tiles;
-    for (int i = 0; i < tiles_.size(); i++) {
-        Ref<PLATEAUDynamicTile> tile = tiles_[i];
-        if (tile.is_valid()) {
-            sorted_tiles.push_back({tile->get_distance_from_camera(), tile});
+void PLATEAUDynamicTileManager::sort_load_order(const UpdateJob &job, UpdateResult &result) {
+    const TileTopology &topology = *job.topology;
+
+    // A tile is outside the frustum if its AABB lies entirely above any (outward-facing) plane
+    std::vector<uint8_t> in_frustum(topology.size(), 1);
+    if (!job.frustum.empty()) {
+        for (size_t i = 0; i < topology.size(); i++) {
+            const AABB &extent = topology[i].extent;
+            for (const Plane &plane : job.frustum) {
+                Vector3 nearest(
+                    plane.normal.x > 0 ? extent.position.x : extent.position.x + extent.size.x,
+                    plane.normal.y > 0 ? extent.position.y : extent.position.y + extent.size.y,
+                    plane.normal.z > 0 ? extent.position.z : extent.position.z + extent.size.z);
+                if (plane.is_point_over(nearest)) {
+                    in_frustum[i] = 0;
+                    break;
+                }
+            }
         }
     }
 
-    std::sort(sorted_tiles.begin(), sorted_tiles.end(),
-        [](const auto &a, const auto &b) { return a.first < b.first; });
+    // Visible tiles first, then closer tiles first
+    result.order.resize(topology.size());
+    for (size_t i = 0; i < topology.size(); i++) {
+        result.order[i] = static_cast<int>(i);
+    }
+    std::sort(result.order.begin(), result.order.end(), [&](int a, int b) {
+        if (in_frustum[a] != in_frustum[b]) {
+            return in_frustum[a] > in_frustum[b];
+        }
+        return result.distances[a] < result.distances[b];
+    });
+}
 
+void PLATEAUDynamicTileManager::execute_load_unload(const UpdateResult &result) {
     std::lock_guard<std::mutex> lock(load_mutex_);
 
-    for (const auto &pair : sorted_tiles) {
-        Ref<PLATEAUDynamicTile> tile = pair.second;
+    // Rebuild queues in the new priority order; live states are rechecked since
+    // tiles may have been loaded/unloaded while the job was running
+    std::queue<QueuedTile>().swap(load_queue_);
+    std::queue<QueuedTile>().swap(unload_queue_);
+
+    // Tiles still waiting from a previous selection keep their original enqueue
+    // time, and only tiles entering a queue count as queued this frame
+    HashMap<String, uint64_t> previous_load_enqueue = load_enqueue_usec_;
+    HashMap<String, uint64_t> previous_unload_enqueue = unload_enqueue_usec_;
+    load_enqueue_usec_.clear();
+    unload_enqueue_usec_.clear();
+
+    uint64_t now = get_time_usec();
+    auto enqueue = [&](std::queue<QueuedTile> &queue, HashMap<String, uint64_t> &enqueue_usec,
+                       const HashMap<String, uint64_t> &previous, const Ref<PLATEAUDynamicTile> &tile) {
+        const String &address = tile->get_address();
+        uint64_t since = now;
+        if (const uint64_t *queued_since = previous.getptr(address)) {
+            since = *queued_since;
+        } else {
+            current_frame_.tiles_queued++;
+        }
+        enqueue_usec.insert(address, since);
+        queue.push({tile, since});
+    };
+
+    for (int index : result.order) {
+        Ref<PLATEAUDynamicTile> tile = tiles_[index];
         if (tile.is_null()) continue;
 
         PLATEAUDynamicTile::LoadState current = tile->get_load_state();
@@ -786,32 +1903,40 @@ void PLATEAUDynamicTileManager::execute_load_unload() {
         if (next == PLATEAUDynamicTile::LOAD_STATE_LOADED &&
             current != PLATEAUDynamicTile::LOAD_STATE_LOADED &&
             current != PLATEAUDynamicTile::LOAD_STATE_LOADING) {
-            load_queue_.push(tile);
+            enqueue(load_queue_, load_enqueue_usec_, previous_load_enqueue, tile);
         } else if (next == PLATEAUDynamicTile::LOAD_STATE_UNLOADED &&
                    current == PLATEAUDynamicTile::LOAD_STATE_LOADED) {
-            unload_queue_.push(tile);
+            if (lod_transition_enabled_ && (is_in_lod_transition(tile) || begin_lod_transition(tile))) {
+                continue;
+            }
+            enqueue(unload_queue_, unload_enqueue_usec_, previous_unload_enqueue, tile);
         }
     }
 }
 
 void PLATEAUDynamicTileManager::process_queues() {
+    roll_frame_statistics();
+
     std::lock_guard<std::mutex> lock(load_mutex_);
 
     int processed = 0;
 
     // Process unload queue first (to free resources)
     while (!unload_queue_.empty() && processed < tiles_per_frame_) {
-        Ref<PLATEAUDynamicTile> tile = unload_queue_.front();
+        QueuedTile queued = unload_queue_.front();
         unload_queue_.pop();
-        unload_tile(tile);
+        unload_enqueue_usec_.erase(queued.tile->get_address());
+        unload_tile(queued.tile);
         processed++;
     }
 
     // Process load queue
     while (!load_queue_.empty() && processed < tiles_per_frame_) {
-        Ref<PLATEAUDynamicTile> tile = load_queue_.front();
+        QueuedTile queued = load_queue_.front();
         load_queue_.pop();
-        load_tile(tile);
+        load_enqueue_usec_.erase(queued.tile->get_address());
+        record_queue_latency(queued.enqueue_usec);
+        load_tile(queued.tile);
         processed++;
     }
 }
@@ -821,6 +1946,26 @@ void PLATEAUDynamicTileManager::load_tile(const Ref<PLATEAUDynamicTile> &tile) {
 
     tile->set_load_state(PLATEAUDynamicTile::LOAD_STATE_LOADING);
 
+    // Reuse a retained instance if one is cached
+    if (retention_cache_enabled_) {
+        Node3D *retained = take_retained_tile(tile->get_address());
+        if (retained) {
+            retention_cache_hits_++;
+            add_child(retained);
+            tile->set_loaded_instance(retained);
+            loaded_bytes_ += tile->get_estimated_bytes();
+            current_frame_.tiles_loaded++;
+            if (lod_transition_enabled_ && has_waiting_lod_transition_ancestor(tile)) {
+                // Stays hidden under its parent until the transition fades it in
+                retained->set_visible(false);
+            }
+            tile->set_load_state(PLATEAUDynamicTile::LOAD_STATE_LOADED);
+            emit_signal("tile_loaded", tile);
+            return;
+        }
+        retention_cache_misses_++;
+    }
+
     // Load the scene
     String resource_path = tile_base_path_.path_join(tile->get_address() + ".tscn");
 
@@ -836,6 +1981,12 @@ void PLATEAUDynamicTileManager::load_tile(const Ref<PLATEAUDynamicTile> &tile) {
 
     Node3D *instance = instantiate_tile(tile);
     if (instance) {
+        loaded_bytes_ += tile->get_estimated_bytes();
+        current_frame_.tiles_loaded++;
+        if (lod_transition_enabled_ && has_waiting_lod_transition_ancestor(tile)) {
+            // Stays hidden under its parent until the transition fades it in
+            instance->set_visible(false);
+        }
         tile->set_load_state(PLATEAUDynamicTile::LOAD_STATE_LOADED);
         emit_signal("tile_loaded", tile);
     } else {
@@ -851,7 +2002,16 @@ void PLATEAUDynamicTileManager::unload_tile(const Ref<PLATEAUDynamicTile> &tile)
     Node3D *instance = tile->get_loaded_instance();
     if (instance) {
         emit_signal("tile_unloading", tile);
-        instance->queue_free();
+        loaded_bytes_ -= tile->get_estimated_bytes();
+        current_frame_.tiles_unloaded++;
+        if (lod_transition_enabled_) {
+            // Reset fade state so a retained instance comes back fully visible
+            instance->set_visible(true);
+            set_instance_transparency(instance, 0.0f);
+        }
+        if (!retain_tile(tile, instance)) {
+            instance->queue_free();
+        }
         tile->set_loaded_instance(nullptr);
     }
 
@@ -867,17 +2027,22 @@ Node3D *PLATEAUDynamicTileManager::instantiate_tile(const Ref<PLATEAUDynamicTile
         resource_path = tile_base_path_.path_join(tile->get_address() + ".scn");
     }
 
+    uint64_t load_start = get_time_usec();
     Ref<PackedScene> scene = ResourceLoader::get_singleton()->load(resource_path);
+    current_frame_.resource_load_usec += get_time_usec() - load_start;
     if (scene.is_null()) {
         return nullptr;
     }
 
+    uint64_t instantiate_start = get_time_usec();
     Node *instance = scene->instantiate();
     Node3D *instance_3d = Object::cast_to<Node3D>(instance);
 
     if (instance_3d) {
         add_child(instance_3d);
+        current_frame_.instantiate_usec += get_time_usec() - instantiate_start;
         tile->set_loaded_instance(instance_3d);
+        tile->estimated_bytes_ = estimate_instance_bytes(instance_3d);
     } else if (instance) {
         instance->queue_free();
     }
@@ -902,15 +2067,47 @@ void PLATEAUDynamicTileManager::_bind_methods() {
     ClassDB::bind_method(D_METHOD("set_force_high_resolution_addresses", "addresses"), &PLATEAUDynamicTileManager::set_force_high_resolution_addresses);
     ClassDB::bind_method(D_METHOD("get_force_high_resolution_addresses"), &PLATEAUDynamicTileManager::get_force_high_resolution_addresses);
     ClassDB::bind_method(D_METHOD("initialize", "meta_store"), &PLATEAUDynamicTileManager::initialize);
+    ClassDB::bind_method(D_METHOD("set_threaded_update", "enable"), &PLATEAUDynamicTileManager::set_threaded_update);
+    ClassDB::bind_method(D_METHOD("get_threaded_update"), &PLATEAUDynamicTileManager::get_threaded_update);
+    ClassDB::bind_method(D_METHOD("set_update_distance_threshold", "distance"), &PLATEAUDynamicTileManager::set_update_distance_threshold);
+    ClassDB::bind_method(D_METHOD("get_update_distance_threshold"), &PLATEAUDynamicTileManager::get_update_distance_threshold);
+    ClassDB::bind_method(D_METHOD("set_update_angle_threshold", "degrees"), &PLATEAUDynamicTileManager::set_update_angle_threshold);
+    ClassDB::bind_method(D_METHOD("get_update_angle_threshold"), &PLATEAUDynamicTileManager::get_update_angle_threshold);
     ClassDB::bind_method(D_METHOD("update_by_camera_position", "position"), &PLATEAUDynamicTileManager::update_by_camera_position);
+    ClassDB::bind_method(D_METHOD("is_updating"), &PLATEAUDynamicTileManager::is_updating);
     ClassDB::bind_method(D_METHOD("force_load_tiles", "addresses"), &PLATEAUDynamicTileManager::force_load_tiles);
     ClassDB::bind_method(D_METHOD("cancel_load"), &PLATEAUDynamicTileManager::cancel_load);
     ClassDB::bind_method(D_METHOD("get_tiles"), &PLATEAUDynamicTileManager::get_tiles);
     ClassDB::bind_method(D_METHOD("get_tiles_by_zoom_level", "zoom_level"), &PLATEAUDynamicTileManager::get_tiles_by_zoom_level);
     ClassDB::bind_method(D_METHOD("get_loaded_tiles"), &PLATEAUDynamicTileManager::get_loaded_tiles);
     ClassDB::bind_method(D_METHOD("check_camera_position_changed", "position", "threshold"), &PLATEAUDynamicTileManager::check_camera_position_changed, DEFVAL(1.0f));
+    ClassDB::bind_method(D_METHOD("check_camera_transform_changed", "transform", "distance_threshold", "angle_threshold_degrees"), &PLATEAUDynamicTileManager::check_camera_transform_changed, DEFVAL(1.0f), DEFVAL(1.0f));
     ClassDB::bind_method(D_METHOD("get_last_camera_position"), &PLATEAUDynamicTileManager::get_last_camera_position);
     ClassDB::bind_method(D_METHOD("cleanup"), &PLATEAUDynamicTileManager::cleanup);
+    ClassDB::bind_method(D_METHOD("set_retention_cache_enabled", "enable"), &PLATEAUDynamicTileManager::set_retention_cache_enabled);
+    ClassDB::bind_method(D_METHOD("get_retention_cache_enabled"), &PLATEAUDynamicTileManager::get_retention_cache_enabled);
+    ClassDB::bind_method(D_METHOD("set_retention_cache_max_bytes", "bytes"), &PLATEAUDynamicTileManager::set_retention_cache_max_bytes);
+    ClassDB::bind_method(D_METHOD("get_retention_cache_max_bytes"), &PLATEAUDynamicTileManager::get_retention_cache_max_bytes);
+    ClassDB::bind_method(D_METHOD("set_retention_cache_max_tiles", "count"), &PLATEAUDynamicTileManager::set_retention_cache_max_tiles);
+    ClassDB::bind_method(D_METHOD("get_retention_cache_max_tiles"), &PLATEAUDynamicTileManager::get_retention_cache_max_tiles);
+    ClassDB::bind_method(D_METHOD("clear_retention_cache"), &PLATEAUDynamicTileManager::clear_retention_cache);
+    ClassDB::bind_method(D_METHOD("get_retention_cache_count"), &PLATEAUDynamicTileManager::get_retention_cache_count);
+    ClassDB::bind_method(D_METHOD("get_retention_cache_bytes"), &PLATEAUDynamicTileManager::get_retention_cache_bytes);
+    ClassDB::bind_method(D_METHOD("get_retention_cache_hits"), &PLATEAUDynamicTileManager::get_retention_cache_hits);
+    ClassDB::bind_method(D_METHOD("get_retention_cache_misses"), &PLATEAUDynamicTileManager::get_retention_cache_misses);
+    ClassDB::bind_method(D_METHOD("get_retention_cache_evictions"), &PLATEAUDynamicTileManager::get_retention_cache_evictions);
+    ClassDB::bind_method(D_METHOD("get_resident_bytes"), &PLATEAUDynamicTileManager::get_resident_bytes);
+    ClassDB::bind_method(D_METHOD("get_statistics"), &PLATEAUDynamicTileManager::get_statistics);
+    ClassDB::bind_method(D_METHOD("get_statistic", "key"), &PLATEAUDynamicTileManager::get_statistic);
+    ClassDB::bind_method(D_METHOD("set_lod_transition_enabled", "enable"), &PLATEAUDynamicTileManager::set_lod_transition_enabled);
+    ClassDB::bind_method(D_METHOD("get_lod_transition_enabled"), &PLATEAUDynamicTileManager::get_lod_transition_enabled);
+    ClassDB::bind_method(D_METHOD("set_lod_transition_duration", "seconds"), &PLATEAUDynamicTileManager::set_lod_transition_duration);
+    ClassDB::bind_method(D_METHOD("get_lod_transition_duration"), &PLATEAUDynamicTileManager::get_lod_transition_duration);
+    ClassDB::bind_method(D_METHOD("set_max_lod_transitions", "count"), &PLATEAUDynamicTileManager::set_max_lod_transitions);
+    ClassDB::bind_method(D_METHOD("get_max_lod_transitions"), &PLATEAUDynamicTileManager::get_max_lod_transitions);
+    ClassDB::bind_method(D_METHOD("get_lod_transition_count"), &PLATEAUDynamicTileManager::get_lod_transition_count);
+    ClassDB::bind_method(D_METHOD("set_performance_monitors_enabled", "enable"), &PLATEAUDynamicTileManager::set_performance_monitors_enabled);
+    ClassDB::bind_method(D_METHOD("get_performance_monitors_enabled"), &PLATEAUDynamicTileManager::get_performance_monitors_enabled);
 
     ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "camera", PROPERTY_HINT_NODE_TYPE, "Camera3D"), "set_camera", "get_camera");
     ADD_PROPERTY(PropertyInfo(Variant::BOOL, "auto_update"), "set_auto_update", "get_auto_update");
@@ -918,6 +2115,16 @@ void PLATEAUDynamicTileManager::_bind_methods() {
     ADD_PROPERTY(PropertyInfo(Variant::STRING, "tile_base_path"), "set_tile_base_path", "get_tile_base_path");
     ADD_PROPERTY(PropertyInfo(Variant::DICTIONARY, "load_distances"), "set_load_distances", "get_load_distances");
     ADD_PROPERTY(PropertyInfo(Variant::PACKED_STRING_ARRAY, "force_high_resolution_addresses"), "set_force_high_resolution_addresses", "get_force_high_resolution_addresses");
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "threaded_update"), "set_threaded_update", "get_threaded_update");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "update_distance_threshold"), "set_update_distance_threshold", "get_update_distance_threshold");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "update_angle_threshold"), "set_update_angle_threshold", "get_update_angle_threshold");
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "lod_transition_enabled"), "set_lod_transition_enabled", "get_lod_transition_enabled");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "lod_transition_duration"), "set_lod_transition_duration", "get_lod_transition_duration");
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "max_lod_transitions"), "set_max_lod_transitions", "get_max_lod_transitions");
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "performance_monitors_enabled"), "set_performance_monitors_enabled", "get_performance_monitors_enabled");
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "retention_cache_enabled"), "set_retention_cache_enabled", "get_retention_cache_enabled");
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "retention_cache_max_bytes"), "set_retention_cache_max_bytes", "get_retention_cache_max_bytes");
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "retention_cache_max_tiles"), "set_retention_cache_max_tiles", "get_retention_cache_max_tiles");
 
     ADD_SIGNAL(MethodInfo("initialized"));
     ADD_SIGNAL(MethodInfo("tile_loaded", PropertyInfo(Variant::OBJECT, "tile", PROPERTY_HINT_RESOURCE_TYPE, "PLATEAUDynamicTile")));
@@ -8,11 +8,18 @@
 #include <godot_cpp/variant/typed_array.hpp>
 #include <godot_cpp/variant/dictionary.hpp>
 #include <godot_cpp/variant/aabb.hpp>
+#include <godot_cpp/variant/plane.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
 
 #include <algorithm>
 #include <atomic>
+#include <deque>
+#include <list>
+#include <memory>
 #include <mutex>
 #include <queue>
+#include <unordered_map>
 #include <vector>
 
 namespace godot {
@@ -65,6 +72,9 @@ public:
     // Loaded instance (null if not loaded)
     Node3D *get_loaded_instance() const;
 
+    // Estimated geometry memory of the loaded instance in bytes (0 if never loaded)
+    int64_t get_estimated_bytes() const;
+
     // Parent tile (lower zoom level)
     void set_parent_tile(const Ref<PLATEAUDynamicTile> &parent);
     Ref<PLATEAUDynamicTile> get_parent_tile() const;
@@ -78,6 +88,7 @@ public:
 
     // Calculate distance to camera position
     float calculate_distance(const Vector3 &camera_pos, bool ignore_y = true) const;
+    static float calculate_distance_to_extent(const AABB &extent, const Vector3 &camera_pos, bool ignore_y);
 
     // Check if tile is within load range for its zoom level
     bool is_within_range(float distance, const Dictionary &load_distances) const;
@@ -96,6 +107,7 @@ private:
     LoadState next_load_state_;
     float distance_from_camera_;
     Node3D *loaded_instance_;
+    int64_t estimated_bytes_;
     Ref<PLATEAUDynamicTile> parent_tile_;
     TypedArray<PLATEAUDynamicTile> child_tiles_;
 
@@ -143,6 +155,10 @@ private:
 
 /**
  * PLATEAUDynamicTileMetaStore - Container for tile metadata
+ *
+ * Can be backed either by PLATEAUDynamicTileMetaInfo objects or by a compact
+ * binary image (see to_binary()). A binary-backed store reads records in place,
+ * so loading a prefecture-scale tile set does not allocate one object per tile.
  */
 class PLATEAUDynamicTileMetaStore : public Resource {
     GDCLASS(PLATEAUDynamicTileMetaStore, Resource)
@@ -161,18 +177,46 @@ public:
     int get_tile_count() const;
     Ref<PLATEAUDynamicTileMetaInfo> get_tile_meta_info(int index) const;
 
+    // Per-tile accessors (no PLATEAUDynamicTileMetaInfo allocation for binary stores)
+    String get_tile_address(int index) const;
+    AABB get_tile_extent(int index) const;
+    int get_tile_zoom_level(int index) const;
+    String get_tile_group_name(int index) const;
+    int get_tile_lod(int index) const;
+
     // Create from JSON data
     static Ref<PLATEAUDynamicTileMetaStore> from_json(const Dictionary &json);
 
     // Export to JSON
     Dictionary to_json() const;
 
+    // Compact binary format: flat records + string table
+    PackedByteArray to_binary() const;
+    static Ref<PLATEAUDynamicTileMetaStore> from_binary(const PackedByteArray &data);
+    bool save_binary(const String &path) const;
+    static Ref<PLATEAUDynamicTileMetaStore> load_binary(const String &path);
+
+    // Convert a JSON meta store file (to_json() layout) to the binary format
+    static bool convert_json_to_binary(const String &json_path, const String &binary_path);
+
+    bool is_binary_backed() const;
+
 protected:
     static void _bind_methods();
 
 private:
     TypedArray<PLATEAUDynamicTileMetaInfo> tile_meta_infos_;
     Vector3 reference_point_;
+
+    // Binary backing (empty unless created by from_binary/load_binary)
+    PackedByteArray binary_data_;
+    int binary_tile_count_;
+    int binary_string_count_;
+
+    const uint8_t *get_binary_record(int index) const;
+    String get_binary_string(uint32_t id) const;
+    Ref<PLATEAUDynamicTileMetaInfo> create_meta_info_from_binary(int index) const;
+    void materialize_binary();
 };
 
 /**
@@ -258,9 +302,22 @@ public:
     // Initialize with metadata store
     void initialize(const Ref<PLATEAUDynamicTileMetaStore> &meta_store);
 
+    // Run tile selection on a worker thread (result applied on the main thread)
+    void set_threaded_update(bool enable);
+    bool get_threaded_update() const;
+
+    // Camera movement needed before auto-update re-runs tile selection
+    void set_update_distance_threshold(float distance);
+    float get_update_distance_threshold() const;
+    void set_update_angle_threshold(float degrees);
+    float get_update_angle_threshold() const;
+
     // Update tiles by camera position (async)
     void update_by_camera_position(const Vector3 &position);
 
+    // True while a tile selection job is running
+    bool is_updating() const;
+
     // Force load specific tiles by address
     void force_load_tiles(const PackedStringArray &addresses);
 
@@ -279,12 +336,53 @@ public:
     // Check if camera position has changed significantly
     bool check_camera_position_changed(const Vector3 &position, float threshold = 1.0f) const;
 
+    // Check if camera moved or rotated significantly
+    bool check_camera_transform_changed(const Transform3D &transform, float distance_threshold = 1.0f, float angle_threshold_degrees = 1.0f) const;
+
     // Get last camera position
     Vector3 get_last_camera_position() const;
 
     // Cleanup all tiles
     void cleanup();
 
+    // Retention cache: unloaded tiles are detached and kept for fast reload
+    // until the byte/count budget is exceeded, then evicted in LRU order
+    void set_retention_cache_enabled(bool enable);
+    bool get_retention_cache_enabled() const;
+    void set_retention_cache_max_bytes(int64_t bytes);
+    int64_t get_retention_cache_max_bytes() const;
+    void set_retention_cache_max_tiles(int count);
+    int get_retention_cache_max_tiles() const;
+    void clear_retention_cache();
+
+    // Retention cache counters
+    int get_retention_cache_count() const;
+    int64_t get_retention_cache_bytes() const;
+    int64_t get_retention_cache_hits() const;
+    int64_t get_retention_cache_misses() const;
+    int64_t get_retention_cache_evictions() const;
+
+    // Estimated bytes of loaded tiles plus retained tiles
+    int64_t get_resident_bytes() const;
+
+    // Load/unload statistics of the last frame and the last tile selection
+    Dictionary get_statistics() const;
+    Variant get_statistic(const String &key) const;
+
+    // LOD transitions: when a tile is replaced by its children, keep it until the
+    // children have loaded, then fade it out (bounded by max_lod_transitions)
+    void set_lod_transition_enabled(bool enable);
+    bool get_lod_transition_enabled() const;
+    void set_lod_transition_duration(float seconds);
+    float get_lod_transition_duration() const;
+    void set_max_lod_transitions(int count);
+    int get_max_lod_transitions() const;
+    int get_lod_transition_count() const;
+
+    // Expose statistics as custom monitors in the Godot debugger
+    void set_performance_monitors_enabled(bool enable);
+    bool get_performance_monitors_enabled() const;
+
 protected:
     static void _bind_methods();
 
@@ -297,27 +395,166 @@ private:
     String tile_base_path_;
     PackedStringArray force_high_resolution_addresses_;
     Vector3 last_camera_position_;
+    Transform3D last_camera_transform_;
+    bool threaded_update_;
+    float update_distance_threshold_;
+    float update_angle_threshold_;
 
     TypedArray<PLATEAUDynamicTile> tiles_;
     Dictionary address_to_tile_;
 
+    // Queued tile with the time it entered the queue (for latency statistics)
+    struct QueuedTile {
+        Ref<PLATEAUDynamicTile> tile;
+        uint64_t enqueue_usec;
+    };
+
     // Processing state
     std::atomic<bool> is_processing_;
     std::mutex load_mutex_;
-    std::queue<Ref<PLATEAUDynamicTile>> load_queue_;
-    std::queue<Ref<PLATEAUDynamicTile>> unload_queue_;
+    std::queue<QueuedTile> load_queue_;
+    std::queue<QueuedTile> unload_queue_;
+    HashMap<String, uint64_t> load_enqueue_usec_;    // Address -> first enqueue time of queued tiles
+    HashMap<String, uint64_t> unload_enqueue_usec_;
 
     // Frame-based instantiation
     int tiles_per_frame_;
     void process_queues();
 
+    // Retention cache (front = most recently used)
+    struct RetainedTile {
+        String address;
+        Node3D *instance;
+        int64_t bytes;
+    };
+    bool retention_cache_enabled_;
+    int64_t retention_cache_max_bytes_;
+    int retention_cache_max_tiles_;
+    std::list<RetainedTile> retention_lru_;
+    HashMap<String, std::list<RetainedTile>::iterator> retention_index_;
+    int64_t retention_cache_bytes_;
+    int64_t retention_cache_hits_;
+    int64_t retention_cache_misses_;
+    int64_t retention_cache_evictions_;
+    int64_t loaded_bytes_;
+
+    // Timings of the selection phases in microseconds
+    struct UpdateTimings {
+        uint64_t distances_usec = 0;
+        uint64_t load_states_usec = 0;
+        uint64_t hole_filling_usec = 0;
+        uint64_t force_high_resolution_usec = 0;
+        uint64_t sort_usec = 0;
+        uint64_t apply_usec = 0;
+    };
+
+    // Per-frame counters (rolled over on the first update call of each engine frame)
+    struct FrameStatistics {
+        int tiles_queued = 0;
+        int tiles_loaded = 0;
+        int tiles_unloaded = 0;
+        uint64_t resource_load_usec = 0;
+        uint64_t instantiate_usec = 0;
+    };
+
+    // Statistics
+    FrameStatistics current_frame_;
+    FrameStatistics last_frame_;
+    uint64_t statistics_frame_;     // Engine process frame current_frame_ belongs to
+    UpdateTimings last_update_timings_;
+    std::deque<uint64_t> queue_latency_samples_;  // Most recent load latencies (usec)
+    bool performance_monitors_enabled_;
+    PackedStringArray registered_monitors_;
+
+    static uint64_t get_time_usec();
+    void roll_frame_statistics();
+    void record_queue_latency(uint64_t enqueue_usec);
+    double get_queue_latency_percentile(double percentile) const;
+    void register_performance_monitors();
+    void unregister_performance_monitors();
+
+    bool retain_tile(const Ref<PLATEAUDynamicTile> &tile, Node3D *instance);
+    Node3D *take_retained_tile(const String &address);
+    void evict_retention_cache();
+    static int64_t estimate_instance_bytes(Node *node);
+
+    // Parent tile kept resident while its descendants load, then faded out
+    struct LodTransition {
+        Ref<PLATEAUDynamicTile> tile;
+        bool fading;
+        float elapsed;
+    };
+    bool lod_transition_enabled_;
+    float lod_transition_duration_;
+    int max_lod_transitions_;
+    std::vector<LodTransition> lod_transitions_;
+
+    bool begin_lod_transition(const Ref<PLATEAUDynamicTile> &tile);
+    void update_lod_transitions(double delta);
+    void clear_lod_transitions();
+    bool is_in_lod_transition(const Ref<PLATEAUDynamicTile> &tile) const;
+    bool has_waiting_lod_transition_ancestor(const Ref<PLATEAUDynamicTile> &tile) const;
+    static bool has_pending_descendants(const Ref<PLATEAUDynamicTile> &tile);
+    static void collect_loaded_descendants(const Ref<PLATEAUDynamicTile> &tile, std::vector<Node3D *> &out_instances);
+    static void set_instance_transparency(Node *node, float transparency);
+
+    // Immutable tile topology shared with update jobs (indices match tiles_)
+    struct TileNode {
+        AABB extent;
+        int zoom_level;
+        int parent;
+        std::vector<int> children;
+    };
+    using TileTopology = std::vector<TileNode>;
+
+    // Input of a tile selection job, captured on the main thread
+    struct UpdateJob {
+        std::shared_ptr<const TileTopology> topology;
+        std::vector<uint8_t> load_states;
+        std::unordered_map<int, Vector2> load_distances;
+        std::vector<int> force_high_resolution;
+        std::vector<Plane> frustum;
+        Vector3 camera_position;
+        bool ignore_y = true;
+        bool lod_transitions = false;
+        uint64_t generation = 0;
+    };
+
+    // Output of a tile selection job, applied on the main thread
+    struct UpdateResult {
+        std::vector<float> distances;
+        std::vector<uint8_t> next_states;
+        std::vector<int> order;  // Load priority: in frustum first, then by distance
+        uint64_t generation = 0;
+        UpdateTimings timings;
+    };
+
+    std::shared_ptr<const TileTopology> topology_;
+    HashMap<String, int> address_to_index_;
+    uint64_t generation_;
+
+    std::mutex update_mutex_;
+    UpdateJob pending_job_;
+    UpdateResult job_result_;
+    int64_t update_task_id_;
+
     // Internal methods
     void build_tile_hierarchy();
-    void calculate_distances(const Vector3 &camera_pos);
-    void determine_load_states();
-    void fill_tile_holes();
-    void apply_force_high_resolution();
-    void execute_load_unload();
+    void build_tile_topology();
+    Camera3D *get_tracked_camera() const;
+    static std::vector<Plane> get_camera_frustum(Camera3D *camera);
+    bool request_update(const Vector3 &position, const std::vector<Plane> &frustum);
+    void _update_thread_func();
+    void apply_update_result();
+
+    // Selection phases (pure functions over job data, safe on worker threads)
+    static void calculate_distances(const UpdateJob &job, UpdateResult &result);
+    static void determine_load_states(const UpdateJob &job, UpdateResult &result);
+    static void fill_tile_holes(const UpdateJob &job, UpdateResult &result);
+    static void apply_force_high_resolution(const UpdateJob &job, UpdateResult &result);
+    static void sort_load_order(const UpdateJob &job, UpdateResult &result);
+    static void compute_update(const UpdateJob &job, UpdateResult &result);
+    void execute_load_unload(const UpdateResult &result);
 
     void load_tile(const Ref<PLATEAUDynamicTile> &tile);
     void unload_tile(const Ref<PLATEAUDynamicTile> &tile);
@@ -1,9 +1,107 @@
 #include "plateau_gml_file.h"
 #include "plateau_dataset_source.h"
+#include "plateau_parallel.h"
 #include <godot_cpp/variant/utility_functions.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
 
 using namespace godot;
 
+static const int64_t PRESCAN_CHUNK_SIZE = 1 << 20;
+static const size_t PRESCAN_HEADER_LIMIT = 1 << 20;    // The model envelope is expected in the first 1 MiB
+static const ptrdiff_t PRESCAN_TAG_LOOKAHEAD = 32;     // Enough for "<" + namespace prefix + ":lodN"
+static const ptrdiff_t PRESCAN_MAX_PREFIX = 24;
+
+// Parse up to 3 numbers following the '>' of a corner tag. Returns the count parsed
+static int parse_corner_values(const std::string &text, size_t tag_pos, double values[3]) {
+    size_t gt = text.find('>', tag_pos);
+    if (gt == std::string::npos) {
+        return 0;
+    }
+    const char *p = text.c_str() + gt + 1;
+    int count = 0;
+    while (count < 3) {
+        char *next = nullptr;
+        double value = strtod(p, &next);
+        if (next == p) {
+            break;
+        }
+        values[count++] = value;
+        p = next;
+    }
+    return count;
+}
+
+// Look for the CityModel envelope in the first bytes of the file.
+// Returns true once the answer is known (found, or a city object came first)
+static bool find_model_envelope(const std::string &head, PLATEAUGmlFile::PrescanResult &out) {
+    size_t bounded_by = head.find("boundedBy");
+    size_t member = head.find("cityObjectMember");
+    if (member != std::string::npos && (bounded_by == std::string::npos || member < bounded_by)) {
+        return true;
+    }
+    if (bounded_by == std::string::npos) {
+        return false;
+    }
+
+    size_t lower = head.find("lowerCorner", bounded_by);
+    size_t upper = head.find("upperCorner", bounded_by);
+    if (lower == std::string::npos || upper == std::string::npos) {
+        return false;
+    }
+    // Wait until the upper corner's closing tag is in the buffer
+    size_t upper_gt = head.find('>', upper);
+    if (upper_gt == std::string::npos || head.find('<', upper_gt) == std::string::npos) {
+        return false;
+    }
+
+    // PLATEAU uses geographic CRSs (EPSG:6697 / 6668) with latitude, longitude, height axis order
+    double low[3] = { 0.0, 0.0, 0.0 };
+    double high[3] = { 0.0, 0.0, 0.0 };
+    int low_count = parse_corner_values(head, lower, low);
+    int high_count = parse_corner_values(head, upper, high);
+    if (low_count >= 2 && high_count >= 2 &&
+            low[0] >= -90.0 && high[0] <= 90.0 && low[1] >= -180.0 && high[1] <= 180.0) {
+        out.has_envelope = true;
+        out.min_lat = low[0];
+        out.min_lon = low[1];
+        out.max_lat = high[0];
+        out.max_lon = high[1];
+        out.min_height = low_count > 2 ? low[2] : 0.0;
+        out.max_height = high_count > 2 ? high[2] : 0.0;
+    }
+    return true;
+}
+
+// Mark "<prefix:lodN" element names. Returns where an element name that may continue
+// into the next chunk starts (or end if there is none)
+static const char *scan_lod_elements(const char *p, const char *end, uint32_t &lod_mask) {
+    while (p < end) {
+        const char *lt = static_cast<const char *>(memchr(p, '<', end - p));
+        if (!lt) {
+            return end;
+        }
+        if (end - lt < PRESCAN_TAG_LOOKAHEAD) {
+            return lt;
+        }
+
+        const char *q = lt + 1;
+        const char *limit = q + PRESCAN_MAX_PREFIX;
+        while (q < limit && *q != ':' && *q != '>' && *q != '/' && *q != ' ' && *q != '!' && *q != '?') {
+            q++;
+        }
+        if (*q == ':' && q[1] == 'l' && q[2] == 'o' && q[3] == 'd' && q[4] >= '0' && q[4] <= '4') {
+            lod_mask |= 1u << (q[4] - '0');
+        }
+        p = lt + 1;
+    }
+    return end;
+}
+
 PLATEAUGmlFile::PLATEAUGmlFile() {
 }
 
@@ -218,6 +316,108 @@ Dictionary PLATEAUGmlFile::get_grid_extent() const {
     return result;
 }
 
+bool PLATEAUGmlFile::prescan_file(const String &path, bool scan_lod, PrescanResult &out) {
+    out = PrescanResult();
+
+    Ref<FileAccess> file = FileAccess::open(path, FileAccess::READ);
+    if (file.is_null()) {
+        return false;
+    }
+    out.file_size = static_cast<int64_t>(file->get_length());
+
+    std::string head;
+    bool envelope_done = false;
+    std::vector<char> buffer;
+    size_t carry = 0;
+
+    while (out.bytes_read < out.file_size) {
+        PackedByteArray chunk = file->get_buffer(PRESCAN_CHUNK_SIZE);
+        if (chunk.is_empty()) {
+            break;
+        }
+        out.bytes_read += chunk.size();
+        const char *data = reinterpret_cast<const char *>(chunk.ptr());
+
+        if (!envelope_done) {
+            head.append(data, chunk.size());
+            envelope_done = find_model_envelope(head, out) || head.size() >= PRESCAN_HEADER_LIMIT;
+            if (envelope_done) {
+                std::string().swap(head);
+            }
+        }
+
+        if (scan_lod) {
+            // Prepend the unfinished tail of the previous chunk
+            buffer.resize(carry + chunk.size());
+            memcpy(buffer.data() + carry, data, chunk.size());
+            const char *begin = buffer.data();
+            const char *end = begin + buffer.size();
+            const char *stop = scan_lod_elements(begin, end, out.lod_mask);
+            carry = end - stop;
+            memmove(buffer.data(), stop, carry);
+        }
+
+        if (envelope_done && (!scan_lod || (out.lod_mask & (1u << 4)))) {
+            break;
+        }
+    }
+
+    for (int lod = 4; lod >= 0; lod--) {
+        if (out.lod_mask & (1u << lod)) {
+            out.max_lod = lod;
+            break;
+        }
+    }
+    return true;
+}
+
+static Dictionary prescan_result_to_dictionary(const PLATEAUGmlFile::PrescanResult &result) {
+    Dictionary dict;
+    dict["has_envelope"] = result.has_envelope;
+    dict["min_lat"] = result.min_lat;
+    dict["max_lat"] = result.max_lat;
+    dict["min_lon"] = result.min_lon;
+    dict["max_lon"] = result.max_lon;
+    dict["min_height"] = result.min_height;
+    dict["max_height"] = result.max_height;
+    dict["max_lod"] = result.max_lod;
+    PackedInt32Array lods;
+    for (int lod = 0; lod <= 4; lod++) {
+        if (result.lod_mask & (1u << lod)) {
+            lods.push_back(lod);
+        }
+    }
+    dict["lods"] = lods;
+    dict["file_size"] = result.file_size;
+    dict["bytes_read"] = result.bytes_read;
+    return dict;
+}
+
+Dictionary PLATEAUGmlFile::prescan(bool scan_lod) const {
+    PrescanResult result;
+    if (!prescan_file(path_, scan_lod, result)) {
+        UtilityFunctions::printerr("PLATEAUGmlFile: Failed to open ", path_);
+        return Dictionary();
+    }
+    return prescan_result_to_dictionary(result);
+}
+
+Array PLATEAUGmlFile::prescan_files(const PackedStringArray &paths, bool scan_lod) {
+    std::vector<PrescanResult> results(paths.size());
+    std::vector<uint8_t> ok(paths.size(), 0);
+
+    plateau_parallel::parallel_for(0, paths.size(), [&](size_t i) {
+        ok[i] = prescan_file(paths[i], scan_lod, results[i]) ? 1 : 0;
+    }, 1);
+
+    Array result;
+    result.resize(paths.size());
+    for (int i = 0; i < paths.size(); i++) {
+        result[i] = ok[i] ? prescan_result_to_dictionary(results[i]) : Dictionary();
+    }
+    return result;
+}
+
 void PLATEAUGmlFile::_bind_methods() {
     // Static methods
     ClassDB::bind_static_method("PLATEAUGmlFile", D_METHOD("create", "path"), &PLATEAUGmlFile::create);
@@ -235,4 +435,6 @@ void PLATEAUGmlFile::_bind_methods() {
     ClassDB::bind_method(D_METHOD("search_image_paths"), &PLATEAUGmlFile::search_image_paths);
     ClassDB::bind_method(D_METHOD("search_codelist_paths"), &PLATEAUGmlFile::search_codelist_paths);
     ClassDB::bind_method(D_METHOD("get_grid_extent"), &PLATEAUGmlFile::get_grid_extent);
+    ClassDB::bind_method(D_METHOD("prescan", "scan_lod"), &PLATEAUGmlFile::prescan, DEFVAL(true));
+    ClassDB::bind_static_method("PLATEAUGmlFile", D_METHOD("prescan_files", "paths", "scan_lod"), &PLATEAUGmlFile::prescan_files, DEFVAL(true));
 }
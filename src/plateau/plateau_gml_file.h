@@ -3,6 +3,8 @@
 #include <godot_cpp/classes/ref_counted.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/packed_string_array.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/array.hpp>
 
 #include <plateau/dataset/gml_file.h>
 
@@ -27,6 +29,10 @@ namespace godot {
  *     var textures = gml.search_image_paths()
  *     for tex_path in textures:
  *         print("Texture: ", tex_path)
+ *
+ *     # Envelope and LODs from a byte scan (no CityGML parse)
+ *     var info = gml.prescan()
+ *     print(info.min_lat, ", ", info.min_lon, " LOD ", info.max_lod)
  * ```
  */
 class PLATEAUGmlFile : public RefCounted {
@@ -82,6 +88,33 @@ public:
     // Returns Dictionary with keys: min_lat, max_lat, min_lon, max_lon
     Dictionary get_grid_extent() const;
 
+    // Result of prescan_file()
+    struct PrescanResult {
+        bool has_envelope = false;
+        double min_lat = 0.0;
+        double min_lon = 0.0;
+        double min_height = 0.0;
+        double max_lat = 0.0;
+        double max_lon = 0.0;
+        double max_height = 0.0;
+        uint32_t lod_mask = 0;      // Bit n is set if any lodN element exists
+        int max_lod = -1;
+        int64_t file_size = 0;
+        int64_t bytes_read = 0;
+    };
+
+    // Read the CityModel gml:boundedBy envelope and the LODs present with a byte scan instead of
+    // a CityGML parse. The envelope search stops at the first city object; the LOD scan stops once
+    // LOD 4 is found. Thread-safe
+    static bool prescan_file(const String &path, bool scan_lod, PrescanResult &out);
+
+    // Prescan this file. Returns Dictionary with keys: has_envelope, min_lat, max_lat, min_lon, max_lon,
+    // min_height, max_height, max_lod, lods, file_size, bytes_read (empty if the file can't be read)
+    Dictionary prescan(bool scan_lod = true) const;
+
+    // Prescan many files in parallel. Returns one Dictionary per path (same keys as prescan())
+    static Array prescan_files(const PackedStringArray &paths, bool scan_lod = true);
+
 protected:
     static void _bind_methods();
 
@@ -75,23 +75,6 @@ protected:
 
 private:
     int grid_count_;
-
-    // Internal helper: Convert mesh data to plateau model
-    std::shared_ptr<plateau::polygonMesh::Model> create_model_from_mesh_data(
-        const TypedArray<PLATEAUMeshData> &mesh_data_array);
-
-    // Internal helper: Convert plateau model to mesh data
-    TypedArray<PLATEAUMeshData> create_mesh_data_from_model(
-        const plateau::polygonMesh::Model &model);
-
-    // Internal helper: Add mesh data to node recursively
-    void add_mesh_data_to_node(
-        plateau::polygonMesh::Node &parent_node,
-        const Ref<PLATEAUMeshData> &mesh_data);
-
-    // Internal helper: Create mesh data from node
-    Ref<PLATEAUMeshData> create_mesh_data_from_node(
-        const plateau::polygonMesh::Node &node);
 };
 
 } // namespace godot
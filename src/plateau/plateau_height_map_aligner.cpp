@@ -1,10 +1,16 @@
 #include "plateau_height_map_aligner.h"
 #include "plateau_platform.h"
+#include <godot_cpp/templates/hash_set.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <string>
 
 #ifndef PLATEAU_MOBILE_PLATFORM
 #include <plateau/height_map_alighner/height_map_aligner.h>
+#include "plateau_mesh_utils.h"
+#include "plateau_parallel.h"
 #endif
 
 #include "plateau_types.h"
@@ -23,7 +29,19 @@ PLATEAUHeightMapAligner::PLATEAUHeightMapAligner()
       alpha_expand_width_(2),
       alpha_averaging_width_(2),
       invert_height_offset_(-0.15),
-      skip_threshold_distance_(0.5f) {
+      skip_threshold_distance_(0.5f),
+      align_threads_(1)
+#ifndef PLATEAU_MOBILE_PLATFORM
+      , lookup_cols_(0),
+      lookup_rows_(0),
+      lookup_min_x_(0.0),
+      lookup_min_z_(0.0),
+      lookup_cell_x_(1.0),
+      lookup_cell_z_(1.0),
+      lookup_valid_(false),
+      align_cache_height_offset_(0.0)
+#endif
+{
 }
 
 PLATEAUHeightMapAligner::~PLATEAUHeightMapAligner() {
@@ -77,86 +95,317 @@ float PLATEAUHeightMapAligner::get_skip_threshold_distance() const {
     return skip_threshold_distance_;
 }
 
+void PLATEAUHeightMapAligner::set_align_threads(int threads) {
+    align_threads_ = std::max(0, threads);
+}
+
+int PLATEAUHeightMapAligner::get_align_threads() const {
+    return align_threads_;
+}
+
 void PLATEAUHeightMapAligner::add_heightmap(const Ref<PLATEAUHeightMapData> &heightmap_data) {
     ERR_FAIL_COND_MSG(heightmap_data.is_null(), "PLATEAUHeightMapAligner: heightmap_data is null.");
     ERR_FAIL_COND_MSG(heightmap_data->get_width() <= 0 || heightmap_data->get_height() <= 0, "PLATEAUHeightMapAligner: heightmap_data has invalid dimensions.");
 
     heightmap_refs_.push_back(heightmap_data);
+#ifndef PLATEAU_MOBILE_PLATFORM
+    invalidate_frame_cache();
+    {
+        std::lock_guard<std::mutex> lock(lookup_mutex_);
+        rebuild_height_lookup();
+    }
+#endif
     UtilityFunctions::print("Added heightmap: ", heightmap_data->get_name(),
                            " (", heightmap_data->get_width(), "x", heightmap_data->get_height(), ")");
 }
 
 void PLATEAUHeightMapAligner::clear_heightmaps() {
     heightmap_refs_.clear();
+#ifndef PLATEAU_MOBILE_PLATFORM
+    invalidate_frame_cache();
+    std::lock_guard<std::mutex> lock(lookup_mutex_);
+    rebuild_height_lookup();
+#endif
 }
 
 int PLATEAUHeightMapAligner::get_heightmap_count() const {
     return static_cast<int>(heightmap_refs_.size());
 }
 
-TypedArray<PLATEAUMeshData> PLATEAUHeightMapAligner::align(const TypedArray<PLATEAUMeshData> &mesh_data_array) {
-    TypedArray<PLATEAUMeshData> result;
+#ifndef PLATEAU_MOBILE_PLATFORM
+// Build a libplateau frame from heightmap data in the given coordinate system
+static HeightMapFrame create_height_map_frame(const Ref<PLATEAUHeightMapData> &heightmap_ref,
+                                              plateau::geometry::CoordinateSystem axis) {
+    TVec3d min = heightmap_ref->get_min_internal();
+    TVec3d max = heightmap_ref->get_max_internal();
+    return HeightMapFrame(
+        heightmap_ref->get_heightmap_internal(),
+        heightmap_ref->get_width(),
+        heightmap_ref->get_height(),
+        static_cast<float>(min.x), static_cast<float>(max.x),
+        static_cast<float>(min.y), static_cast<float>(max.y),
+        static_cast<float>(min.z), static_cast<float>(max.z),
+        axis
+    );
+}
+
+bool PLATEAUHeightMapAligner::is_frame_cache_current() const {
+    if (frame_cache_revisions_.size() != heightmap_refs_.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < heightmap_refs_.size(); i++) {
+        if (frame_cache_revisions_[i] != heightmap_refs_[i]->get_revision_internal()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void PLATEAUHeightMapAligner::invalidate_frame_cache() {
+    align_cache_.reset();
+    worker_aligner_cache_.clear();
+    invert_frames_cache_.clear();
+    frame_cache_revisions_.clear();
+}
+
+HeightMapAligner &PLATEAUHeightMapAligner::get_cached_aligner() {
+    if (!is_frame_cache_current()) {
+        invalidate_frame_cache();
+    }
+
+    // The offset is fixed at construction, so an offset change needs a new aligner
+    if (align_cache_ && align_cache_height_offset_ != height_offset_) {
+        align_cache_.reset();
+        worker_aligner_cache_.clear();
+    }
 
+    if (!align_cache_) {
+        // Use ENU (East-North-Up) since data is already in this coordinate system
+        align_cache_ = std::make_unique<HeightMapAligner>(height_offset_, plateau::geometry::CoordinateSystem::ENU);
+        for (const auto &heightmap_ref : heightmap_refs_) {
+            align_cache_->addHeightmapFrame(create_height_map_frame(heightmap_ref, plateau::geometry::CoordinateSystem::ENU));
+        }
+        align_cache_height_offset_ = height_offset_;
+        frame_cache_revisions_.clear();
+        for (const auto &heightmap_ref : heightmap_refs_) {
+            frame_cache_revisions_.push_back(heightmap_ref->get_revision_internal());
+        }
+    }
+
+    return *align_cache_;
+}
+
+std::vector<std::unique_ptr<HeightMapAligner>> &PLATEAUHeightMapAligner::get_cached_worker_aligners(int count) {
+    // Validates the frames and offset (clearing the worker aligners if they changed)
+    HeightMapAligner &aligner = get_cached_aligner();
+
+    // Drop aligners beyond the current thread count so their frame copies are released
+    if (static_cast<int>(worker_aligner_cache_.size()) > count) {
+        worker_aligner_cache_.resize(count);
+    }
+    while (static_cast<int>(worker_aligner_cache_.size()) < count) {
+        auto worker = std::make_unique<HeightMapAligner>(height_offset_, plateau::geometry::CoordinateSystem::ENU);
+        for (int k = 0; k < aligner.heightmapCount(); k++) {
+            worker->addHeightmapFrame(aligner.getHeightMapFrameAt(k));
+        }
+        worker_aligner_cache_.push_back(std::move(worker));
+    }
+    return worker_aligner_cache_;
+}
+
+const std::vector<HeightMapFrame> &PLATEAUHeightMapAligner::get_cached_invert_frames() {
+    if (!is_frame_cache_current()) {
+        invalidate_frame_cache();
+    }
+
+    if (invert_frames_cache_.empty()) {
+        invert_frames_cache_.reserve(heightmap_refs_.size());
+        for (const auto &heightmap_ref : heightmap_refs_) {
+            invert_frames_cache_.push_back(create_height_map_frame(heightmap_ref, plateau::geometry::CoordinateSystem::EUN));
+        }
+        frame_cache_revisions_.clear();
+        for (const auto &heightmap_ref : heightmap_refs_) {
+            frame_cache_revisions_.push_back(heightmap_ref->get_revision_internal());
+        }
+    }
+
+    return invert_frames_cache_;
+}
+#endif
+
+TypedArray<PLATEAUMeshData> PLATEAUHeightMapAligner::align(const TypedArray<PLATEAUMeshData> &mesh_data_array) {
 #ifdef PLATEAU_MOBILE_PLATFORM
-    PLATEAU_MOBILE_UNSUPPORTED_V(result);
+    PLATEAU_MOBILE_UNSUPPORTED_V(TypedArray<PLATEAUMeshData>());
 #endif
 
 #ifndef PLATEAU_MOBILE_PLATFORM
+    return align_meshes(mesh_data_array, false);
+#endif
+}
+
+#ifndef PLATEAU_MOBILE_PLATFORM
+TypedArray<PLATEAUMeshData> PLATEAUHeightMapAligner::align_meshes(const TypedArray<PLATEAUMeshData> &mesh_data_array, bool rewrite_in_place) {
+    TypedArray<PLATEAUMeshData> result;
+
     ERR_FAIL_COND_V_MSG(heightmap_refs_.empty(), result, "PLATEAUHeightMapAligner: no heightmaps registered.");
     ERR_FAIL_COND_V_MSG(mesh_data_array.is_empty(), result, "PLATEAUHeightMapAligner: mesh_data_array is empty.");
 
     try {
-        // Create HeightMapAligner with ENU coordinate system (Godot's coordinate system)
-        HeightMapAligner aligner(height_offset_, plateau::geometry::CoordinateSystem::ENU);
-
-        // Add all heightmap frames
-        for (size_t hm_idx = 0; hm_idx < heightmap_refs_.size(); hm_idx++) {
-            const auto &heightmap_ref = heightmap_refs_[hm_idx];
-            TVec3d min = heightmap_ref->get_min_internal();
-            TVec3d max = heightmap_ref->get_max_internal();
-            const auto &heightmap_data = heightmap_ref->get_heightmap_internal();
-
-            // Use ENU (East-North-Up) since data is already in this coordinate system
-            // HeightMapFrame constructor will convert from specified axis to ENU internally
-            HeightMapFrame frame(
-                heightmap_data,
-                heightmap_ref->get_width(),
-                heightmap_ref->get_height(),
-                static_cast<float>(min.x), static_cast<float>(max.x),
-                static_cast<float>(min.y), static_cast<float>(max.y),
-                static_cast<float>(min.z), static_cast<float>(max.z),
-                plateau::geometry::CoordinateSystem::ENU  // Changed from EUN to ENU (no conversion needed)
-            );
-
-            aligner.addHeightmapFrame(frame);
+        // Frames are prepared once and reused while the heightmaps are unchanged
+        HeightMapAligner &aligner = get_cached_aligner();
+
+        // Partition root meshes into contiguous groups, one native model per worker.
+        // Godot mesh access stays on this thread; only the native alignment runs in parallel.
+        const int mesh_count = mesh_data_array.size();
+        int threads = align_threads_ > 0 ? align_threads_ : static_cast<int>(plateau_parallel::get_num_threads());
+        const int group_count = std::clamp(threads, 1, mesh_count);
+
+        std::vector<TypedArray<PLATEAUMeshData>> groups(group_count);
+        for (int i = 0; i < mesh_count; i++) {
+            groups[static_cast<int64_t>(i) * group_count / mesh_count].push_back(mesh_data_array[i]);
         }
 
-        // Create model from mesh data
-        auto model = create_model_from_mesh_data(mesh_data_array);
-        if (!model) {
-            UtilityFunctions::printerr("PLATEAUHeightMapAligner: failed to create model from mesh data");
-            return result;
+        // Create models from mesh data (UV4 and node hierarchy are required by HeightMapAligner)
+        std::vector<std::shared_ptr<PlateauModel>> models(group_count);
+        for (int g = 0; g < group_count; g++) {
+            models[g] = plateau_utils::create_model_from_mesh_data(groups[g], true);
+            if (!models[g]) {
+                UtilityFunctions::printerr("PLATEAUHeightMapAligner: failed to create model from mesh data");
+                return result;
+            }
         }
 
+        // The first group uses the cached aligner; the others use cached worker aligners,
+        // which are only rebuilt when the frames, height offset or thread count change
+        std::vector<std::unique_ptr<HeightMapAligner>> &worker_aligners = get_cached_worker_aligners(group_count - 1);
+
         // Perform alignment
-        aligner.align(*model, max_edge_length_);
+        std::vector<std::string> errors(group_count);
+        plateau_parallel::parallel_for(0, static_cast<size_t>(group_count), [&](size_t g) {
+            try {
+                HeightMapAligner &group_aligner = g == 0 ? aligner : *worker_aligners[g - 1];
+                group_aligner.align(*models[g], max_edge_length_);
+            } catch (const std::exception &e) {
+                errors[g] = e.what();
+            }
+        }, 1, static_cast<unsigned int>(group_count));
 
-        // Copy input to result and update with aligned data
-        for (int i = 0; i < mesh_data_array.size(); i++) {
+        for (const std::string &error : errors) {
+            if (!error.empty()) {
+                UtilityFunctions::printerr("Exception during alignment: ", String(error.c_str()));
+                return result;
+            }
+        }
+
+        // Copy input to result and update with aligned data, in input order
+        for (int g = 0; g < group_count; g++) {
+            update_mesh_data_from_model(groups[g], *models[g], rewrite_in_place);
+        }
+        for (int i = 0; i < mesh_count; i++) {
             result.push_back(mesh_data_array[i]);
         }
-        update_mesh_data_from_model(result, *model);
 
-        UtilityFunctions::print("Aligned ", result.size(), " mesh(es) to terrain");
+        UtilityFunctions::print("Aligned ", result.size(), " mesh(es) to terrain",
+                                group_count > 1 ? String(" using ") + String::num_int64(group_count) + " threads" : String());
 
     } catch (const std::exception &e) {
         UtilityFunctions::printerr("Exception during alignment: ", String(e.what()));
     }
-#endif
 
     return result;
 }
 
+// True if this mesh or any descendant has one of the given names / GML IDs
+static bool mesh_tree_matches_ids(const Ref<PLATEAUMeshData> &mesh_data, const HashSet<String> &ids) {
+    if (ids.has(mesh_data->get_name()) || (!mesh_data->get_gml_id().is_empty() && ids.has(mesh_data->get_gml_id()))) {
+        return true;
+    }
+    TypedArray<PLATEAUMeshData> children = mesh_data->get_children();
+    for (int i = 0; i < children.size(); i++) {
+        Ref<PLATEAUMeshData> child = children[i];
+        if (child.is_valid() && mesh_tree_matches_ids(child, ids)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// True if this mesh or any descendant has XZ bounds overlapping the region
+static bool mesh_tree_intersects_region(const Ref<PLATEAUMeshData> &mesh_data, const Transform3D &parent_transform, const Rect2 &xz_region) {
+    Transform3D transform = parent_transform * mesh_data->get_transform();
+    Ref<ArrayMesh> mesh = mesh_data->get_mesh();
+    if (mesh.is_valid() && mesh->get_surface_count() > 0) {
+        AABB bounds = transform.xform(mesh->get_aabb());
+        Rect2 xz_bounds(bounds.position.x, bounds.position.z, bounds.size.x, bounds.size.z);
+        if (xz_bounds.intersects(xz_region, true)) {
+            return true;
+        }
+    }
+    TypedArray<PLATEAUMeshData> children = mesh_data->get_children();
+    for (int i = 0; i < children.size(); i++) {
+        Ref<PLATEAUMeshData> child = children[i];
+        if (child.is_valid() && mesh_tree_intersects_region(child, transform, xz_region)) {
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
+TypedArray<PLATEAUMeshData> PLATEAUHeightMapAligner::align_dirty(const TypedArray<PLATEAUMeshData> &mesh_data_array, const PackedStringArray &dirty_ids) {
+    TypedArray<PLATEAUMeshData> dirty_meshes;
+
+#ifdef PLATEAU_MOBILE_PLATFORM
+    PLATEAU_MOBILE_UNSUPPORTED_V(dirty_meshes);
+#endif
+
+#ifndef PLATEAU_MOBILE_PLATFORM
+    ERR_FAIL_COND_V_MSG(heightmap_refs_.empty(), dirty_meshes, "PLATEAUHeightMapAligner: no heightmaps registered.");
+
+    HashSet<String> ids;
+    for (int i = 0; i < dirty_ids.size(); i++) {
+        ids.insert(dirty_ids[i]);
+    }
+
+    // Whole root subtrees are re-aligned so parent transforms stay intact
+    for (int i = 0; i < mesh_data_array.size(); i++) {
+        Ref<PLATEAUMeshData> mesh_data = mesh_data_array[i];
+        if (mesh_data.is_valid() && mesh_tree_matches_ids(mesh_data, ids)) {
+            dirty_meshes.push_back(mesh_data);
+        }
+    }
+
+    if (dirty_meshes.is_empty()) {
+        return dirty_meshes;
+    }
+    return align_meshes(dirty_meshes, true);
+#endif
+}
+
+TypedArray<PLATEAUMeshData> PLATEAUHeightMapAligner::align_region(const TypedArray<PLATEAUMeshData> &mesh_data_array, const Rect2 &xz_region) {
+    TypedArray<PLATEAUMeshData> dirty_meshes;
+
+#ifdef PLATEAU_MOBILE_PLATFORM
+    PLATEAU_MOBILE_UNSUPPORTED_V(dirty_meshes);
+#endif
+
+#ifndef PLATEAU_MOBILE_PLATFORM
+    ERR_FAIL_COND_V_MSG(heightmap_refs_.empty(), dirty_meshes, "PLATEAUHeightMapAligner: no heightmaps registered.");
+
+    for (int i = 0; i < mesh_data_array.size(); i++) {
+        Ref<PLATEAUMeshData> mesh_data = mesh_data_array[i];
+        if (mesh_data.is_valid() && mesh_tree_intersects_region(mesh_data, Transform3D(), xz_region)) {
+            dirty_meshes.push_back(mesh_data);
+        }
+    }
+
+    if (dirty_meshes.is_empty()) {
+        return dirty_meshes;
+    }
+    return align_meshes(dirty_meshes, true);
+#endif
+}
+
 TypedArray<PLATEAUHeightMapData> PLATEAUHeightMapAligner::align_invert(const TypedArray<PLATEAUMeshData> &mesh_data_array) {
     TypedArray<PLATEAUHeightMapData> result;
 
@@ -169,30 +418,14 @@ TypedArray<PLATEAUHeightMapData> PLATEAUHeightMapAligner::align_invert(const Typ
     ERR_FAIL_COND_V_MSG(mesh_data_array.is_empty(), result, "PLATEAUHeightMapAligner: mesh_data_array is empty.");
 
     try {
-        // Create HeightMapAligner
+        // alignInvert modifies its frames, so each call starts from copies of the cached frames
         HeightMapAligner aligner(height_offset_, plateau::geometry::CoordinateSystem::EUN);
-
-        // Add all heightmap frames
-        for (const auto &heightmap_ref : heightmap_refs_) {
-            TVec3d min = heightmap_ref->get_min_internal();
-            TVec3d max = heightmap_ref->get_max_internal();
-            const auto &heightmap_data = heightmap_ref->get_heightmap_internal();
-
-            HeightMapFrame frame(
-                heightmap_data,
-                heightmap_ref->get_width(),
-                heightmap_ref->get_height(),
-                static_cast<float>(min.x), static_cast<float>(max.x),
-                static_cast<float>(min.y), static_cast<float>(max.y),
-                static_cast<float>(min.z), static_cast<float>(max.z),
-                plateau::geometry::CoordinateSystem::EUN
-            );
-
+        for (const auto &frame : get_cached_invert_frames()) {
             aligner.addHeightmapFrame(frame);
         }
 
-        // Create model from mesh data
-        auto model = create_model_from_mesh_data(mesh_data_array);
+        // Create model from mesh data (UV4 and node hierarchy are required by HeightMapAligner)
+        auto model = plateau_utils::create_model_from_mesh_data(mesh_data_array, true);
         if (!model) {
             UtilityFunctions::printerr("PLATEAUHeightMapAligner: failed to create model from mesh data");
             return result;
@@ -250,177 +483,153 @@ double PLATEAUHeightMapAligner::get_height_at(const Vector2 &xz_position) const
         return std::nan("");
     }
 
-    // Check each heightmap to find one that contains this position
-    for (const auto &heightmap_ref : heightmap_refs_) {
-        TVec3d min = heightmap_ref->get_min_internal();
-        TVec3d max = heightmap_ref->get_max_internal();
-
-        // Check if position is within this heightmap's bounds
-        if (xz_position.x >= min.x && xz_position.x <= max.x &&
-            xz_position.y >= min.z && xz_position.y <= max.z) {
-
-            // Create a temporary HeightMapFrame to use posToHeight
-            const auto &heightmap_data = heightmap_ref->get_heightmap_internal();
-            HeightMapFrame frame(
-                heightmap_data,
-                heightmap_ref->get_width(),
-                heightmap_ref->get_height(),
-                static_cast<float>(min.x), static_cast<float>(max.x),
-                static_cast<float>(min.y), static_cast<float>(max.y),
-                static_cast<float>(min.z), static_cast<float>(max.z),
-                plateau::geometry::CoordinateSystem::EUN
-            );
+    ensure_height_lookup();
+    return lookup_height(xz_position.x, xz_position.y);
+#endif
+}
 
-            return frame.posToHeight(TVec2d(xz_position.x, xz_position.y), height_offset_);
-        }
-    }
+PackedFloat64Array PLATEAUHeightMapAligner::get_heights_at(const PackedVector2Array &xz_positions) const {
+    PackedFloat64Array result;
 
-    return std::nan("");
+#ifdef PLATEAU_MOBILE_PLATFORM
+    PLATEAU_MOBILE_UNSUPPORTED_V(result);
 #endif
-}
 
 #ifndef PLATEAU_MOBILE_PLATFORM
-std::shared_ptr<PlateauModel> PLATEAUHeightMapAligner::create_model_from_mesh_data(
-    const TypedArray<PLATEAUMeshData> &mesh_data_array) {
-
-    auto model = std::make_shared<PlateauModel>();
+    result.resize(xz_positions.size());
+    if (xz_positions.is_empty()) {
+        return result;
+    }
 
-    for (int i = 0; i < mesh_data_array.size(); i++) {
-        Ref<PLATEAUMeshData> mesh_data = mesh_data_array[i];
-        if (mesh_data.is_null()) {
-            continue;
-        }
+    double *heights = result.ptrw();
+    if (heightmap_refs_.empty()) {
+        std::fill(heights, heights + result.size(), std::nan(""));
+        return result;
+    }
 
-        // Create a root node for each mesh data
-        auto node = PlateauNode(mesh_data->get_name().utf8().get_data());
+    ensure_height_lookup();
 
-        // Set transform
-        Transform3D t = mesh_data->get_transform();
-        node.setLocalPosition(TVec3d(t.origin.x, t.origin.y, t.origin.z));
+    // The lookup is read-only from here on, so queries can run concurrently
+    const Vector2 *positions = xz_positions.ptr();
+    plateau_parallel::parallel_for(0, static_cast<size_t>(xz_positions.size()), [&](size_t i) {
+        heights[i] = lookup_height(positions[i].x, positions[i].y);
+    }, 4096);
+#endif
 
-        // Add mesh if present
-        add_mesh_data_to_node(node, mesh_data);
+    return result;
+}
 
-        model->addNode(std::move(node));
-    }
+#ifndef PLATEAU_MOBILE_PLATFORM
+bool PLATEAUHeightMapAligner::HeightSampler::contains(double x, double z) const {
+    return x >= min_x && x <= max_x && z >= min_z && z <= max_z;
+}
 
-    // Assign node hierarchy (required for HeightMapAligner)
-    model->assignNodeHierarchy();
+void PLATEAUHeightMapAligner::ensure_height_lookup() const {
+    std::lock_guard<std::mutex> lock(lookup_mutex_);
 
-    return model;
+    // Heightmaps replaced through set_data() (e.g. by align_invert) invalidate the lookup
+    bool valid = lookup_valid_ && samplers_.size() == heightmap_refs_.size();
+    for (size_t i = 0; valid && i < samplers_.size(); i++) {
+        valid = samplers_[i].revision == heightmap_refs_[i]->get_revision_internal();
+    }
+    if (!valid) {
+        rebuild_height_lookup();
+    }
 }
 
-void PLATEAUHeightMapAligner::add_mesh_data_to_node(
-    PlateauNode &parent_node,
-    const Ref<PLATEAUMeshData> &mesh_data) {
-
-    if (mesh_data.is_null()) {
+void PLATEAUHeightMapAligner::rebuild_height_lookup() const {
+    samplers_.clear();
+    lookup_cells_.clear();
+    lookup_cols_ = 0;
+    lookup_rows_ = 0;
+    lookup_valid_ = true;
+    if (heightmap_refs_.empty()) {
         return;
     }
 
-    Ref<ArrayMesh> godot_mesh = mesh_data->get_mesh();
-    if (godot_mesh.is_valid() && godot_mesh->get_surface_count() > 0) {
-        // Convert Godot mesh to plateau mesh
-        PlateauMesh native_mesh;
-
-        // Collect all vertices and indices from all surfaces
-        std::vector<TVec3d> all_vertices;
-        std::vector<unsigned int> all_indices;
-        std::vector<TVec2f> all_uvs;
-        unsigned int vertex_offset = 0;
-
-        for (int surf_idx = 0; surf_idx < godot_mesh->get_surface_count(); surf_idx++) {
-            Array arrays = godot_mesh->surface_get_arrays(surf_idx);
-            if (arrays.size() <= Mesh::ARRAY_VERTEX) {
-                continue;
-            }
-
-            Variant vertex_var = arrays[Mesh::ARRAY_VERTEX];
-            if (vertex_var.get_type() != Variant::PACKED_VECTOR3_ARRAY) {
-                continue;
-            }
-
-            PackedVector3Array vertices = vertex_var;
-            if (vertices.is_empty()) {
-                continue;
-            }
-
-            // Get indices
-            PackedInt32Array indices;
-            if (arrays.size() > Mesh::ARRAY_INDEX &&
-                arrays[Mesh::ARRAY_INDEX].get_type() == Variant::PACKED_INT32_ARRAY) {
-                indices = arrays[Mesh::ARRAY_INDEX];
-            }
-            if (indices.is_empty()) {
-                continue;
-            }
+    double min_x = std::numeric_limits<double>::max();
+    double min_z = std::numeric_limits<double>::max();
+    double max_x = std::numeric_limits<double>::lowest();
+    double max_z = std::numeric_limits<double>::lowest();
 
-            // Add vertices
-            for (int j = 0; j < vertices.size(); j++) {
-                Vector3 v = vertices[j];
-                all_vertices.push_back(TVec3d(v.x, v.y, v.z));
-            }
+    samplers_.reserve(heightmap_refs_.size());
+    for (const auto &heightmap_ref : heightmap_refs_) {
+        TVec3d min = heightmap_ref->get_min_internal();
+        TVec3d max = heightmap_ref->get_max_internal();
 
-            // Add indices with offset
-            for (int j = 0; j < indices.size(); j++) {
-                all_indices.push_back(static_cast<unsigned int>(indices[j]) + vertex_offset);
-            }
+        // The frame is built once per heightmap revision instead of once per query
+        HeightSampler sampler;
+        sampler.frame = std::make_shared<const HeightMapFrame>(
+            create_height_map_frame(heightmap_ref, plateau::geometry::CoordinateSystem::EUN));
+        sampler.min_x = min.x;
+        sampler.min_z = min.z;
+        sampler.max_x = max.x;
+        sampler.max_z = max.z;
+        sampler.revision = heightmap_ref->get_revision_internal();
+        samplers_.push_back(sampler);
+
+        min_x = std::min(min_x, min.x);
+        min_z = std::min(min_z, min.z);
+        max_x = std::max(max_x, max.x);
+        max_z = std::max(max_z, max.z);
+    }
 
-            // Add UVs
-            if (arrays.size() > Mesh::ARRAY_TEX_UV &&
-                arrays[Mesh::ARRAY_TEX_UV].get_type() == Variant::PACKED_VECTOR2_ARRAY) {
-                PackedVector2Array uvs = arrays[Mesh::ARRAY_TEX_UV];
-                for (int j = 0; j < uvs.size(); j++) {
-                    Vector2 uv = uvs[j];
-                    all_uvs.push_back(TVec2f(uv.x, 1.0f - uv.y));
-                }
-            } else {
-                // Add placeholder UVs
-                for (int j = 0; j < vertices.size(); j++) {
-                    all_uvs.push_back(TVec2f(0.0f, 0.0f));
-                }
+    // About two cells per heightmap along each axis keeps candidate lists short
+    int divisions = std::clamp(static_cast<int>(std::ceil(std::sqrt(static_cast<double>(samplers_.size())))) * 2, 1, 256);
+    lookup_cols_ = divisions;
+    lookup_rows_ = divisions;
+    lookup_min_x_ = min_x;
+    lookup_min_z_ = min_z;
+    lookup_cell_x_ = std::max((max_x - min_x) / lookup_cols_, 1e-6);
+    lookup_cell_z_ = std::max((max_z - min_z) / lookup_rows_, 1e-6);
+    lookup_cells_.resize(static_cast<size_t>(lookup_cols_) * lookup_rows_);
+
+    for (int i = 0; i < static_cast<int>(samplers_.size()); i++) {
+        const HeightSampler &sampler = samplers_[i];
+        int col0 = std::clamp(static_cast<int>((sampler.min_x - lookup_min_x_) / lookup_cell_x_), 0, lookup_cols_ - 1);
+        int col1 = std::clamp(static_cast<int>((sampler.max_x - lookup_min_x_) / lookup_cell_x_), 0, lookup_cols_ - 1);
+        int row0 = std::clamp(static_cast<int>((sampler.min_z - lookup_min_z_) / lookup_cell_z_), 0, lookup_rows_ - 1);
+        int row1 = std::clamp(static_cast<int>((sampler.max_z - lookup_min_z_) / lookup_cell_z_), 0, lookup_rows_ - 1);
+        for (int row = row0; row <= row1; row++) {
+            for (int col = col0; col <= col1; col++) {
+                lookup_cells_[static_cast<size_t>(row) * lookup_cols_ + col].push_back(i);
             }
-
-            vertex_offset += static_cast<unsigned int>(vertices.size());
         }
+    }
+}
 
-        // Add to native mesh if valid data collected
-        if (!all_vertices.empty() && !all_indices.empty() && all_indices.size() % 3 == 0) {
-            native_mesh.addVerticesList(all_vertices);
-            native_mesh.addIndicesList(all_indices, 0, false);
-            native_mesh.addSubMesh("", nullptr, 0, all_indices.size() - 1, -1);
-
-            // Set UVs if collected (both UV1 and UV4 are required by OpenMeshConverter)
-            if (!all_uvs.empty()) {
-                // Create a copy for UV4 (HeightMapAligner requires both UV1 and UV4)
-                std::vector<TVec2f> all_uvs_copy = all_uvs;
-                native_mesh.setUV1(std::move(all_uvs));
-                native_mesh.setUV4(std::move(all_uvs_copy));
-            }
-
-            parent_node.setMesh(std::make_unique<PlateauMesh>(std::move(native_mesh)));
-        }
+double PLATEAUHeightMapAligner::lookup_height(double x, double z) const {
+    if (lookup_cells_.empty()) {
+        return std::nan("");
     }
 
-    // Process children recursively
-    TypedArray<PLATEAUMeshData> children = mesh_data->get_children();
-    for (int i = 0; i < children.size(); i++) {
-        Ref<PLATEAUMeshData> child = children[i];
-        if (child.is_valid()) {
-            auto child_node = PlateauNode(child->get_name().utf8().get_data());
-            Transform3D t = child->get_transform();
-            child_node.setLocalPosition(TVec3d(t.origin.x, t.origin.y, t.origin.z));
+    int col = static_cast<int>(std::floor((x - lookup_min_x_) / lookup_cell_x_));
+    int row = static_cast<int>(std::floor((z - lookup_min_z_) / lookup_cell_z_));
+    // Positions exactly on the far edge belong to the last cell
+    col = col == lookup_cols_ ? col - 1 : col;
+    row = row == lookup_rows_ ? row - 1 : row;
+    if (col < 0 || row < 0 || col >= lookup_cols_ || row >= lookup_rows_) {
+        return std::nan("");
+    }
 
-            add_mesh_data_to_node(child_node, child);
-            parent_node.addChildNode(std::move(child_node));
+    // First registered heightmap containing the position wins, as before
+    for (int index : lookup_cells_[static_cast<size_t>(row) * lookup_cols_ + col]) {
+        const HeightSampler &sampler = samplers_[index];
+        if (sampler.contains(x, z)) {
+            return sampler.frame->posToHeight(TVec2d(x, z), height_offset_);
         }
     }
+
+    return std::nan("");
 }
+#endif
 
+#ifndef PLATEAU_MOBILE_PLATFORM
 // Helper function to update a single mesh from node
 void PLATEAUHeightMapAligner::update_single_mesh_from_node(
     Ref<PLATEAUMeshData> &mesh_data,
-    const PlateauNode &node) {
+    const PlateauNode &node,
+    bool rewrite_in_place) {
 
     const PlateauMesh *native_mesh = node.getMesh();
     if (native_mesh == nullptr || !native_mesh->hasVertices()) {
@@ -505,10 +714,6 @@ void PLATEAUHeightMapAligner::update_single_mesh_from_node(
         }
     }
 
-    // Create new mesh
-    Ref<ArrayMesh> new_mesh;
-    new_mesh.instantiate();
-
     Array arrays;
     arrays.resize(Mesh::ARRAY_MAX);
     arrays[Mesh::ARRAY_VERTEX] = godot_vertices;
@@ -518,14 +723,26 @@ void PLATEAUHeightMapAligner::update_single_mesh_from_node(
         arrays[Mesh::ARRAY_TEX_UV] = godot_uvs;
     }
 
-    new_mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
+    Ref<Material> material = godot_mesh->surface_get_material(0);
 
-    // Copy material from original mesh
-    if (godot_mesh->get_surface_count() > 0) {
-        Ref<Material> material = godot_mesh->surface_get_material(0);
+    // Rewrite the existing ArrayMesh so every MeshInstance3D sharing it picks up the change
+    if (rewrite_in_place) {
+        godot_mesh->clear_surfaces();
+        godot_mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
         if (material.is_valid()) {
-            new_mesh->surface_set_material(0, material);
+            godot_mesh->surface_set_material(0, material);
         }
+        return;
+    }
+
+    // Create new mesh
+    Ref<ArrayMesh> new_mesh;
+    new_mesh.instantiate();
+    new_mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
+
+    // Copy material from original mesh
+    if (material.is_valid()) {
+        new_mesh->surface_set_material(0, material);
     }
 
     mesh_data->set_mesh(new_mesh);
@@ -534,10 +751,11 @@ void PLATEAUHeightMapAligner::update_single_mesh_from_node(
 // Recursive helper to update mesh data from node hierarchy
 void PLATEAUHeightMapAligner::update_node_recursive(
     Ref<PLATEAUMeshData> &mesh_data,
-    const PlateauNode &node) {
+    const PlateauNode &node,
+    bool rewrite_in_place) {
 
     // Update this node's mesh
-    update_single_mesh_from_node(mesh_data, node);
+    update_single_mesh_from_node(mesh_data, node, rewrite_in_place);
 
     // Process children
     TypedArray<PLATEAUMeshData> children = mesh_data->get_children();
@@ -545,14 +763,15 @@ void PLATEAUHeightMapAligner::update_node_recursive(
         const auto &child_node = node.getChildAt(i);
         Ref<PLATEAUMeshData> child_mesh_data = children[i];
         if (child_mesh_data.is_valid()) {
-            update_node_recursive(child_mesh_data, child_node);
+            update_node_recursive(child_mesh_data, child_node, rewrite_in_place);
         }
     }
 }
 
 void PLATEAUHeightMapAligner::update_mesh_data_from_model(
     TypedArray<PLATEAUMeshData> &mesh_data_array,
-    const PlateauModel &model) {
+    const PlateauModel &model,
+    bool rewrite_in_place) {
 
     for (size_t i = 0; i < model.getRootNodeCount() && i < static_cast<size_t>(mesh_data_array.size()); i++) {
         const auto &node = model.getRootNodeAt(i);
@@ -563,7 +782,7 @@ void PLATEAUHeightMapAligner::update_mesh_data_from_model(
         }
 
         // Recursively update this node and all children
-        update_node_recursive(mesh_data, node);
+        update_node_recursive(mesh_data, node, rewrite_in_place);
     }
 }
 #endif
@@ -593,11 +812,18 @@ void PLATEAUHeightMapAligner::_bind_methods() {
     ClassDB::bind_method(D_METHOD("get_skip_threshold_distance"), &PLATEAUHeightMapAligner::get_skip_threshold_distance);
     ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "skip_threshold_distance"), "set_skip_threshold_distance", "get_skip_threshold_distance");
 
+    ClassDB::bind_method(D_METHOD("set_align_threads", "threads"), &PLATEAUHeightMapAligner::set_align_threads);
+    ClassDB::bind_method(D_METHOD("get_align_threads"), &PLATEAUHeightMapAligner::get_align_threads);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "align_threads"), "set_align_threads", "get_align_threads");
+
     ClassDB::bind_method(D_METHOD("add_heightmap", "heightmap_data"), &PLATEAUHeightMapAligner::add_heightmap);
     ClassDB::bind_method(D_METHOD("clear_heightmaps"), &PLATEAUHeightMapAligner::clear_heightmaps);
     ClassDB::bind_method(D_METHOD("get_heightmap_count"), &PLATEAUHeightMapAligner::get_heightmap_count);
 
     ClassDB::bind_method(D_METHOD("align", "mesh_data_array"), &PLATEAUHeightMapAligner::align);
+    ClassDB::bind_method(D_METHOD("align_dirty", "mesh_data_array", "dirty_ids"), &PLATEAUHeightMapAligner::align_dirty);
+    ClassDB::bind_method(D_METHOD("align_region", "mesh_data_array", "xz_region"), &PLATEAUHeightMapAligner::align_region);
     ClassDB::bind_method(D_METHOD("align_invert", "mesh_data_array"), &PLATEAUHeightMapAligner::align_invert);
     ClassDB::bind_method(D_METHOD("get_height_at", "xz_position"), &PLATEAUHeightMapAligner::get_height_at);
+    ClassDB::bind_method(D_METHOD("get_heights_at", "xz_positions"), &PLATEAUHeightMapAligner::get_heights_at);
 }
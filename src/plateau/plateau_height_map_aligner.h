@@ -14,6 +14,10 @@
 #include "plateau_terrain.h"
 #include "plateau_city_model.h"
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace godot {
 
 /**
@@ -66,6 +70,11 @@ public:
     void set_skip_threshold_distance(float distance);
     float get_skip_threshold_distance() const;
 
+    // Worker threads for align(): root meshes are split into contiguous groups aligned
+    // in parallel against the same frames. 1 = single-threaded, 0 = one per CPU core
+    void set_align_threads(int threads);
+    int get_align_threads() const;
+
     // Add a heightmap to use for alignment
     // Multiple heightmaps can be added for areas with multiple terrain pieces
     void add_heightmap(const Ref<PLATEAUHeightMapData> &heightmap_data);
@@ -81,6 +90,17 @@ public:
     // Input meshes are modified in place when possible
     TypedArray<PLATEAUMeshData> align(const TypedArray<PLATEAUMeshData> &mesh_data_array);
 
+    // Incremental re-alignment for interactive editing. Only root meshes whose subtree
+    // matches the dirty set are re-aligned; their existing ArrayMesh surfaces are rewritten
+    // in place so MeshInstance3Ds using them update immediately.
+    // Returns the re-aligned root meshes.
+
+    // Dirty set given as mesh names or GML IDs
+    TypedArray<PLATEAUMeshData> align_dirty(const TypedArray<PLATEAUMeshData> &mesh_data_array, const PackedStringArray &dirty_ids);
+
+    // Dirty set given as an edited XZ region (e.g. a modified terrain area)
+    TypedArray<PLATEAUMeshData> align_region(const TypedArray<PLATEAUMeshData> &mesh_data_array, const Rect2 &xz_region);
+
     // Align heightmaps to model heights (inverse)
     // Used for aligning terrain to roads, etc.
     // Returns array of updated PLATEAUHeightMapData
@@ -90,6 +110,10 @@ public:
     // Returns NaN if position is outside all heightmaps
     double get_height_at(const Vector2 &xz_position) const;
 
+    // Batch version of get_height_at, evaluated in parallel
+    // Positions outside all heightmaps yield NaN
+    PackedFloat64Array get_heights_at(const PackedVector2Array &xz_positions) const;
+
 protected:
     static void _bind_methods();
 
@@ -100,33 +124,78 @@ private:
     int alpha_averaging_width_;
     double invert_height_offset_;
     float skip_threshold_distance_;
+    int align_threads_;
 
     std::vector<Ref<PLATEAUHeightMapData>> heightmap_refs_;
 
 #ifndef PLATEAU_MOBILE_PLATFORM
-    // Internal helper: Convert PLATEAUMeshData array to plateau::polygonMesh::Model
-    std::shared_ptr<plateau::polygonMesh::Model> create_model_from_mesh_data(
-        const TypedArray<PLATEAUMeshData> &mesh_data_array);
+    // Prepared libplateau frame for one heightmap, queried with HeightMapFrame::posToHeight
+    struct HeightSampler {
+        std::shared_ptr<const plateau::heightMapAligner::HeightMapFrame> frame;
+        double min_x;
+        double min_z;
+        double max_x;
+        double max_z;
+        uint64_t revision;
+
+        bool contains(double x, double z) const;
+    };
+
+    // Uniform grid over the heightmap extents; each cell lists overlapping heightmaps in
+    // registration order. Rebuilt lazily after heightmaps are added, cleared or modified.
+    mutable std::vector<HeightSampler> samplers_;
+    mutable std::vector<std::vector<int>> lookup_cells_;
+    mutable int lookup_cols_;
+    mutable int lookup_rows_;
+    mutable double lookup_min_x_;
+    mutable double lookup_min_z_;
+    mutable double lookup_cell_x_;
+    mutable double lookup_cell_z_;
+    mutable bool lookup_valid_;
+    mutable std::mutex lookup_mutex_;
+
+    void ensure_height_lookup() const;
+    void rebuild_height_lookup() const;
+    double lookup_height(double x, double z) const;
+
+    // Prepared libplateau frames, reused across align()/align_invert() calls.
+    // Invalidated when heightmaps are added/cleared or their data revision changes.
+    std::unique_ptr<plateau::heightMapAligner::HeightMapAligner> align_cache_;
+    double align_cache_height_offset_;
+    // Aligners for the extra align() worker groups (an aligner is not shared across threads).
+    // Each holds its own frames, built once and kept until the frames or height offset change
+    std::vector<std::unique_ptr<plateau::heightMapAligner::HeightMapAligner>> worker_aligner_cache_;
+    std::vector<plateau::heightMapAligner::HeightMapFrame> invert_frames_cache_;
+    std::vector<uint64_t> frame_cache_revisions_;
+
+    bool is_frame_cache_current() const;
+    void invalidate_frame_cache();
+    plateau::heightMapAligner::HeightMapAligner &get_cached_aligner();
+    std::vector<std::unique_ptr<plateau::heightMapAligner::HeightMapAligner>> &get_cached_worker_aligners(int count);
+    const std::vector<plateau::heightMapAligner::HeightMapFrame> &get_cached_invert_frames();
+#endif
+
+#ifndef PLATEAU_MOBILE_PLATFORM
+    // Internal helper: Align meshes, optionally rewriting their ArrayMesh surfaces in place
+    TypedArray<PLATEAUMeshData> align_meshes(const TypedArray<PLATEAUMeshData> &mesh_data_array, bool rewrite_in_place);
 
     // Internal helper: Update PLATEAUMeshData from aligned Model
     void update_mesh_data_from_model(
         TypedArray<PLATEAUMeshData> &mesh_data_array,
-        const plateau::polygonMesh::Model &model);
-
-    // Internal helper: Convert single MeshData to Node
-    void add_mesh_data_to_node(
-        plateau::polygonMesh::Node &parent_node,
-        const Ref<PLATEAUMeshData> &mesh_data);
+        const plateau::polygonMesh::Model &model,
+        bool rewrite_in_place);
 
     // Internal helper: Update single mesh from node
     void update_single_mesh_from_node(
         Ref<PLATEAUMeshData> &mesh_data,
-        const plateau::polygonMesh::Node &node);
+        const plateau::polygonMesh::Node &node,
+        bool rewrite_in_place);
 
     // Internal helper: Recursively update mesh data from node hierarchy
     void update_node_recursive(
         Ref<PLATEAUMeshData> &mesh_data,
-        const plateau::polygonMesh::Node &node);
+        const plateau::polygonMesh::Node &node,
+        bool rewrite_in_place);
 #endif
 };
 
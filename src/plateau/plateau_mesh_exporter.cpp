@@ -1,11 +1,30 @@
 #include "plateau_mesh_exporter.h"
 #include "plateau_platform.h"
+#include "plateau_parallel.h"
 #include <godot_cpp/variant/utility_functions.hpp>
 #include <godot_cpp/classes/array_mesh.hpp>
+#include <godot_cpp/classes/dir_access.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/json.hpp>
+#include <godot_cpp/classes/time.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace godot;
 
 #include "plateau_types.h"
+#include "plateau_mesh_utils.h"
 
 // Type aliases for file-local types
 using GltfWriter = plateau::meshWriter::GltfWriter;
@@ -14,7 +33,10 @@ using GltfFileFormat = plateau::meshWriter::GltfFileFormat;
 using ObjWriter = plateau::meshWriter::ObjWriter;
 
 PLATEAUMeshExporter::PLATEAUMeshExporter()
-    : texture_directory_("") {
+    : texture_directory_(""),
+      max_concurrent_exports_(0),
+      mesh_quantization_(false),
+      meshopt_compression_(false) {
 }
 
 PLATEAUMeshExporter::~PLATEAUMeshExporter() {
@@ -28,6 +50,1155 @@ String PLATEAUMeshExporter::get_texture_directory() const {
     return texture_directory_;
 }
 
+void PLATEAUMeshExporter::set_mesh_quantization(bool enable) {
+    mesh_quantization_ = enable;
+}
+
+bool PLATEAUMeshExporter::get_mesh_quantization() const {
+    return mesh_quantization_;
+}
+
+void PLATEAUMeshExporter::set_meshopt_compression(bool enable) {
+    meshopt_compression_ = enable;
+}
+
+bool PLATEAUMeshExporter::get_meshopt_compression() const {
+    return meshopt_compression_;
+}
+
+Dictionary PLATEAUMeshExporter::get_last_export_report() const {
+    return last_export_report_;
+}
+
+void PLATEAUMeshExporter::set_max_concurrent_exports(int count) {
+    max_concurrent_exports_ = Math::max(count, 0);
+}
+
+int PLATEAUMeshExporter::get_max_concurrent_exports() const {
+    return max_concurrent_exports_;
+}
+
+// ============================================================================
+// glTF mesh quantization (KHR_mesh_quantization)
+// ============================================================================
+
+static const uint32_t GLB_MAGIC = 0x46546C67;          // "glTF"
+static const uint32_t GLB_CHUNK_JSON = 0x4E4F534A;     // "JSON"
+static const uint32_t GLB_CHUNK_BIN = 0x004E4942;      // "BIN\0"
+
+static const int GLTF_BYTE = 5120;
+static const int GLTF_UNSIGNED_SHORT = 5123;
+static const int GLTF_UNSIGNED_INT = 5125;
+static const int GLTF_FLOAT = 5126;
+static const int GLTF_ARRAY_BUFFER = 34962;
+static const int GLTF_ELEMENT_ARRAY_BUFFER = 34963;
+
+// A glTF / GLB file with its (single) binary buffer
+struct LoadedGltf {
+    Dictionary json;
+    PackedByteArray bin;
+    String bin_path;        // External buffer file (glTF only)
+    int64_t total_bytes = 0;
+};
+
+struct QuantizeResult {
+    bool success = false;
+    int64_t original_bytes = 0;
+    int64_t output_bytes = 0;
+    int quantized_meshes = 0;
+};
+
+enum QuantizeKind {
+    QUANTIZE_POSITION,
+    QUANTIZE_NORMAL,
+    QUANTIZE_TEXCOORD,
+    QUANTIZE_INDICES,
+};
+
+// Accessor data inside the binary buffer, resolved on the calling thread
+struct QuantizeSource {
+    int accessor;
+    int64_t offset;
+    int64_t stride;
+    int64_t count;
+};
+
+struct QuantizeJob {
+    QuantizeKind kind;
+    int mesh = -1;                              // POSITION: all position accessors of one mesh share a transform
+    std::vector<QuantizeSource> sources;
+
+    bool ok = false;
+    std::vector<std::vector<uint8_t>> outputs;  // One per source
+    std::vector<std::array<int, 6>> bounds;     // POSITION: quantized min xyz / max xyz per source
+    double origin[3] = { 0.0, 0.0, 0.0 };
+    double step = 1.0;                          // POSITION: model units per quantization step
+};
+
+static bool load_gltf_file(const String &file_path, bool binary, LoadedGltf &out) {
+    PackedByteArray file_bytes = FileAccess::get_file_as_bytes(file_path);
+    if (file_bytes.size() < 20) {
+        return false;
+    }
+
+    String json_text;
+    if (binary) {
+        const uint8_t *ptr = file_bytes.ptr();
+        uint32_t magic, version, json_length, json_type;
+        memcpy(&magic, ptr, 4);
+        memcpy(&version, ptr + 4, 4);
+        memcpy(&json_length, ptr + 12, 4);
+        memcpy(&json_type, ptr + 16, 4);
+        if (magic != GLB_MAGIC || version != 2 || json_type != GLB_CHUNK_JSON || 20 + static_cast<int64_t>(json_length) > file_bytes.size()) {
+            return false;
+        }
+        json_text = String::utf8(reinterpret_cast<const char *>(ptr + 20), json_length);
+
+        int64_t bin_start = 20 + static_cast<int64_t>(json_length);
+        if (bin_start + 8 <= file_bytes.size()) {
+            uint32_t bin_length, bin_type;
+            memcpy(&bin_length, ptr + bin_start, 4);
+            memcpy(&bin_type, ptr + bin_start + 4, 4);
+            if (bin_type == GLB_CHUNK_BIN && bin_start + 8 + static_cast<int64_t>(bin_length) <= file_bytes.size()) {
+                out.bin = file_bytes.slice(bin_start + 8, bin_start + 8 + bin_length);
+            }
+        }
+    } else {
+        json_text = String::utf8(reinterpret_cast<const char *>(file_bytes.ptr()), file_bytes.size());
+    }
+
+    Variant parsed = JSON::parse_string(json_text);
+    if (parsed.get_type() != Variant::DICTIONARY) {
+        return false;
+    }
+    out.json = parsed;
+    out.total_bytes = file_bytes.size();
+
+    // libplateau writes a single buffer (GLB chunk or one external .bin)
+    Array buffers = out.json.get("buffers", Array());
+    if (buffers.size() != 1) {
+        return false;
+    }
+    if (!binary) {
+        Dictionary buffer = buffers[0];
+        String uri = buffer.get("uri", "");
+        if (uri.is_empty() || uri.begins_with("data:")) {
+            return false;
+        }
+        out.bin_path = file_path.get_base_dir().path_join(uri.uri_decode());
+        out.bin = FileAccess::get_file_as_bytes(out.bin_path);
+        out.total_bytes += out.bin.size();
+    }
+    return !out.bin.is_empty();
+}
+
+static void run_quantize_job(const uint8_t *buffer, QuantizeJob &job) {
+    job.outputs.resize(job.sources.size());
+
+    switch (job.kind) {
+        case QUANTIZE_POSITION: {
+            // One uniform scale for the whole mesh keeps normals valid under the node transform
+            double lo[3] = { DBL_MAX, DBL_MAX, DBL_MAX };
+            double hi[3] = { -DBL_MAX, -DBL_MAX, -DBL_MAX };
+            for (const QuantizeSource &source : job.sources) {
+                for (int64_t i = 0; i < source.count; i++) {
+                    float v[3];
+                    memcpy(v, buffer + source.offset + i * source.stride, 12);
+                    for (int k = 0; k < 3; k++) {
+                        lo[k] = std::min(lo[k], static_cast<double>(v[k]));
+                        hi[k] = std::max(hi[k], static_cast<double>(v[k]));
+                    }
+                }
+            }
+            double extent = std::max({ hi[0] - lo[0], hi[1] - lo[1], hi[2] - lo[2], 1e-6 });
+            job.step = extent / 65535.0;
+            for (int k = 0; k < 3; k++) {
+                job.origin[k] = lo[k];
+            }
+
+            job.bounds.resize(job.sources.size());
+            for (size_t s = 0; s < job.sources.size(); s++) {
+                const QuantizeSource &source = job.sources[s];
+                std::vector<uint8_t> &out = job.outputs[s];
+                out.assign(source.count * 8, 0);
+                std::array<int, 6> &bounds = job.bounds[s];
+                bounds = { 65535, 65535, 65535, 0, 0, 0 };
+                for (int64_t i = 0; i < source.count; i++) {
+                    float v[3];
+                    memcpy(v, buffer + source.offset + i * source.stride, 12);
+                    uint16_t q[4] = { 0, 0, 0, 0 };
+                    for (int k = 0; k < 3; k++) {
+                        long long value = std::llround((v[k] - lo[k]) / job.step);
+                        q[k] = static_cast<uint16_t>(std::min(std::max(value, 0LL), 65535LL));
+                        bounds[k] = std::min(bounds[k], static_cast<int>(q[k]));
+                        bounds[k + 3] = std::max(bounds[k + 3], static_cast<int>(q[k]));
+                    }
+                    memcpy(out.data() + i * 8, q, 8);
+                }
+            }
+            job.ok = true;
+            break;
+        }
+        case QUANTIZE_NORMAL: {
+            const QuantizeSource &source = job.sources[0];
+            std::vector<uint8_t> &out = job.outputs[0];
+            out.assign(source.count * 4, 0);
+            for (int64_t i = 0; i < source.count; i++) {
+                float n[3];
+                memcpy(n, buffer + source.offset + i * source.stride, 12);
+                for (int k = 0; k < 3; k++) {
+                    float clamped = std::min(std::max(n[k], -1.0f), 1.0f);
+                    int8_t value = static_cast<int8_t>(std::lround(clamped * 127.0f));
+                    memcpy(out.data() + i * 4 + k, &value, 1);
+                }
+            }
+            job.ok = true;
+            break;
+        }
+        case QUANTIZE_TEXCOORD: {
+            // Normalized 16-bit only covers [0, 1]; wrapped UVs stay float
+            const QuantizeSource &source = job.sources[0];
+            std::vector<uint8_t> &out = job.outputs[0];
+            out.assign(source.count * 4, 0);
+            for (int64_t i = 0; i < source.count; i++) {
+                float uv[2];
+                memcpy(uv, buffer + source.offset + i * source.stride, 8);
+                uint16_t q[2];
+                for (int k = 0; k < 2; k++) {
+                    if (uv[k] < -1e-5f || uv[k] > 1.0f + 1e-5f) {
+                        out.clear();
+                        return;
+                    }
+                    float clamped = std::min(std::max(uv[k], 0.0f), 1.0f);
+                    q[k] = static_cast<uint16_t>(std::lround(clamped * 65535.0f));
+                }
+                memcpy(out.data() + i * 4, q, 4);
+            }
+            job.ok = true;
+            break;
+        }
+        case QUANTIZE_INDICES: {
+            // 65535 is reserved (primitive restart value) for 16-bit indices
+            const QuantizeSource &source = job.sources[0];
+            std::vector<uint8_t> &out = job.outputs[0];
+            out.assign(source.count * 2, 0);
+            for (int64_t i = 0; i < source.count; i++) {
+                uint32_t index;
+                memcpy(&index, buffer + source.offset + i * source.stride, 4);
+                if (index >= 65535) {
+                    out.clear();
+                    return;
+                }
+                uint16_t narrow = static_cast<uint16_t>(index);
+                memcpy(out.data() + i * 2, &narrow, 2);
+            }
+            job.ok = true;
+            break;
+        }
+    }
+}
+
+static int gltf_type_components(const String &type) {
+    if (type == "SCALAR") {
+        return 1;
+    } else if (type == "VEC2") {
+        return 2;
+    } else if (type == "VEC3") {
+        return 3;
+    } else if (type == "VEC4") {
+        return 4;
+    }
+    return 0;
+}
+
+// Godot's JSON parser returns every number as float; write integral values back as integers
+static Variant normalize_json_numbers(const Variant &value) {
+    switch (value.get_type()) {
+        case Variant::FLOAT: {
+            double number = value;
+            if (number == std::floor(number) && std::fabs(number) < 9007199254740992.0) {
+                return static_cast<int64_t>(number);
+            }
+            return value;
+        }
+        case Variant::DICTIONARY: {
+            Dictionary dict = value;
+            Array keys = dict.keys();
+            for (int i = 0; i < keys.size(); i++) {
+                dict[keys[i]] = normalize_json_numbers(dict[keys[i]]);
+            }
+            return dict;
+        }
+        case Variant::ARRAY: {
+            Array array = value;
+            for (int i = 0; i < array.size(); i++) {
+                array[i] = normalize_json_numbers(array[i]);
+            }
+            return array;
+        }
+        default:
+            return value;
+    }
+}
+
+static void add_extension_name(Dictionary &gltf, const String &key, const String &name) {
+    Array names = gltf.get(key, Array());
+    if (!names.has(name)) {
+        names.push_back(name);
+    }
+    gltf[key] = names;
+}
+
+// Write a glTF / GLB with a single binary buffer (the GLB chunk or the external file at bin_path).
+// Returns the bytes written, or -1 on failure
+static int64_t write_gltf_file(const String &file_path, bool binary, const Dictionary &gltf,
+                               const std::vector<uint8_t> &bin, const String &bin_path) {
+    CharString json_utf8 = JSON::stringify(normalize_json_numbers(gltf), "", false, true).utf8();
+    int64_t json_length = json_utf8.length();
+    if (binary) {
+        int64_t json_padded = (json_length + 3) & ~int64_t(3);
+        int64_t bin_padded = (static_cast<int64_t>(bin.size()) + 3) & ~int64_t(3);
+        int64_t total = 12 + 8 + json_padded + 8 + bin_padded;
+
+        PackedByteArray out;
+        out.resize(total);
+        uint8_t *ptr = out.ptrw();
+        uint32_t header[3] = { GLB_MAGIC, 2, static_cast<uint32_t>(total) };
+        uint32_t json_chunk[2] = { static_cast<uint32_t>(json_padded), GLB_CHUNK_JSON };
+        uint32_t bin_chunk[2] = { static_cast<uint32_t>(bin_padded), GLB_CHUNK_BIN };
+        memcpy(ptr, header, 12);
+        memcpy(ptr + 12, json_chunk, 8);
+        memcpy(ptr + 20, json_utf8.get_data(), json_length);
+        memset(ptr + 20 + json_length, ' ', json_padded - json_length);
+        uint8_t *bin_out = ptr + 20 + json_padded;
+        memcpy(bin_out, bin_chunk, 8);
+        memcpy(bin_out + 8, bin.data(), bin.size());
+        memset(bin_out + 8 + bin.size(), 0, bin_padded - bin.size());
+
+        Ref<FileAccess> file = FileAccess::open(file_path, FileAccess::WRITE);
+        if (file.is_null()) {
+            return -1;
+        }
+        file->store_buffer(out);
+        return total;
+    }
+
+    PackedByteArray json_bytes;
+    json_bytes.resize(json_length);
+    memcpy(json_bytes.ptrw(), json_utf8.get_data(), json_length);
+    PackedByteArray bin_bytes;
+    bin_bytes.resize(static_cast<int64_t>(bin.size()));
+    memcpy(bin_bytes.ptrw(), bin.data(), bin.size());
+
+    Ref<FileAccess> json_file = FileAccess::open(file_path, FileAccess::WRITE);
+    Ref<FileAccess> bin_file = FileAccess::open(bin_path, FileAccess::WRITE);
+    if (json_file.is_null() || bin_file.is_null()) {
+        return -1;
+    }
+    json_file->store_buffer(json_bytes);
+    bin_file->store_buffer(bin_bytes);
+    return json_length + static_cast<int64_t>(bin.size());
+}
+
+// Rewrite the geometry of an exported glTF / GLB in place. Positions become 16-bit integers with a
+// per-mesh dequantization node, normals 8-bit, UVs in [0, 1] 16-bit and indices 16-bit where they fit.
+// Jobs (one per mesh's positions and one per other accessor) run in parallel
+static QuantizeResult quantize_gltf_file(const String &file_path, bool binary, unsigned int num_threads) {
+    QuantizeResult result;
+
+    LoadedGltf loaded;
+    if (!load_gltf_file(file_path, binary, loaded)) {
+        return result;
+    }
+    result.original_bytes = loaded.total_bytes;
+    const PackedByteArray &bin = loaded.bin;
+    Dictionary &gltf = loaded.json;
+
+    Array accessors = gltf.get("accessors", Array());
+    Array views = gltf.get("bufferViews", Array());
+    Array meshes = gltf.get("meshes", Array());
+    Array nodes = gltf.get("nodes", Array());
+    Array images = gltf.get("images", Array());
+
+    auto locate = [&](int accessor_index, int component_type, int components, QuantizeSource &out) -> bool {
+        if (accessor_index < 0 || accessor_index >= accessors.size()) {
+            return false;
+        }
+        Dictionary accessor = accessors[accessor_index];
+        if (accessor.has("sparse") || !accessor.has("bufferView") ||
+                static_cast<int>(accessor.get("componentType", 0)) != component_type ||
+                gltf_type_components(accessor.get("type", "")) != components) {
+            return false;
+        }
+        int view_index = accessor["bufferView"];
+        if (view_index < 0 || view_index >= views.size()) {
+            return false;
+        }
+        Dictionary view = views[view_index];
+        int64_t element_size = components * 4;
+        out.accessor = accessor_index;
+        out.offset = static_cast<int64_t>(view.get("byteOffset", 0)) + static_cast<int64_t>(accessor.get("byteOffset", 0));
+        out.stride = view.get("byteStride", element_size);
+        out.count = accessor.get("count", 0);
+        return out.count > 0 && out.offset + (out.count - 1) * out.stride + element_size <= bin.size();
+    };
+
+    // A position accessor shared by several meshes can't take two dequantization transforms
+    std::unordered_map<int, int> position_owner;
+    for (int m = 0; m < meshes.size(); m++) {
+        Dictionary mesh = meshes[m];
+        Array primitives = mesh.get("primitives", Array());
+        for (int p = 0; p < primitives.size(); p++) {
+            Dictionary attributes = Dictionary(primitives[p]).get("attributes", Dictionary());
+            if (attributes.has("POSITION")) {
+                int accessor = attributes["POSITION"];
+                auto it = position_owner.find(accessor);
+                if (it == position_owner.end()) {
+                    position_owner[accessor] = m;
+                } else if (it->second != m) {
+                    it->second = -1;
+                }
+            }
+        }
+    }
+
+    std::vector<QuantizeJob> jobs;
+    std::unordered_set<int> claimed;
+    auto add_single_job = [&](QuantizeKind kind, int accessor, int component_type, int components) {
+        QuantizeSource source;
+        if (claimed.count(accessor) || !locate(accessor, component_type, components, source)) {
+            return;
+        }
+        claimed.insert(accessor);
+        QuantizeJob job;
+        job.kind = kind;
+        job.sources.push_back(source);
+        jobs.push_back(std::move(job));
+    };
+
+    for (int m = 0; m < meshes.size(); m++) {
+        Dictionary mesh = meshes[m];
+        Array primitives = mesh.get("primitives", Array());
+
+        QuantizeJob position_job;
+        position_job.kind = QUANTIZE_POSITION;
+        position_job.mesh = m;
+        bool positions_ok = true;
+        std::unordered_set<int> mesh_positions;
+
+        for (int p = 0; p < primitives.size(); p++) {
+            Dictionary primitive = primitives[p];
+            Dictionary attributes = primitive.get("attributes", Dictionary());
+
+            if (attributes.has("POSITION")) {
+                int accessor = attributes["POSITION"];
+                QuantizeSource source;
+                if (primitive.has("targets") || position_owner[accessor] != m || claimed.count(accessor) ||
+                        !locate(accessor, GLTF_FLOAT, 3, source)) {
+                    positions_ok = false;
+                } else if (mesh_positions.insert(accessor).second) {
+                    position_job.sources.push_back(source);
+                }
+            }
+            if (attributes.has("NORMAL")) {
+                add_single_job(QUANTIZE_NORMAL, attributes["NORMAL"], GLTF_FLOAT, 3);
+            }
+            Array keys = attributes.keys();
+            for (int k = 0; k < keys.size(); k++) {
+                if (String(keys[k]).begins_with("TEXCOORD_")) {
+                    add_single_job(QUANTIZE_TEXCOORD, attributes[keys[k]], GLTF_FLOAT, 2);
+                }
+            }
+            if (primitive.has("indices")) {
+                add_single_job(QUANTIZE_INDICES, primitive["indices"], GLTF_UNSIGNED_INT, 1);
+            }
+        }
+
+        if (positions_ok && !position_job.sources.empty()) {
+            for (const QuantizeSource &source : position_job.sources) {
+                claimed.insert(source.accessor);
+            }
+            jobs.push_back(std::move(position_job));
+        }
+    }
+
+    const uint8_t *bin_ptr = bin.ptr();
+    plateau_parallel::parallel_for(0, jobs.size(), [&](size_t i) {
+        run_quantize_job(bin_ptr, jobs[i]);
+    }, 1, num_threads);
+
+    std::unordered_map<int, std::pair<size_t, size_t>> rewritten;    // accessor -> (job, source)
+    bool uses_extension = false;
+    for (size_t j = 0; j < jobs.size(); j++) {
+        if (!jobs[j].ok) {
+            continue;
+        }
+        for (size_t s = 0; s < jobs[j].sources.size(); s++) {
+            rewritten[jobs[j].sources[s].accessor] = { j, s };
+        }
+        uses_extension = uses_extension || jobs[j].kind == QUANTIZE_POSITION || jobs[j].kind == QUANTIZE_NORMAL;
+    }
+    if (rewritten.empty()) {
+        result.success = true;
+        result.output_bytes = result.original_bytes;
+        return result;
+    }
+
+    // Rebuild the buffer: views still referenced by untouched accessors or images, then the new data
+    std::vector<uint8_t> keep(views.size(), 0);
+    for (int i = 0; i < accessors.size(); i++) {
+        Dictionary accessor = accessors[i];
+        if (!rewritten.count(i) && accessor.has("bufferView")) {
+            int view_index = accessor["bufferView"];
+            if (view_index < 0 || view_index >= views.size()) {
+                return result;
+            }
+            keep[view_index] = 1;
+        }
+    }
+    for (int i = 0; i < images.size(); i++) {
+        Dictionary image = images[i];
+        if (image.has("bufferView")) {
+            int view_index = image["bufferView"];
+            if (view_index < 0 || view_index >= views.size()) {
+                return result;
+            }
+            keep[view_index] = 1;
+        }
+    }
+
+    std::vector<uint8_t> out_bin;
+    out_bin.reserve(bin.size());
+    Array new_views;
+    auto append_view = [&](Dictionary view, const uint8_t *data, int64_t size) -> int {
+        while (out_bin.size() % 4 != 0) {
+            out_bin.push_back(0);
+        }
+        view["buffer"] = 0;
+        view["byteOffset"] = static_cast<int64_t>(out_bin.size());
+        view["byteLength"] = size;
+        out_bin.insert(out_bin.end(), data, data + size);
+        new_views.push_back(view);
+        return new_views.size() - 1;
+    };
+
+    std::vector<int> view_remap(views.size(), -1);
+    for (int v = 0; v < views.size(); v++) {
+        if (!keep[v]) {
+            continue;
+        }
+        Dictionary view = Dictionary(views[v]).duplicate();
+        int64_t offset = view.get("byteOffset", 0);
+        int64_t length = view.get("byteLength", 0);
+        if (offset < 0 || length < 0 || offset + length > bin.size()) {
+            return result;
+        }
+        view_remap[v] = append_view(view, bin_ptr + offset, length);
+    }
+
+    for (int i = 0; i < accessors.size(); i++) {
+        Dictionary accessor = accessors[i];
+        auto it = rewritten.find(i);
+        if (it == rewritten.end()) {
+            if (accessor.has("bufferView")) {
+                accessor["bufferView"] = view_remap[static_cast<int>(accessor["bufferView"])];
+            }
+            continue;
+        }
+
+        const QuantizeJob &job = jobs[it->second.first];
+        const std::vector<uint8_t> &data = job.outputs[it->second.second];
+        Dictionary view;
+        switch (job.kind) {
+            case QUANTIZE_POSITION: {
+                const std::array<int, 6> &bounds = job.bounds[it->second.second];
+                view["byteStride"] = 8;
+                view["target"] = GLTF_ARRAY_BUFFER;
+                accessor["componentType"] = GLTF_UNSIGNED_SHORT;
+                accessor.erase("normalized");
+                Array min_values, max_values;
+                for (int k = 0; k < 3; k++) {
+                    min_values.push_back(bounds[k]);
+                    max_values.push_back(bounds[k + 3]);
+                }
+                accessor["min"] = min_values;
+                accessor["max"] = max_values;
+                break;
+            }
+            case QUANTIZE_NORMAL:
+                view["byteStride"] = 4;
+                view["target"] = GLTF_ARRAY_BUFFER;
+                accessor["componentType"] = GLTF_BYTE;
+                accessor["normalized"] = true;
+                accessor.erase("min");
+                accessor.erase("max");
+                break;
+            case QUANTIZE_TEXCOORD:
+                view["byteStride"] = 4;
+                view["target"] = GLTF_ARRAY_BUFFER;
+                accessor["componentType"] = GLTF_UNSIGNED_SHORT;
+                accessor["normalized"] = true;
+                accessor.erase("min");
+                accessor.erase("max");
+                break;
+            case QUANTIZE_INDICES:
+                view["target"] = GLTF_ELEMENT_ARRAY_BUFFER;
+                accessor["componentType"] = GLTF_UNSIGNED_SHORT;
+                break;
+        }
+        accessor["bufferView"] = append_view(view, data.data(), static_cast<int64_t>(data.size()));
+        accessor["byteOffset"] = 0;
+    }
+
+    for (int i = 0; i < images.size(); i++) {
+        Dictionary image = images[i];
+        if (image.has("bufferView")) {
+            image["bufferView"] = view_remap[static_cast<int>(image["bufferView"])];
+        }
+    }
+    gltf["bufferViews"] = new_views;
+    Dictionary buffer = Array(gltf["buffers"])[0];
+    buffer["byteLength"] = static_cast<int64_t>(out_bin.size());
+
+    // Quantized positions are decoded by a child node scaling back to model units
+    int node_count = nodes.size();
+    for (const QuantizeJob &job : jobs) {
+        if (job.kind != QUANTIZE_POSITION || !job.ok) {
+            continue;
+        }
+        result.quantized_meshes++;
+        for (int n = 0; n < node_count; n++) {
+            Dictionary node = nodes[n];
+            if (!node.has("mesh") || static_cast<int>(node["mesh"]) != job.mesh) {
+                continue;
+            }
+            Array matrix;
+            double values[16] = { job.step, 0.0, 0.0, 0.0,
+                                  0.0, job.step, 0.0, 0.0,
+                                  0.0, 0.0, job.step, 0.0,
+                                  job.origin[0], job.origin[1], job.origin[2], 1.0 };
+            for (int k = 0; k < 16; k++) {
+                matrix.push_back(values[k]);
+            }
+            Dictionary child;
+            child["name"] = String(node.get("name", "")) + "_quantized";
+            child["mesh"] = job.mesh;
+            child["matrix"] = matrix;
+            node.erase("mesh");
+            Array children = node.get("children", Array());
+            children.push_back(nodes.size());
+            node["children"] = children;
+            nodes.push_back(child);
+        }
+    }
+    if (uses_extension) {
+        add_extension_name(gltf, "extensionsUsed", "KHR_mesh_quantization");
+        add_extension_name(gltf, "extensionsRequired", "KHR_mesh_quantization");
+    }
+
+    result.output_bytes = write_gltf_file(file_path, binary, gltf, out_bin, loaded.bin_path);
+    if (result.output_bytes < 0) {
+        return result;
+    }
+
+    result.success = true;
+    return result;
+}
+
+// ============================================================================
+// glTF meshopt compression (EXT_meshopt_compression)
+// ============================================================================
+
+// meshoptimizer bitstreams: vertex codec version 0 (ATTRIBUTES) and index sequence codec
+// version 1 (INDICES), as specified by EXT_meshopt_compression
+static const uint8_t MESHOPT_VERTEX_HEADER = 0xa0;
+static const uint8_t MESHOPT_SEQUENCE_HEADER = 0xd1;
+static const size_t MESHOPT_VERTEX_BLOCK_BYTES = 8192;
+static const size_t MESHOPT_VERTEX_BLOCK_MAX = 256;
+static const size_t MESHOPT_BYTE_GROUP = 16;
+static const size_t MESHOPT_TAIL_MIN = 32;
+static const int MESHOPT_GROUP_BITS[4] = { 0, 2, 4, 8 };
+
+static uint8_t meshopt_zigzag8(uint8_t value) {
+    return static_cast<uint8_t>((static_cast<int8_t>(value) >> 7) ^ (value << 1));
+}
+
+// Encoded size of a group of 16 bytes at the given bit width (SIZE_MAX if it can't be encoded)
+static size_t meshopt_measure_byte_group(const uint8_t *values, int bits) {
+    if (bits == 0) {
+        for (size_t i = 0; i < MESHOPT_BYTE_GROUP; i++) {
+            if (values[i] != 0) {
+                return SIZE_MAX;
+            }
+        }
+        return 0;
+    }
+    if (bits == 8) {
+        return MESHOPT_BYTE_GROUP;
+    }
+    // Values that don't fit are written as the all-ones sentinel followed by the full byte
+    const uint8_t sentinel = static_cast<uint8_t>((1 << bits) - 1);
+    size_t size = MESHOPT_BYTE_GROUP * bits / 8;
+    for (size_t i = 0; i < MESHOPT_BYTE_GROUP; i++) {
+        size += values[i] >= sentinel ? 1 : 0;
+    }
+    return size;
+}
+
+static void meshopt_encode_byte_group(std::vector<uint8_t> &out, const uint8_t *values, int bits) {
+    if (bits == 0) {
+        return;
+    }
+    if (bits == 8) {
+        out.insert(out.end(), values, values + MESHOPT_BYTE_GROUP);
+        return;
+    }
+
+    // Packed values (first value in the high bits), then the bytes escaped by the sentinel
+    const size_t per_byte = 8 / bits;
+    const uint8_t sentinel = static_cast<uint8_t>((1 << bits) - 1);
+    for (size_t i = 0; i < MESHOPT_BYTE_GROUP; i += per_byte) {
+        uint8_t byte = 0;
+        for (size_t k = 0; k < per_byte; k++) {
+            uint8_t value = values[i + k];
+            byte = static_cast<uint8_t>((byte << bits) | (value >= sentinel ? sentinel : value));
+        }
+        out.push_back(byte);
+    }
+    for (size_t i = 0; i < MESHOPT_BYTE_GROUP; i++) {
+        if (values[i] >= sentinel) {
+            out.push_back(values[i]);
+        }
+    }
+}
+
+// 2-bit width codes for every group of 16 bytes (four per header byte), then the groups
+static void meshopt_encode_bytes(std::vector<uint8_t> &out, const uint8_t *values, size_t count) {
+    const size_t group_count = count / MESHOPT_BYTE_GROUP;
+    const size_t header_offset = out.size();
+    out.resize(header_offset + (group_count + 3) / 4, 0);
+
+    for (size_t group = 0; group < group_count; group++) {
+        const uint8_t *group_values = values + group * MESHOPT_BYTE_GROUP;
+        int best = 3;
+        size_t best_size = MESHOPT_BYTE_GROUP;
+        for (int code = 0; code < 3; code++) {
+            size_t size = meshopt_measure_byte_group(group_values, MESHOPT_GROUP_BITS[code]);
+            if (size < best_size) {
+                best = code;
+                best_size = size;
+            }
+        }
+        out[header_offset + group / 4] |= static_cast<uint8_t>(best << ((group % 4) * 2));
+        meshopt_encode_byte_group(out, group_values, MESHOPT_GROUP_BITS[best]);
+    }
+}
+
+// Vertex codec: per block of vertices and per byte of the stride, zigzag deltas against the
+// previous vertex, packed in groups of 16. stride must be a multiple of 4 and at most 256
+static std::vector<uint8_t> meshopt_encode_vertex_buffer(const uint8_t *vertices, size_t count, size_t stride) {
+    std::vector<uint8_t> out;
+    out.reserve(count * stride / 2 + MESHOPT_TAIL_MIN + stride + 1);
+    out.push_back(MESHOPT_VERTEX_HEADER);
+
+    uint8_t last[MESHOPT_VERTEX_BLOCK_MAX] = {};
+    memcpy(last, vertices, stride);
+
+    const size_t block_size = std::min((MESHOPT_VERTEX_BLOCK_BYTES / stride) & ~(MESHOPT_BYTE_GROUP - 1),
+                                       MESHOPT_VERTEX_BLOCK_MAX);
+    uint8_t deltas[MESHOPT_VERTEX_BLOCK_MAX];
+    for (size_t first = 0; first < count; first += block_size) {
+        const size_t block_count = std::min(block_size, count - first);
+        const size_t aligned_count = (block_count + MESHOPT_BYTE_GROUP - 1) & ~(MESHOPT_BYTE_GROUP - 1);
+        const uint8_t *block = vertices + first * stride;
+
+        for (size_t k = 0; k < stride; k++) {
+            uint8_t previous = last[k];
+            for (size_t i = 0; i < block_count; i++) {
+                uint8_t value = block[i * stride + k];
+                deltas[i] = meshopt_zigzag8(static_cast<uint8_t>(value - previous));
+                previous = value;
+            }
+            std::fill(deltas + block_count, deltas + aligned_count, 0);
+            meshopt_encode_bytes(out, deltas, aligned_count);
+        }
+        memcpy(last, block + (block_count - 1) * stride, stride);
+    }
+
+    // Tail: the first vertex (initial baseline), padded in front to at least 32 bytes
+    if (stride < MESHOPT_TAIL_MIN) {
+        out.resize(out.size() + MESHOPT_TAIL_MIN - stride, 0);
+    }
+    out.insert(out.end(), vertices, vertices + stride);
+    return out;
+}
+
+static void meshopt_encode_vbyte(std::vector<uint8_t> &out, uint32_t value) {
+    do {
+        out.push_back(static_cast<uint8_t>((value & 127) | (value > 127 ? 128 : 0)));
+        value >>= 7;
+    } while (value != 0);
+}
+
+// Index sequence codec: zigzag deltas against one of two baselines as varints, the low bit
+// selecting the baseline. index_size is 2 or 4
+static std::vector<uint8_t> meshopt_encode_index_sequence(const uint8_t *indices, size_t count, size_t index_size) {
+    std::vector<uint8_t> out;
+    out.reserve(count + 5);
+    out.push_back(MESHOPT_SEQUENCE_HEADER);
+
+    uint32_t last[2] = { 0, 0 };
+    uint32_t current = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t index;
+        if (index_size == 2) {
+            uint16_t narrow;
+            memcpy(&narrow, indices + i * 2, 2);
+            index = narrow;
+        } else {
+            memcpy(&index, indices + i * 4, 4);
+        }
+
+        // Switch baselines when the delta would no longer fit in one byte
+        int64_t jump = static_cast<int64_t>(index) - static_cast<int64_t>(last[current]);
+        current ^= (jump < 0 ? -jump : jump) >= 30 ? 1 : 0;
+
+        uint32_t delta = index - last[current];
+        uint32_t zigzag = (delta << 1) ^ static_cast<uint32_t>(static_cast<int32_t>(delta) >> 31);
+        meshopt_encode_vbyte(out, (zigzag << 1) | current);
+        last[current] = index;
+    }
+
+    out.insert(out.end(), 4, 0);
+    return out;
+}
+
+static int gltf_component_size(int component_type) {
+    switch (component_type) {
+        case 5120:  // BYTE
+        case 5121:  // UNSIGNED_BYTE
+            return 1;
+        case 5122:  // SHORT
+        case 5123:  // UNSIGNED_SHORT
+            return 2;
+        case 5125:  // UNSIGNED_INT
+        case 5126:  // FLOAT
+            return 4;
+        default:
+            return 0;
+    }
+}
+
+struct CompressResult {
+    bool success = false;
+    int64_t original_bytes = 0;
+    int64_t output_bytes = 0;
+    int compressed_views = 0;
+};
+
+enum CompressMode {
+    COMPRESS_NONE,
+    COMPRESS_ATTRIBUTES,
+    COMPRESS_INDICES,
+};
+
+struct CompressJob {
+    int view;
+    CompressMode mode;
+    int64_t offset;
+    int64_t length;
+    int64_t stride;
+    int64_t count;
+    std::vector<uint8_t> data;
+};
+
+// Compress the vertex attribute and index buffer views of an exported glTF / GLB in place.
+// Compressed views move to a data-less fallback buffer; images and other views stay as they are.
+// Views are encoded in parallel
+static CompressResult compress_gltf_file(const String &file_path, bool binary, unsigned int num_threads) {
+    CompressResult result;
+
+    LoadedGltf loaded;
+    if (!load_gltf_file(file_path, binary, loaded)) {
+        return result;
+    }
+    result.original_bytes = loaded.total_bytes;
+    const PackedByteArray &bin = loaded.bin;
+    Dictionary &gltf = loaded.json;
+
+    Array accessors = gltf.get("accessors", Array());
+    Array views = gltf.get("bufferViews", Array());
+    Array meshes = gltf.get("meshes", Array());
+    Array images = gltf.get("images", Array());
+
+    // How each accessor is used; anything else (animation, sparse, images) keeps its view raw
+    enum AccessorUse {
+        USE_OTHER = 0,
+        USE_ATTRIBUTE = 1,
+        USE_INDICES = 2,
+    };
+    std::vector<int> accessor_use(accessors.size(), USE_OTHER);
+    auto mark_attributes = [&](const Dictionary &attributes) {
+        Array keys = attributes.keys();
+        for (int k = 0; k < keys.size(); k++) {
+            int accessor = attributes[keys[k]];
+            if (accessor >= 0 && accessor < accessors.size()) {
+                accessor_use[accessor] |= USE_ATTRIBUTE;
+            }
+        }
+    };
+    for (int m = 0; m < meshes.size(); m++) {
+        Array primitives = Dictionary(meshes[m]).get("primitives", Array());
+        for (int p = 0; p < primitives.size(); p++) {
+            Dictionary primitive = primitives[p];
+            mark_attributes(primitive.get("attributes", Dictionary()));
+            Array targets = primitive.get("targets", Array());
+            for (int t = 0; t < targets.size(); t++) {
+                mark_attributes(targets[t]);
+            }
+            if (primitive.has("indices")) {
+                int accessor = primitive["indices"];
+                if (accessor >= 0 && accessor < accessors.size()) {
+                    accessor_use[accessor] |= USE_INDICES;
+                }
+            }
+        }
+    }
+
+    // Each view is compressible only if every accessor on it agrees on the use and element size
+    std::vector<CompressMode> view_mode(views.size(), COMPRESS_NONE);
+    std::vector<int64_t> view_element(views.size(), 0);
+    std::vector<uint8_t> view_blocked(views.size(), 0);
+    for (int i = 0; i < accessors.size(); i++) {
+        Dictionary accessor = accessors[i];
+        if (accessor.has("sparse")) {
+            Dictionary sparse = accessor["sparse"];
+            int index_view = Dictionary(sparse.get("indices", Dictionary())).get("bufferView", -1);
+            int value_view = Dictionary(sparse.get("values", Dictionary())).get("bufferView", -1);
+            for (int view_index : { index_view, value_view }) {
+                if (view_index >= 0 && view_index < views.size()) {
+                    view_blocked[view_index] = 1;
+                }
+            }
+        }
+        if (!accessor.has("bufferView")) {
+            continue;
+        }
+        int view_index = accessor["bufferView"];
+        if (view_index < 0 || view_index >= views.size()) {
+            return result;
+        }
+
+        int component_size = gltf_component_size(accessor.get("componentType", 0));
+        int64_t element_size = static_cast<int64_t>(component_size) * gltf_type_components(accessor.get("type", ""));
+        CompressMode mode = COMPRESS_NONE;
+        if (accessor_use[i] == USE_ATTRIBUTE) {
+            mode = COMPRESS_ATTRIBUTES;
+        } else if (accessor_use[i] == USE_INDICES && (component_size == 2 || component_size == 4)) {
+            mode = COMPRESS_INDICES;
+        }
+
+        if (mode == COMPRESS_NONE || element_size == 0 ||
+                (view_mode[view_index] != COMPRESS_NONE && (view_mode[view_index] != mode || view_element[view_index] != element_size))) {
+            view_blocked[view_index] = 1;
+        }
+        view_mode[view_index] = mode;
+        view_element[view_index] = element_size;
+    }
+    for (int i = 0; i < images.size(); i++) {
+        int view_index = Dictionary(images[i]).get("bufferView", -1);
+        if (view_index >= 0 && view_index < views.size()) {
+            view_blocked[view_index] = 1;
+        }
+    }
+
+    std::vector<CompressJob> jobs;
+    for (int v = 0; v < views.size(); v++) {
+        if (view_blocked[v] || view_mode[v] == COMPRESS_NONE) {
+            continue;
+        }
+        Dictionary view = views[v];
+        CompressJob job;
+        job.view = v;
+        job.mode = view_mode[v];
+        job.offset = view.get("byteOffset", 0);
+        job.length = view.get("byteLength", 0);
+        if (job.mode == COMPRESS_ATTRIBUTES) {
+            // Interleaved views keep their stride; the codec needs a multiple of 4 up to 256
+            job.stride = view.get("byteStride", view_element[v]);
+            if (job.stride % 4 != 0 || job.stride > 256) {
+                continue;
+            }
+        } else {
+            if (view.has("byteStride")) {
+                continue;
+            }
+            job.stride = view_element[v];
+        }
+        if (job.stride <= 0 || job.length <= 0 || job.length % job.stride != 0 ||
+                job.offset < 0 || job.offset + job.length > bin.size()) {
+            continue;
+        }
+        job.count = job.length / job.stride;
+        jobs.push_back(std::move(job));
+    }
+
+    const uint8_t *bin_ptr = bin.ptr();
+    plateau_parallel::parallel_for(0, jobs.size(), [&](size_t i) {
+        CompressJob &job = jobs[i];
+        if (job.mode == COMPRESS_ATTRIBUTES) {
+            job.data = meshopt_encode_vertex_buffer(bin_ptr + job.offset, job.count, job.stride);
+        } else {
+            job.data = meshopt_encode_index_sequence(bin_ptr + job.offset, job.count, job.stride);
+        }
+    }, 1, num_threads);
+
+    // Views that didn't shrink stay raw
+    std::vector<int> view_job(views.size(), -1);
+    for (size_t j = 0; j < jobs.size(); j++) {
+        if (static_cast<int64_t>(jobs[j].data.size()) < jobs[j].length) {
+            view_job[jobs[j].view] = static_cast<int>(j);
+            result.compressed_views++;
+        }
+    }
+    if (result.compressed_views == 0) {
+        result.success = true;
+        result.output_bytes = result.original_bytes;
+        return result;
+    }
+
+    // Buffer 0 holds the raw views and the compressed streams; compressed views are laid out in
+    // buffer 1, which has no data and is only used to size the decoded views
+    std::vector<uint8_t> out_bin;
+    out_bin.reserve(bin.size());
+    int64_t fallback_size = 0;
+    auto align_bin = [&]() {
+        while (out_bin.size() % 4 != 0) {
+            out_bin.push_back(0);
+        }
+    };
+
+    Array new_views;
+    for (int v = 0; v < views.size(); v++) {
+        Dictionary view = Dictionary(views[v]).duplicate();
+        int64_t offset = view.get("byteOffset", 0);
+        int64_t length = view.get("byteLength", 0);
+        if (offset < 0 || length < 0 || offset + length > bin.size()) {
+            return result;
+        }
+
+        align_bin();
+        if (view_job[v] < 0) {
+            view["buffer"] = 0;
+            view["byteOffset"] = static_cast<int64_t>(out_bin.size());
+            out_bin.insert(out_bin.end(), bin_ptr + offset, bin_ptr + offset + length);
+        } else {
+            const CompressJob &job = jobs[view_job[v]];
+            Dictionary meshopt;
+            meshopt["buffer"] = 0;
+            meshopt["byteOffset"] = static_cast<int64_t>(out_bin.size());
+            meshopt["byteLength"] = static_cast<int64_t>(job.data.size());
+            meshopt["byteStride"] = job.stride;
+            meshopt["count"] = job.count;
+            meshopt["mode"] = job.mode == COMPRESS_ATTRIBUTES ? "ATTRIBUTES" : "INDICES";
+            out_bin.insert(out_bin.end(), job.data.begin(), job.data.end());
+
+            Dictionary extensions = view.get("extensions", Dictionary());
+            extensions["EXT_meshopt_compression"] = meshopt;
+            view["extensions"] = extensions;
+            fallback_size = (fallback_size + 3) & ~int64_t(3);
+            view["buffer"] = 1;
+            view["byteOffset"] = fallback_size;
+            fallback_size += length;
+        }
+        new_views.push_back(view);
+    }
+    gltf["bufferViews"] = new_views;
+
+    Array buffers = gltf["buffers"];
+    Dictionary buffer = buffers[0];
+    buffer["byteLength"] = static_cast<int64_t>(out_bin.size());
+    Dictionary fallback_extension;
+    fallback_extension["fallback"] = true;
+    Dictionary fallback_extensions;
+    fallback_extensions["EXT_meshopt_compression"] = fallback_extension;
+    Dictionary fallback;
+    fallback["byteLength"] = fallback_size;
+    fallback["extensions"] = fallback_extensions;
+    buffers.push_back(fallback);
+
+    // The fallback buffer has no data, so loaders must support the extension
+    add_extension_name(gltf, "extensionsUsed", "EXT_meshopt_compression");
+    add_extension_name(gltf, "extensionsRequired", "EXT_meshopt_compression");
+
+    result.output_bytes = write_gltf_file(file_path, binary, gltf, out_bin, loaded.bin_path);
+    if (result.output_bytes < 0) {
+        return result;
+    }
+
+    result.success = true;
+    return result;
+}
+
+// Size of an exported file including its external glTF buffer
+static int64_t get_export_size(const String &file_path, int format) {
+    if (format == EXPORT_FORMAT_GLTF) {
+        LoadedGltf loaded;
+        if (load_gltf_file(file_path, false, loaded)) {
+            return loaded.total_bytes;
+        }
+    }
+    Ref<FileAccess> file = FileAccess::open(file_path, FileAccess::READ);
+    return file.is_valid() ? static_cast<int64_t>(file->get_length()) : 0;
+}
+
+struct OptimizeResult {
+    int64_t original_bytes = 0;
+    int64_t output_bytes = 0;
+    int quantized_meshes = 0;
+    int compressed_views = 0;
+    bool quantize_failed = false;
+    bool compress_failed = false;
+};
+
+// Quantize and then compress an exported glTF / GLB file. original_bytes is the size as written
+// by libplateau, output_bytes the size after the last pass that succeeded
+static OptimizeResult optimize_exported_file(const String &file_path, int format, bool quantize, bool compress,
+                                             unsigned int num_threads) {
+    OptimizeResult result;
+    bool binary = format == EXPORT_FORMAT_GLB;
+    if (quantize) {
+        QuantizeResult quantized = quantize_gltf_file(file_path, binary, num_threads);
+        if (quantized.success) {
+            result.original_bytes = quantized.original_bytes;
+            result.output_bytes = quantized.output_bytes;
+            result.quantized_meshes = quantized.quantized_meshes;
+        } else {
+            result.quantize_failed = true;
+        }
+    }
+    if (compress) {
+        CompressResult compressed = compress_gltf_file(file_path, binary, num_threads);
+        if (compressed.success) {
+            if (result.original_bytes == 0) {
+                result.original_bytes = compressed.original_bytes;
+            }
+            result.output_bytes = compressed.output_bytes;
+            result.compressed_views = compressed.compressed_views;
+        } else {
+            result.compress_failed = true;
+        }
+    }
+    if (result.output_bytes == 0) {
+        result.original_bytes = result.output_bytes = get_export_size(file_path, format);
+    }
+    return result;
+}
+
+// ============================================================================
+// Export
+// ============================================================================
+
 bool PLATEAUMeshExporter::export_to_file(
     const TypedArray<PLATEAUMeshData> &mesh_data_array,
     const String &file_path,
@@ -40,6 +1211,9 @@ bool PLATEAUMeshExporter::export_to_file(
     ERR_FAIL_COND_V_MSG(mesh_data_array.is_empty(), false, "PLATEAUMeshExporter: mesh_data_array is empty.");
     ERR_FAIL_COND_V_MSG(file_path.is_empty(), false, "PLATEAUMeshExporter: file_path is empty.");
 
+    uint64_t start_ms = Time::get_singleton()->get_ticks_msec();
+    last_export_report_ = Dictionary();
+
     try {
         // Convert to native model
         auto model = create_model_from_mesh_data(mesh_data_array);
@@ -60,12 +1234,39 @@ bool PLATEAUMeshExporter::export_to_file(
                 ERR_FAIL_V_MSG(false, "PLATEAUMeshExporter: Invalid format: " + String::num_int64(format));
         }
 
-        if (success) {
+        if (!success) {
+            return false;
+        }
+
+        bool is_gltf = format != EXPORT_FORMAT_OBJ;
+        OptimizeResult optimized = optimize_exported_file(
+            file_path, format, mesh_quantization_ && is_gltf, meshopt_compression_ && is_gltf, 0);
+        if (optimized.quantize_failed) {
+            UtilityFunctions::printerr("PLATEAUMeshExporter: Mesh quantization skipped for ", file_path);
+        }
+        if (optimized.compress_failed) {
+            UtilityFunctions::printerr("PLATEAUMeshExporter: Meshopt compression skipped for ", file_path);
+        }
+        int64_t original_bytes = optimized.original_bytes;
+        int64_t output_bytes = optimized.output_bytes;
+
+        last_export_report_["format"] = format;
+        last_export_report_["original_bytes"] = original_bytes;
+        last_export_report_["output_bytes"] = output_bytes;
+        last_export_report_["compression_ratio"] = original_bytes > 0 ? static_cast<double>(output_bytes) / original_bytes : 1.0;
+        last_export_report_["quantized_meshes"] = optimized.quantized_meshes;
+        last_export_report_["compressed_views"] = optimized.compressed_views;
+        last_export_report_["elapsed_ms"] = static_cast<int64_t>(Time::get_singleton()->get_ticks_msec() - start_ms);
+
+        if (output_bytes != original_bytes) {
+            UtilityFunctions::print("PLATEAUMeshExporter: Exported ", mesh_data_array.size(),
+                                   " meshes to ", file_path, " (", original_bytes, " -> ", output_bytes, " bytes)");
+        } else {
             UtilityFunctions::print("PLATEAUMeshExporter: Exported ", mesh_data_array.size(),
                                    " meshes to ", file_path);
         }
 
-        return success;
+        return true;
 
     } catch (const std::exception &e) {
         UtilityFunctions::printerr("PLATEAUMeshExporter exception: ", String(e.what()));
@@ -73,6 +1274,317 @@ bool PLATEAUMeshExporter::export_to_file(
     }
 }
 
+// ============================================================================
+// Batch export
+// ============================================================================
+
+// PLATEAUMeshData tree captured on the main thread. Workers build the native model from it,
+// so the mesh data resources are never touched off the main thread
+struct ExportNodeSnapshot {
+    std::string name;
+    TVec3d position;
+    bool has_rotation_scale = false;
+    godot::Quaternion rotation;
+    Vector3 scale;
+    std::shared_ptr<const PlateauMesh> mesh;
+    std::vector<ExportNodeSnapshot> children;
+};
+
+struct ExportJob {
+    int index;
+    String file_path;
+    std::vector<ExportNodeSnapshot> roots;
+};
+
+static void snapshot_mesh_data(const Ref<PLATEAUMeshData> &mesh_data, bool top_level, ExportNodeSnapshot &out) {
+    out.name = mesh_data->get_name().utf8().get_data();
+    Transform3D t = mesh_data->get_transform();
+    out.position = TVec3d(t.origin.x, t.origin.y, t.origin.z);
+
+    // Same transform handling as create_model_from_mesh_data(): only roots keep rotation and scale
+    if (top_level) {
+        out.has_rotation_scale = true;
+        out.rotation = t.basis.get_rotation_quaternion();
+        out.scale = t.basis.get_scale();
+    }
+
+    out.mesh = plateau_utils::get_native_mesh(mesh_data);
+
+    TypedArray<PLATEAUMeshData> children = mesh_data->get_children();
+    out.children.reserve(children.size());
+    for (int i = 0; i < children.size(); i++) {
+        Ref<PLATEAUMeshData> child = children[i];
+        if (child.is_valid()) {
+            out.children.emplace_back();
+            snapshot_mesh_data(child, false, out.children.back());
+        }
+    }
+}
+
+static PlateauNode build_node_from_snapshot(const ExportNodeSnapshot &snapshot) {
+    PlateauNode node(snapshot.name);
+    node.setLocalPosition(snapshot.position);
+    if (snapshot.has_rotation_scale) {
+        node.setLocalRotation(plateau::polygonMesh::Quaternion(
+            snapshot.rotation.x, snapshot.rotation.y, snapshot.rotation.z, snapshot.rotation.w));
+        node.setLocalScale(TVec3d(snapshot.scale.x, snapshot.scale.y, snapshot.scale.z));
+    }
+    if (snapshot.mesh) {
+        node.setMesh(std::make_unique<PlateauMesh>(*snapshot.mesh));
+    }
+    for (const ExportNodeSnapshot &child : snapshot.children) {
+        node.addChildNode(build_node_from_snapshot(child));
+    }
+    return node;
+}
+
+Dictionary PLATEAUMeshExporter::export_batch(
+    const Dictionary &groups,
+    const String &output_directory,
+    int format) {
+
+    Dictionary report;
+
+#ifdef PLATEAU_MOBILE_PLATFORM
+    PLATEAU_MOBILE_UNSUPPORTED_V(report);
+#endif
+
+#ifndef PLATEAU_MOBILE_PLATFORM
+    ERR_FAIL_COND_V_MSG(groups.is_empty(), report, "PLATEAUMeshExporter: groups is empty.");
+    ERR_FAIL_COND_V_MSG(output_directory.is_empty(), report, "PLATEAUMeshExporter: output_directory is empty.");
+    String extension = get_format_extension(format);
+    ERR_FAIL_COND_V_MSG(extension.is_empty(), report, "PLATEAUMeshExporter: Invalid format: " + String::num_int64(format));
+
+    DirAccess::make_dir_recursive_absolute(output_directory);
+    uint64_t start_ms = Time::get_singleton()->get_ticks_msec();
+
+    Array keys = groups.keys();
+    int total = keys.size();
+    unsigned int worker_count = max_concurrent_exports_ > 0
+        ? static_cast<unsigned int>(max_concurrent_exports_)
+        : plateau_parallel::get_num_threads();
+    worker_count = std::min(worker_count, static_cast<unsigned int>(total));
+
+    // Bounded hand-off: the main thread converts the next group while workers write files,
+    // and blocks once every worker has one job waiting
+    std::mutex queue_mutex;
+    std::condition_variable queue_changed;
+    std::deque<std::unique_ptr<ExportJob>> queue;
+    bool producing = true;
+    std::vector<uint8_t> succeeded(total, 0);
+    std::vector<int64_t> original_sizes(total, 0);
+    std::vector<int64_t> output_sizes(total, 0);
+    std::vector<int> compressed_views(total, 0);
+    bool quantize = mesh_quantization_ && format != EXPORT_FORMAT_OBJ;
+    bool compress = meshopt_compression_ && format != EXPORT_FORMAT_OBJ;
+
+    auto worker = [&]() {
+        while (true) {
+            std::unique_ptr<ExportJob> job;
+            {
+                std::unique_lock<std::mutex> lock(queue_mutex);
+                queue_changed.wait(lock, [&]() { return !queue.empty() || !producing; });
+                if (queue.empty()) {
+                    return;
+                }
+                job = std::move(queue.front());
+                queue.pop_front();
+            }
+            queue_changed.notify_all();
+
+            try {
+                PlateauModel model;
+                for (const ExportNodeSnapshot &root : job->roots) {
+                    model.addNode(build_node_from_snapshot(root));
+                }
+                // The snapshot shares the source meshes; release it before writing
+                job->roots.clear();
+
+                bool success = false;
+                if (format == EXPORT_FORMAT_OBJ) {
+                    success = export_obj(model, job->file_path);
+                } else {
+                    success = export_gltf(model, job->file_path, format == EXPORT_FORMAT_GLB);
+                }
+                succeeded[job->index] = success ? 1 : 0;
+
+                // Files are already exported in parallel; optimize each one on its own worker
+                if (success) {
+                    OptimizeResult optimized = optimize_exported_file(job->file_path, format, quantize, compress, 1);
+                    original_sizes[job->index] = optimized.original_bytes;
+                    output_sizes[job->index] = optimized.output_bytes;
+                    compressed_views[job->index] = optimized.compressed_views;
+                }
+            } catch (const std::exception &) {
+                succeeded[job->index] = 0;
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(worker_count);
+    for (unsigned int i = 0; i < worker_count; i++) {
+        workers.emplace_back(worker);
+    }
+
+    PackedStringArray file_paths;
+    file_paths.resize(total);
+    Dictionary used_names;  // Lowercase, since file systems may ignore case
+    for (int i = 0; i < total; i++) {
+        // Different keys can map to the same file name once sanitized; keep them apart
+        String base_name = String(keys[i]).validate_filename();
+        String name = base_name;
+        for (int suffix = 2; used_names.has(name.to_lower()); suffix++) {
+            name = base_name + "_" + String::num_int64(suffix);
+        }
+        used_names[name.to_lower()] = true;
+        file_paths.set(i, output_directory.path_join(name + "." + extension));
+
+        auto job = std::make_unique<ExportJob>();
+        job->index = i;
+        job->file_path = file_paths[i];
+
+        Array group = groups[keys[i]];
+        job->roots.reserve(group.size());
+        for (int j = 0; j < group.size(); j++) {
+            Ref<PLATEAUMeshData> mesh_data = group[j];
+            if (mesh_data.is_valid()) {
+                job->roots.emplace_back();
+                snapshot_mesh_data(mesh_data, true, job->roots.back());
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        queue_changed.wait(lock, [&]() { return queue.size() < worker_count; });
+        queue.push_back(std::move(job));
+        lock.unlock();
+        queue_changed.notify_all();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        producing = false;
+    }
+    queue_changed.notify_all();
+    for (auto &thread : workers) {
+        thread.join();
+    }
+
+    PackedStringArray files;
+    PackedStringArray failed;
+    int64_t original_bytes = 0;
+    int64_t output_bytes = 0;
+    int64_t total_compressed_views = 0;
+    for (int i = 0; i < total; i++) {
+        if (succeeded[i]) {
+            files.push_back(file_paths[i]);
+            original_bytes += original_sizes[i];
+            output_bytes += output_sizes[i];
+            total_compressed_views += compressed_views[i];
+        } else {
+            failed.push_back(file_paths[i]);
+        }
+    }
+
+    report["files"] = files;
+    report["failed"] = failed;
+    report["exported"] = files.size();
+    report["original_bytes"] = original_bytes;
+    report["output_bytes"] = output_bytes;
+    report["compression_ratio"] = original_bytes > 0 ? static_cast<double>(output_bytes) / original_bytes : 1.0;
+    report["compressed_views"] = total_compressed_views;
+    report["elapsed_ms"] = static_cast<int64_t>(Time::get_singleton()->get_ticks_msec() - start_ms);
+
+    UtilityFunctions::print("PLATEAUMeshExporter: Exported ", files.size(), "/", total, " files to ",
+                            output_directory, " in ", report["elapsed_ms"], " ms (", static_cast<int64_t>(worker_count), " threads)");
+    if (!failed.is_empty()) {
+        UtilityFunctions::printerr("PLATEAUMeshExporter: Failed to export ", failed.size(), " files");
+    }
+#endif
+
+    return report;
+}
+
+Dictionary PLATEAUMeshExporter::group_by_root(const TypedArray<PLATEAUMeshData> &mesh_data_array) {
+    Dictionary groups;
+    for (int i = 0; i < mesh_data_array.size(); i++) {
+        Ref<PLATEAUMeshData> mesh_data = mesh_data_array[i];
+        if (mesh_data.is_null()) {
+            continue;
+        }
+
+        String base_name = mesh_data->get_name().get_basename();
+        if (base_name.is_empty()) {
+            base_name = "model";
+        }
+        // Keep duplicate names apart
+        String name = base_name;
+        for (int suffix = 2; groups.has(name); suffix++) {
+            name = base_name + "_" + String::num_int64(suffix);
+        }
+
+        TypedArray<PLATEAUMeshData> group;
+        group.push_back(mesh_data);
+        groups[name] = group;
+    }
+    return groups;
+}
+
+// Add a childless copy of every node with a mesh, carrying the accumulated transform
+static void collect_tile_nodes(const Ref<PLATEAUMeshData> &mesh_data, const Transform3D &parent_transform,
+                               double tile_size, Dictionary &groups) {
+    Transform3D global_transform = parent_transform * mesh_data->get_transform();
+
+    Ref<ArrayMesh> mesh = mesh_data->get_mesh();
+    if (mesh.is_valid() && mesh->get_surface_count() > 0) {
+        Vector3 center = global_transform.xform(mesh->get_aabb().get_center());
+        int64_t tile_x = static_cast<int64_t>(Math::floor(center.x / tile_size));
+        int64_t tile_z = static_cast<int64_t>(Math::floor(center.z / tile_size));
+        String name = "tile_" + String::num_int64(tile_x) + "_" + String::num_int64(tile_z);
+
+        Ref<PLATEAUMeshData> flat;
+        flat.instantiate();
+        flat->set_name(mesh_data->get_name());
+        flat->set_mesh(mesh);
+        flat->set_transform(global_transform);
+        flat->set_texture_paths(mesh_data->get_texture_paths());
+        flat->set_gml_id(mesh_data->get_gml_id());
+        flat->set_city_object_type(mesh_data->get_city_object_type());
+        flat->set_attributes(mesh_data->get_attributes());
+        flat->set_city_object_list(mesh_data->get_city_object_list_internal());
+        if (mesh_data->has_native_mesh()) {
+            flat->set_native_mesh(mesh_data->get_native_mesh());
+        }
+
+        if (!groups.has(name)) {
+            groups[name] = TypedArray<PLATEAUMeshData>();
+        }
+        Array group = groups[name];
+        group.push_back(flat);
+    }
+
+    TypedArray<PLATEAUMeshData> children = mesh_data->get_children();
+    for (int i = 0; i < children.size(); i++) {
+        Ref<PLATEAUMeshData> child = children[i];
+        if (child.is_valid()) {
+            collect_tile_nodes(child, global_transform, tile_size, groups);
+        }
+    }
+}
+
+Dictionary PLATEAUMeshExporter::group_by_tile(const TypedArray<PLATEAUMeshData> &mesh_data_array, double tile_size) {
+    Dictionary groups;
+    ERR_FAIL_COND_V_MSG(tile_size <= 0.0, groups, "PLATEAUMeshExporter: tile_size must be positive.");
+
+    for (int i = 0; i < mesh_data_array.size(); i++) {
+        Ref<PLATEAUMeshData> mesh_data = mesh_data_array[i];
+        if (mesh_data.is_valid()) {
+            collect_tile_nodes(mesh_data, Transform3D(), tile_size, groups);
+        }
+    }
+    return groups;
+}
+
 PackedStringArray PLATEAUMeshExporter::get_supported_formats() {
     PackedStringArray formats;
     formats.push_back("glTF");
@@ -119,8 +1631,8 @@ std::shared_ptr<PlateauModel> PLATEAUMeshExporter::create_model_from_mesh_data(
             godot_quat.x, godot_quat.y, godot_quat.z, godot_quat.w));
         node.setLocalScale(TVec3d(godot_scale.x, godot_scale.y, godot_scale.z));
 
-        // Add mesh
-        add_mesh_data_to_node(node, mesh_data);
+        // Add mesh (one submesh per surface, keeping texture paths)
+        plateau_utils::add_mesh_data_to_node(node, mesh_data);
 
         model->addNode(std::move(node));
     }
@@ -128,139 +1640,6 @@ std::shared_ptr<PlateauModel> PLATEAUMeshExporter::create_model_from_mesh_data(
     return model;
 }
 
-void PLATEAUMeshExporter::add_mesh_data_to_node(
-    PlateauNode &parent_node,
-    const Ref<PLATEAUMeshData> &mesh_data) {
-
-    if (mesh_data.is_null()) {
-        return;
-    }
-
-    Ref<ArrayMesh> godot_mesh = mesh_data->get_mesh();
-    PackedStringArray texture_paths = mesh_data->get_texture_paths();
-
-    if (godot_mesh.is_valid() && godot_mesh->get_surface_count() > 0) {
-        PlateauMesh native_mesh;
-        int surface_count = godot_mesh->get_surface_count();
-
-        // Collect all vertices, indices, and UVs from all surfaces
-        // Track index ranges for each surface to create separate submeshes
-        std::vector<TVec3d> all_vertices;
-        std::vector<unsigned int> all_indices;
-        std::vector<TVec2f> all_uvs;
-        unsigned int vertex_offset = 0;
-
-        // Store submesh info: (start_index, end_index, texture_path)
-        struct SubMeshInfo {
-            size_t start_index;
-            size_t end_index;
-            std::string texture_path;
-        };
-        std::vector<SubMeshInfo> submesh_infos;
-
-        for (int surf_idx = 0; surf_idx < surface_count; surf_idx++) {
-            Array arrays = godot_mesh->surface_get_arrays(surf_idx);
-            if (arrays.size() <= Mesh::ARRAY_VERTEX) {
-                continue;
-            }
-
-            Variant vertex_var = arrays[Mesh::ARRAY_VERTEX];
-            if (vertex_var.get_type() != Variant::PACKED_VECTOR3_ARRAY) {
-                continue;
-            }
-
-            PackedVector3Array vertices = vertex_var;
-            if (vertices.is_empty()) {
-                continue;
-            }
-
-            // Get indices
-            PackedInt32Array indices;
-            if (arrays.size() > Mesh::ARRAY_INDEX &&
-                arrays[Mesh::ARRAY_INDEX].get_type() == Variant::PACKED_INT32_ARRAY) {
-                indices = arrays[Mesh::ARRAY_INDEX];
-            }
-            if (indices.is_empty()) {
-                continue;
-            }
-
-            // Record submesh start index
-            size_t submesh_start = all_indices.size();
-
-            // Add vertices
-            for (int j = 0; j < vertices.size(); j++) {
-                Vector3 v = vertices[j];
-                all_vertices.push_back(TVec3d(v.x, v.y, v.z));
-            }
-
-            // Add indices with offset
-            for (int j = 0; j < indices.size(); j++) {
-                all_indices.push_back(static_cast<unsigned int>(indices[j]) + vertex_offset);
-            }
-
-            // Add UVs
-            if (arrays.size() > Mesh::ARRAY_TEX_UV &&
-                arrays[Mesh::ARRAY_TEX_UV].get_type() == Variant::PACKED_VECTOR2_ARRAY) {
-                PackedVector2Array uvs = arrays[Mesh::ARRAY_TEX_UV];
-                for (int j = 0; j < uvs.size(); j++) {
-                    Vector2 uv = uvs[j];
-                    all_uvs.push_back(TVec2f(uv.x, 1.0f - uv.y));
-                }
-            } else {
-                // Add placeholder UVs
-                for (int j = 0; j < vertices.size(); j++) {
-                    all_uvs.push_back(TVec2f(0.0f, 0.0f));
-                }
-            }
-
-            // Record submesh end index and texture path
-            size_t submesh_end = all_indices.size() - 1;
-            std::string tex_path = "";
-            if (surf_idx < texture_paths.size()) {
-                tex_path = texture_paths[surf_idx].utf8().get_data();
-            }
-            submesh_infos.push_back({submesh_start, submesh_end, tex_path});
-
-            vertex_offset += static_cast<unsigned int>(vertices.size());
-        }
-
-        // Add to native mesh if valid data collected
-        if (!all_vertices.empty() && !all_indices.empty() && all_indices.size() % 3 == 0) {
-            native_mesh.addVerticesList(all_vertices);
-            native_mesh.addIndicesList(all_indices, 0, false);
-
-            // Add each submesh with its texture path
-            for (const auto &info : submesh_infos) {
-                native_mesh.addSubMesh(info.texture_path, nullptr, info.start_index, info.end_index, -1);
-            }
-
-            if (!all_uvs.empty() && all_uvs.size() == all_vertices.size()) {
-                native_mesh.setUV1(std::move(all_uvs));
-            }
-
-            // Set city object list if available
-            const auto &city_object_list = mesh_data->get_city_object_list_internal();
-            native_mesh.setCityObjectList(city_object_list);
-
-            parent_node.setMesh(std::make_unique<PlateauMesh>(std::move(native_mesh)));
-        }
-    }
-
-    // Process children recursively
-    TypedArray<PLATEAUMeshData> children = mesh_data->get_children();
-    for (int i = 0; i < children.size(); i++) {
-        Ref<PLATEAUMeshData> child = children[i];
-        if (child.is_valid()) {
-            auto child_node = PlateauNode(child->get_name().utf8().get_data());
-            Transform3D t = child->get_transform();
-            child_node.setLocalPosition(TVec3d(t.origin.x, t.origin.y, t.origin.z));
-
-            add_mesh_data_to_node(child_node, child);
-            parent_node.addChildNode(std::move(child_node));
-        }
-    }
-}
-
 bool PLATEAUMeshExporter::export_gltf(
     const PlateauModel &model,
     const String &file_path,
@@ -290,8 +1669,31 @@ void PLATEAUMeshExporter::_bind_methods() {
     ClassDB::bind_method(D_METHOD("get_texture_directory"), &PLATEAUMeshExporter::get_texture_directory);
     ADD_PROPERTY(PropertyInfo(Variant::STRING, "texture_directory"), "set_texture_directory", "get_texture_directory");
 
+    ClassDB::bind_method(D_METHOD("set_max_concurrent_exports", "count"), &PLATEAUMeshExporter::set_max_concurrent_exports);
+    ClassDB::bind_method(D_METHOD("get_max_concurrent_exports"), &PLATEAUMeshExporter::get_max_concurrent_exports);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "max_concurrent_exports"), "set_max_concurrent_exports", "get_max_concurrent_exports");
+
+    ClassDB::bind_method(D_METHOD("set_mesh_quantization", "enable"), &PLATEAUMeshExporter::set_mesh_quantization);
+    ClassDB::bind_method(D_METHOD("get_mesh_quantization"), &PLATEAUMeshExporter::get_mesh_quantization);
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "mesh_quantization"), "set_mesh_quantization", "get_mesh_quantization");
+
+    ClassDB::bind_method(D_METHOD("set_meshopt_compression", "enable"), &PLATEAUMeshExporter::set_meshopt_compression);
+    ClassDB::bind_method(D_METHOD("get_meshopt_compression"), &PLATEAUMeshExporter::get_meshopt_compression);
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "meshopt_compression"), "set_meshopt_compression", "get_meshopt_compression");
+
+    ClassDB::bind_method(D_METHOD("get_last_export_report"), &PLATEAUMeshExporter::get_last_export_report);
+
     ClassDB::bind_method(D_METHOD("export_to_file", "mesh_data_array", "file_path", "format"),
                          &PLATEAUMeshExporter::export_to_file);
+    ClassDB::bind_method(D_METHOD("export_batch", "groups", "output_directory", "format"),
+                         &PLATEAUMeshExporter::export_batch);
+
+    ClassDB::bind_static_method("PLATEAUMeshExporter",
+                                D_METHOD("group_by_root", "mesh_data_array"),
+                                &PLATEAUMeshExporter::group_by_root);
+    ClassDB::bind_static_method("PLATEAUMeshExporter",
+                                D_METHOD("group_by_tile", "mesh_data_array", "tile_size"),
+                                &PLATEAUMeshExporter::group_by_tile);
 
     ClassDB::bind_static_method("PLATEAUMeshExporter",
                                 D_METHOD("get_supported_formats"),
@@ -52,6 +52,18 @@ enum PLATEAUExportFormat : int {
  *     "C:/output/model.obj",
  *     PLATEAUExportFormat.EXPORT_FORMAT_OBJ
  * )
+ *
+ * # Quantized geometry (KHR_mesh_quantization), roughly halves vertex data
+ * exporter.mesh_quantization = true
+ * exporter.meshopt_compression = true       # EXT_meshopt_compression on top
+ * exporter.export_to_file(mesh_data_array, "C:/output/model.glb", PLATEAUExportFormat.EXPORT_FORMAT_GLB)
+ * print(exporter.get_last_export_report())   # original_bytes, output_bytes, ...
+ *
+ * # One GLB per GML root (or per 500 m tile), written concurrently
+ * var groups = PLATEAUMeshExporter.group_by_root(mesh_data_array)
+ * # var groups = PLATEAUMeshExporter.group_by_tile(mesh_data_array, 500.0)
+ * var report = exporter.export_batch(groups, "C:/output/city", PLATEAUExportFormat.EXPORT_FORMAT_GLB)
+ * print(report.files.size(), " files in ", report.elapsed_ms, " ms")
  * ```
  */
 class PLATEAUMeshExporter : public RefCounted {
@@ -65,6 +77,20 @@ public:
     void set_texture_directory(const String &dir);
     String get_texture_directory() const;
 
+    // Rewrite glTF/GLB geometry with KHR_mesh_quantization (16-bit positions, 8-bit normals,
+    // 16-bit UVs and indices). Meshes are quantized in parallel after libplateau writes the file
+    void set_mesh_quantization(bool enable);
+    bool get_mesh_quantization() const;
+
+    // Encode vertex and index buffer views with EXT_meshopt_compression after quantization.
+    // The extension is marked required, so loaders without meshopt support can't open the file
+    void set_meshopt_compression(bool enable);
+    bool get_meshopt_compression() const;
+
+    // Files written at the same time by export_batch (0 = one per hardware thread)
+    void set_max_concurrent_exports(int count);
+    int get_max_concurrent_exports() const;
+
     // Export mesh data to file
     // Returns true on success, false on failure
     bool export_to_file(
@@ -72,6 +98,27 @@ public:
         const String &file_path,
         int format);
 
+    // Export one file per group (file name -> Array of PLATEAUMeshData) into output_directory.
+    // Groups are converted one at a time and written on worker threads; at most two groups per
+    // worker are held in memory. Returns Dictionary: files, failed, exported, original_bytes,
+    // output_bytes, compression_ratio, compressed_views, elapsed_ms
+    Dictionary export_batch(
+        const Dictionary &groups,
+        const String &output_directory,
+        int format);
+
+    // Sizes of the last export_to_file: format, original_bytes, output_bytes, compression_ratio,
+    // quantized_meshes, compressed_views, elapsed_ms (original_bytes is the file size before
+    // quantization and compression)
+    Dictionary get_last_export_report() const;
+
+    // Grouping helpers for export_batch
+    // One group per top-level mesh data (per GML file or per granularity group), named after it
+    static Dictionary group_by_root(const TypedArray<PLATEAUMeshData> &mesh_data_array);
+    // Every node with a mesh goes to the XZ tile (tile_size meters) containing its bounds center.
+    // Nodes are flattened with their accumulated transform; groups are named "tile_<x>_<z>"
+    static Dictionary group_by_tile(const TypedArray<PLATEAUMeshData> &mesh_data_array, double tile_size);
+
     // Get supported export formats as array of strings
     static PackedStringArray get_supported_formats();
 
@@ -83,16 +130,15 @@ protected:
 
 private:
     String texture_directory_;
+    int max_concurrent_exports_;
+    bool mesh_quantization_;
+    bool meshopt_compression_;
+    Dictionary last_export_report_;
 
     // Internal helper: Convert mesh data to plateau model
     std::shared_ptr<plateau::polygonMesh::Model> create_model_from_mesh_data(
         const TypedArray<PLATEAUMeshData> &mesh_data_array);
 
-    // Internal helper: Add mesh data to node recursively
-    void add_mesh_data_to_node(
-        plateau::polygonMesh::Node &parent_node,
-        const Ref<PLATEAUMeshData> &mesh_data);
-
     // Internal export methods
     bool export_gltf(
         const plateau::polygonMesh::Model &model,
@@ -56,76 +56,220 @@ PackedVector3Array compute_smooth_normals(
     return normals;
 }
 
-void extract_mesh_arrays(
+// Arrays of one triangle surface, fetched once and kept for the copy pass
+struct SurfaceArrays {
+    int surface_index;
+    PackedVector3Array vertices;
+    PackedInt32Array indices;
+    PackedVector2Array uvs;
+    PackedVector2Array uv4s;
+};
+
+// Fetch every usable surface and count totals so outputs can be sized exactly once
+static void collect_surface_arrays(
     const Ref<ArrayMesh> &godot_mesh,
-    std::vector<TVec3d> &out_vertices,
-    std::vector<unsigned int> &out_indices,
-    std::vector<TVec2f> &out_uvs) {
+    std::vector<SurfaceArrays> &out_surfaces,
+    size_t &out_vertex_count,
+    size_t &out_index_count) {
 
-    out_vertices.clear();
-    out_indices.clear();
-    out_uvs.clear();
+    out_surfaces.clear();
+    out_vertex_count = 0;
+    out_index_count = 0;
 
-    if (godot_mesh.is_null() || godot_mesh->get_surface_count() == 0) {
+    if (godot_mesh.is_null()) {
         return;
     }
 
-    unsigned int vertex_offset = 0;
+    int surface_count = godot_mesh->get_surface_count();
+    out_surfaces.reserve(surface_count);
 
-    for (int surf_idx = 0; surf_idx < godot_mesh->get_surface_count(); surf_idx++) {
+    for (int surf_idx = 0; surf_idx < surface_count; surf_idx++) {
         Array arrays = godot_mesh->surface_get_arrays(surf_idx);
-        if (arrays.size() <= Mesh::ARRAY_VERTEX) {
+        if (arrays.size() <= Mesh::ARRAY_INDEX ||
+            arrays[Mesh::ARRAY_VERTEX].get_type() != Variant::PACKED_VECTOR3_ARRAY ||
+            arrays[Mesh::ARRAY_INDEX].get_type() != Variant::PACKED_INT32_ARRAY) {
             continue;
         }
 
-        Variant vertex_var = arrays[Mesh::ARRAY_VERTEX];
-        if (vertex_var.get_type() != Variant::PACKED_VECTOR3_ARRAY) {
+        SurfaceArrays surface;
+        surface.surface_index = surf_idx;
+        surface.vertices = arrays[Mesh::ARRAY_VERTEX];
+        surface.indices = arrays[Mesh::ARRAY_INDEX];
+        if (surface.vertices.is_empty() || surface.indices.is_empty() || surface.indices.size() % 3 != 0) {
             continue;
         }
 
-        PackedVector3Array vertices = vertex_var;
-        if (vertices.is_empty()) {
-            continue;
+        if (arrays[Mesh::ARRAY_TEX_UV].get_type() == Variant::PACKED_VECTOR2_ARRAY) {
+            surface.uvs = arrays[Mesh::ARRAY_TEX_UV];
         }
-
-        // Get indices
-        PackedInt32Array indices;
-        if (arrays.size() > Mesh::ARRAY_INDEX &&
-            arrays[Mesh::ARRAY_INDEX].get_type() == Variant::PACKED_INT32_ARRAY) {
-            indices = arrays[Mesh::ARRAY_INDEX];
+        if (arrays[Mesh::ARRAY_TEX_UV2].get_type() == Variant::PACKED_VECTOR2_ARRAY) {
+            surface.uv4s = arrays[Mesh::ARRAY_TEX_UV2];
         }
-        if (indices.is_empty()) {
-            continue;
+
+        out_vertex_count += surface.vertices.size();
+        out_index_count += surface.indices.size();
+        out_surfaces.push_back(std::move(surface));
+    }
+}
+
+// Copy one surface into pre-sized libplateau buffers at the given offsets.
+// Winding is inverted back to libplateau's CW order (see PLATEAUCityModel::convert_mesh).
+static void copy_surface_arrays(
+    const SurfaceArrays &surface,
+    size_t vertex_base,
+    size_t index_base,
+    TVec3d *out_vertices,
+    unsigned int *out_indices,
+    TVec2f *out_uvs,
+    TVec2f *out_uv4s) {
+
+    const int64_t vertex_count = surface.vertices.size();
+    const Vector3 *src_vertices = surface.vertices.ptr();
+    TVec3d *dst_vertices = out_vertices + vertex_base;
+    for (int64_t j = 0; j < vertex_count; j++) {
+        dst_vertices[j] = TVec3d(src_vertices[j].x, src_vertices[j].y, src_vertices[j].z);
+    }
+
+    const int64_t index_count = surface.indices.size();
+    const int32_t *src_indices = surface.indices.ptr();
+    unsigned int *dst_indices = out_indices + index_base;
+    const unsigned int offset = static_cast<unsigned int>(vertex_base);
+    for (int64_t j = 0; j < index_count; j += 3) {
+        dst_indices[j] = static_cast<unsigned int>(src_indices[j + 2]) + offset;
+        dst_indices[j + 1] = static_cast<unsigned int>(src_indices[j + 1]) + offset;
+        dst_indices[j + 2] = static_cast<unsigned int>(src_indices[j]) + offset;
+    }
+
+    // UVs (with Y-flip for libplateau); surfaces without UVs keep zero placeholders
+    if (out_uvs != nullptr && surface.uvs.size() == vertex_count) {
+        const Vector2 *src_uvs = surface.uvs.ptr();
+        TVec2f *dst_uvs = out_uvs + vertex_base;
+        for (int64_t j = 0; j < vertex_count; j++) {
+            dst_uvs[j] = TVec2f(src_uvs[j].x, 1.0f - src_uvs[j].y);
         }
+    }
 
-        // Add vertices
-        for (int j = 0; j < vertices.size(); j++) {
-            Vector3 v = vertices[j];
-            out_vertices.push_back(TVec3d(v.x, v.y, v.z));
+    // UV4 (CityObjectIndex) is stored unflipped in ARRAY_TEX_UV2
+    if (out_uv4s != nullptr && surface.uv4s.size() == vertex_count) {
+        const Vector2 *src_uv4s = surface.uv4s.ptr();
+        TVec2f *dst_uv4s = out_uv4s + vertex_base;
+        for (int64_t j = 0; j < vertex_count; j++) {
+            dst_uv4s[j] = TVec2f(src_uv4s[j].x, src_uv4s[j].y);
         }
+    }
+}
+
+void extract_mesh_arrays(
+    const Ref<ArrayMesh> &godot_mesh,
+    std::vector<TVec3d> &out_vertices,
+    std::vector<unsigned int> &out_indices,
+    std::vector<TVec2f> &out_uvs) {
+
+    std::vector<SurfaceArrays> surfaces;
+    size_t vertex_count = 0;
+    size_t index_count = 0;
+    collect_surface_arrays(godot_mesh, surfaces, vertex_count, index_count);
+
+    out_vertices.assign(vertex_count, TVec3d(0, 0, 0));
+    out_indices.assign(index_count, 0);
+    out_uvs.assign(vertex_count, TVec2f(0.0f, 0.0f));
+
+    size_t vertex_base = 0;
+    size_t index_base = 0;
+    for (const auto &surface : surfaces) {
+        copy_surface_arrays(surface, vertex_base, index_base,
+                            out_vertices.data(), out_indices.data(), out_uvs.data(), nullptr);
+        vertex_base += surface.vertices.size();
+        index_base += surface.indices.size();
+    }
+}
+
+std::unique_ptr<PlateauMesh> build_native_mesh(const Ref<PLATEAUMeshData> &mesh_data) {
+    if (mesh_data.is_null()) {
+        return nullptr;
+    }
+
+    std::vector<SurfaceArrays> surfaces;
+    size_t vertex_count = 0;
+    size_t index_count = 0;
+    collect_surface_arrays(mesh_data->get_mesh(), surfaces, vertex_count, index_count);
+    if (surfaces.empty()) {
+        return nullptr;
+    }
 
-        // Add indices with offset
-        for (int j = 0; j < indices.size(); j++) {
-            out_indices.push_back(static_cast<unsigned int>(indices[j]) + vertex_offset);
+    bool has_uv4 = true;
+    for (const auto &surface : surfaces) {
+        if (surface.uv4s.size() != surface.vertices.size()) {
+            has_uv4 = false;
+            break;
         }
+    }
 
-        // Add UVs (with Y-flip for libplateau)
-        if (arrays.size() > Mesh::ARRAY_TEX_UV &&
-            arrays[Mesh::ARRAY_TEX_UV].get_type() == Variant::PACKED_VECTOR2_ARRAY) {
-            PackedVector2Array uvs = arrays[Mesh::ARRAY_TEX_UV];
-            for (int j = 0; j < uvs.size(); j++) {
-                Vector2 uv = uvs[j];
-                out_uvs.push_back(TVec2f(uv.x, 1.0f - uv.y));
-            }
-        } else {
-            // Add placeholder UVs
-            for (int j = 0; j < vertices.size(); j++) {
-                out_uvs.push_back(TVec2f(0.0f, 0.0f));
-            }
+    std::vector<TVec3d> vertices(vertex_count);
+    std::vector<unsigned int> indices(index_count);
+    std::vector<TVec2f> uvs(vertex_count, TVec2f(0.0f, 0.0f));
+    std::vector<TVec2f> uv4s;
+    if (has_uv4) {
+        uv4s.resize(vertex_count);
+    }
+
+    auto native_mesh = std::make_unique<PlateauMesh>();
+    PackedStringArray texture_paths = mesh_data->get_texture_paths();
+
+    size_t vertex_base = 0;
+    size_t index_base = 0;
+    std::vector<std::pair<size_t, size_t>> submesh_ranges;
+    submesh_ranges.reserve(surfaces.size());
+    for (const auto &surface : surfaces) {
+        copy_surface_arrays(surface, vertex_base, index_base,
+                            vertices.data(), indices.data(), uvs.data(),
+                            has_uv4 ? uv4s.data() : nullptr);
+        submesh_ranges.emplace_back(index_base, index_base + surface.indices.size() - 1);
+        vertex_base += surface.vertices.size();
+        index_base += surface.indices.size();
+    }
+
+    native_mesh->addVerticesList(vertices);
+    native_mesh->addIndicesList(indices, 0, false);
+
+    // One submesh per surface, carrying its texture path for export
+    for (size_t i = 0; i < surfaces.size(); i++) {
+        int surf_idx = surfaces[i].surface_index;
+        std::string texture_path;
+        if (surf_idx < texture_paths.size()) {
+            texture_path = texture_paths[surf_idx].utf8().get_data();
         }
+        native_mesh->addSubMesh(texture_path, nullptr, submesh_ranges[i].first, submesh_ranges[i].second, -1);
+    }
+
+    native_mesh->setUV1(std::move(uvs));
+    if (has_uv4) {
+        native_mesh->setUV4(std::move(uv4s));
+    }
+
+    native_mesh->setCityObjectList(mesh_data->get_city_object_list_internal());
+
+    return native_mesh;
+}
+
+std::shared_ptr<const PlateauMesh> get_native_mesh(
+    const Ref<PLATEAUMeshData> &mesh_data,
+    bool cache_result) {
 
-        vertex_offset += static_cast<unsigned int>(vertices.size());
+    if (mesh_data.is_null()) {
+        return nullptr;
+    }
+
+    std::shared_ptr<const PlateauMesh> native_mesh = mesh_data->get_native_mesh();
+    if (native_mesh) {
+        return native_mesh;
+    }
+
+    native_mesh = build_native_mesh(mesh_data);
+    if (native_mesh && cache_result) {
+        mesh_data->set_native_mesh(native_mesh);
     }
+    return native_mesh;
 }
 
 void add_mesh_data_to_node(
@@ -138,39 +282,23 @@ void add_mesh_data_to_node(
         return;
     }
 
-    Ref<ArrayMesh> godot_mesh = mesh_data->get_mesh();
-    if (godot_mesh.is_valid() && godot_mesh->get_surface_count() > 0) {
-        PlateauMesh native_mesh;
-
-        std::vector<TVec3d> all_vertices;
-        std::vector<unsigned int> all_indices;
-        std::vector<TVec2f> all_uvs;
-
-        extract_mesh_arrays(godot_mesh, all_vertices, all_indices, all_uvs);
-
-        // Add to native mesh if valid data collected
-        if (!all_vertices.empty() && !all_indices.empty() && all_indices.size() % 3 == 0) {
-            native_mesh.addVerticesList(all_vertices);
-            native_mesh.addIndicesList(all_indices, 0, false);
-            native_mesh.addSubMesh("", nullptr, 0, all_indices.size() - 1, -1);
-
-            if (!all_uvs.empty()) {
-                if (include_uv4) {
-                    // HeightMapAligner requires both UV1 and UV4
-                    std::vector<TVec2f> all_uvs_copy = all_uvs;
-                    native_mesh.setUV1(std::move(all_uvs));
-                    native_mesh.setUV4(std::move(all_uvs_copy));
-                } else {
-                    native_mesh.setUV1(std::move(all_uvs));
-                }
-            }
-
-            // Set city object list if available
-            const auto &city_object_list = mesh_data->get_city_object_list_internal();
-            native_mesh.setCityObjectList(city_object_list);
+    // Prefer the retained native mesh (a plain copy of contiguous buffers) over
+    // re-reading the ArrayMesh; the node takes ownership of its own Mesh
+    std::unique_ptr<PlateauMesh> native_mesh;
+    std::shared_ptr<const PlateauMesh> cached_mesh = mesh_data->get_native_mesh();
+    if (cached_mesh) {
+        native_mesh = std::make_unique<PlateauMesh>(*cached_mesh);
+    } else {
+        native_mesh = build_native_mesh(mesh_data);
+    }
 
-            parent_node.setMesh(std::make_unique<PlateauMesh>(std::move(native_mesh)));
+    if (native_mesh) {
+        // HeightMapAligner requires both UV1 and UV4
+        if (include_uv4 && native_mesh->getUV4().empty() && !native_mesh->getUV1().empty()) {
+            std::vector<TVec2f> uv4s = native_mesh->getUV1();
+            native_mesh->setUV4(std::move(uv4s));
         }
+        parent_node.setMesh(std::move(native_mesh));
     }
 
     // Process children recursively
@@ -270,6 +398,17 @@ Ref<PLATEAUMeshData> create_mesh_data_from_node(const PlateauNode &node) {
             }
         }
 
+        // Keep UV4 (CityObjectIndex) in ARRAY_TEX_UV2 so it survives the round-trip
+        const auto &uv4 = native_mesh->getUV4();
+        PackedVector2Array godot_uv4s;
+        if (uv4.size() == vertices.size()) {
+            godot_uv4s.resize(uv4.size());
+            Vector2 *dst_uv4s = godot_uv4s.ptrw();
+            for (size_t j = 0; j < uv4.size(); j++) {
+                dst_uv4s[j] = Vector2(uv4[j].x, uv4[j].y);
+            }
+        }
+
         // Create mesh
         Ref<ArrayMesh> godot_mesh;
         godot_mesh.instantiate();
@@ -282,6 +421,9 @@ Ref<PLATEAUMeshData> create_mesh_data_from_node(const PlateauNode &node) {
         if (!godot_uvs.is_empty()) {
             arrays[Mesh::ARRAY_TEX_UV] = godot_uvs;
         }
+        if (!godot_uv4s.is_empty()) {
+            arrays[Mesh::ARRAY_TEX_UV2] = godot_uv4s;
+        }
 
         godot_mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
         mesh_data->set_mesh(godot_mesh);
@@ -29,10 +29,11 @@ PackedVector3Array compute_smooth_normals(
 /**
  * Extract all vertices, indices, and UVs from a Godot ArrayMesh.
  * Supports multi-surface meshes by merging all surfaces with proper index offsets.
+ * Output buffers are sized once up front and filled in a single pass per surface.
  *
  * @param godot_mesh Input Godot ArrayMesh
  * @param out_vertices Output vertices (TVec3d format for libplateau)
- * @param out_indices Output indices (unsigned int format for libplateau)
+ * @param out_indices Output indices (unsigned int format for libplateau, CW winding)
  * @param out_uvs Output UVs (TVec2f format for libplateau, Y-flipped)
  */
 void extract_mesh_arrays(
@@ -41,6 +42,31 @@ void extract_mesh_arrays(
     std::vector<unsigned int> &out_indices,
     std::vector<TVec2f> &out_uvs);
 
+/**
+ * Build a libplateau Mesh from PLATEAUMeshData's ArrayMesh.
+ * Each surface becomes a submesh with its texture path, triangle winding is inverted
+ * back to libplateau's CW order, and UV4 (CityObjectIndex) is restored from
+ * ARRAY_TEX_UV2 when every surface carries it.
+ *
+ * @param mesh_data Source PLATEAUMeshData
+ * @return Created Mesh, or nullptr if there is no valid triangle data
+ */
+std::unique_ptr<PlateauMesh> build_native_mesh(
+    const Ref<PLATEAUMeshData> &mesh_data);
+
+/**
+ * Get the libplateau Mesh for PLATEAUMeshData without copying when possible.
+ * Returns the retained/cached native mesh if present, otherwise builds one
+ * from the ArrayMesh.
+ *
+ * @param mesh_data Source PLATEAUMeshData
+ * @param cache_result If true, store a freshly built mesh on mesh_data for reuse
+ * @return Native mesh, or nullptr if there is no valid triangle data
+ */
+std::shared_ptr<const PlateauMesh> get_native_mesh(
+    const Ref<PLATEAUMeshData> &mesh_data,
+    bool cache_result = false);
+
 /**
  * Convert an array of PLATEAUMeshData to a libplateau Model.
  *
@@ -1,14 +1,23 @@
 #include "plateau_terrain.h"
 #include "plateau_platform.h"
 #include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/image.hpp>
+#include <godot_cpp/classes/mesh_instance3d.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
+#include <algorithm>
+#include <cfloat>
 #include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
 
 #ifndef PLATEAU_MOBILE_PLATFORM
 #include <plateau/height_map_generator/heightmap_generator.h>
 #include <plateau/height_map_generator/heightmap_mesh_generator.h>
 #include <plateau/height_map_generator/heightmap_types.h>
 #include <plateau/geometry/geo_reference.h>
+#include "plateau_mesh_utils.h"
+#include "plateau_parallel.h"
 #endif
 
 #include "plateau_types.h"
@@ -109,10 +118,11 @@ PackedByteArray PLATEAUHeightMapData::get_heightmap_raw() const {
 
     // Convert uint16 to bytes (little-endian) and cache
     cached_raw_.resize(heightmap_data_.size() * 2);
+    uint8_t *raw = cached_raw_.ptrw();
     for (size_t i = 0; i < heightmap_data_.size(); i++) {
         uint16_t val = heightmap_data_[i];
-        cached_raw_.set(i * 2, val & 0xFF);
-        cached_raw_.set(i * 2 + 1, (val >> 8) & 0xFF);
+        raw[i * 2] = val & 0xFF;
+        raw[i * 2 + 1] = (val >> 8) & 0xFF;
     }
     cached_raw_valid_ = true;
     return cached_raw_;
@@ -136,8 +146,9 @@ PackedFloat32Array PLATEAUHeightMapData::get_heightmap_normalized() const {
 
     // Normalize uint16 to [0.0, 1.0] and cache
     cached_normalized_.resize(heightmap_data_.size());
+    float *normalized = cached_normalized_.ptrw();
     for (size_t i = 0; i < heightmap_data_.size(); i++) {
-        cached_normalized_.set(i, static_cast<float>(heightmap_data_[i]) / 65535.0f);
+        normalized[i] = static_cast<float>(heightmap_data_[i]) / 65535.0f;
     }
     cached_normalized_valid_ = true;
     return cached_normalized_;
@@ -203,6 +214,405 @@ bool PLATEAUHeightMapData::save_raw(const String &path) const {
 #endif
 }
 
+#ifndef PLATEAU_MOBILE_PLATFORM
+// ============================================================================
+// Heightmap surface building (chunked / LOD meshes)
+// ============================================================================
+
+// Maps heightmap samples to local positions, normals and UVs.
+// Sample (col, row) lies at min + (col / (width - 1), row / (height - 1)) on XZ.
+struct HeightmapSampler {
+    const HeightMapElemT *data;
+    int width;
+    int height;
+    Vector3 min;
+    Vector3 size;
+    Vector2 uv_min;
+    Vector2 uv_max;
+
+    double height_at(int col, int row) const {
+        col = std::clamp(col, 0, width - 1);
+        row = std::clamp(row, 0, height - 1);
+        return min.y + static_cast<double>(data[static_cast<size_t>(row) * width + col]) / 65535.0 * size.y;
+    }
+
+    Vector3 position(int col, int row) const {
+        return Vector3(
+            min.x + size.x * col / (width - 1),
+            height_at(col, row),
+            min.z + size.z * row / (height - 1));
+    }
+
+    // Central differences on the full-resolution samples, so normals match across chunks and LODs
+    Vector3 normal(int col, int row) const {
+        int left = std::max(col - 1, 0);
+        int right = std::min(col + 1, width - 1);
+        int back = std::max(row - 1, 0);
+        int front = std::min(row + 1, height - 1);
+        double dx = size.x * (right - left) / (width - 1);
+        double dz = size.z * (front - back) / (height - 1);
+        double slope_x = dx > 0.0 ? (height_at(right, row) - height_at(left, row)) / dx : 0.0;
+        double slope_z = dz > 0.0 ? (height_at(col, front) - height_at(col, back)) / dz : 0.0;
+        return Vector3(-slope_x, 1.0, -slope_z).normalized();
+    }
+
+    // Same convention as generate_mesh(): libplateau UV with Y flipped
+    Vector2 uv(int col, int row) const {
+        float u = uv_min.x + (uv_max.x - uv_min.x) * col / (width - 1);
+        float v = uv_min.y + (uv_max.y - uv_min.y) * row / (height - 1);
+        return Vector2(u, 1.0f - v);
+    }
+};
+
+struct TerrainSurfaceBuffers {
+    PackedVector3Array vertices;
+    PackedVector3Array normals;
+    PackedVector2Array uvs;
+    PackedInt32Array indices;
+};
+
+// Add skirts below a chain of boundary vertices (closed when it forms a loop). Skirts are
+// double-sided so they hide cracks against neighbouring chunks of any LOD from any direction.
+static void append_skirt(TerrainSurfaceBuffers &buffers, const std::vector<int> &chain, float skirt_depth, bool closed) {
+    const int chain_count = static_cast<int>(chain.size());
+    if (chain_count < 2 || skirt_depth <= 0.0f) {
+        return;
+    }
+
+    const int base = buffers.vertices.size();
+    buffers.vertices.resize(base + chain_count);
+    buffers.normals.resize(base + chain_count);
+    buffers.uvs.resize(base + chain_count);
+    Vector3 *vertices = buffers.vertices.ptrw();
+    Vector3 *normals = buffers.normals.ptrw();
+    Vector2 *uvs = buffers.uvs.ptrw();
+    for (int i = 0; i < chain_count; i++) {
+        vertices[base + i] = vertices[chain[i]] - Vector3(0, skirt_depth, 0);
+        normals[base + i] = normals[chain[i]];
+        uvs[base + i] = uvs[chain[i]];
+    }
+
+    const int segment_count = closed ? chain_count : chain_count - 1;
+    int n = buffers.indices.size();
+    buffers.indices.resize(n + segment_count * 12);
+    int32_t *indices = buffers.indices.ptrw();
+    for (int i = 0; i < segment_count; i++) {
+        int next = (i + 1) % chain_count;
+        int top0 = chain[i];
+        int top1 = chain[next];
+        int bottom0 = base + i;
+        int bottom1 = base + next;
+        const int quad[12] = {
+            top0, bottom0, top1, top1, bottom0, bottom1,
+            top0, top1, bottom0, top1, bottom1, bottom0
+        };
+        for (int k = 0; k < 12; k++) {
+            indices[n++] = quad[k];
+        }
+    }
+}
+
+// Sample indices from first to last with the given step; the last index is always included
+static std::vector<int> decimated_samples(int first, int last, int step) {
+    std::vector<int> samples;
+    for (int i = first; i < last; i += step) {
+        samples.push_back(i);
+    }
+    samples.push_back(last);
+    return samples;
+}
+
+// Build a regular grid surface over samples [col0, col1] x [row0, row1] taking every step-th
+// sample. Positions are relative to origin.
+static void build_grid_surface(const HeightmapSampler &sampler, int col0, int col1, int row0, int row1,
+                               int step, float skirt_depth, const Vector3 &origin, TerrainSurfaceBuffers &out) {
+    const std::vector<int> cols = decimated_samples(col0, col1, step);
+    const std::vector<int> rows = decimated_samples(row0, row1, step);
+    const int count_x = static_cast<int>(cols.size());
+    const int count_z = static_cast<int>(rows.size());
+
+    out.vertices.resize(count_x * count_z);
+    out.normals.resize(count_x * count_z);
+    out.uvs.resize(count_x * count_z);
+    Vector3 *vertices = out.vertices.ptrw();
+    Vector3 *normals = out.normals.ptrw();
+    Vector2 *uvs = out.uvs.ptrw();
+    for (int z = 0; z < count_z; z++) {
+        for (int x = 0; x < count_x; x++) {
+            int i = z * count_x + x;
+            vertices[i] = sampler.position(cols[x], rows[z]) - origin;
+            normals[i] = sampler.normal(cols[x], rows[z]);
+            uvs[i] = sampler.uv(cols[x], rows[z]);
+        }
+    }
+
+    out.indices.resize((count_x - 1) * (count_z - 1) * 6);
+    int32_t *indices = out.indices.ptrw();
+    int n = 0;
+    for (int z = 0; z < count_z - 1; z++) {
+        for (int x = 0; x < count_x - 1; x++) {
+            int a = z * count_x + x;
+            int b = a + 1;
+            int c = a + count_x;
+            int d = c + 1;
+            indices[n++] = a;
+            indices[n++] = b;
+            indices[n++] = c;
+            indices[n++] = b;
+            indices[n++] = d;
+            indices[n++] = c;
+        }
+    }
+
+    // Perimeter as a closed loop: -Z edge, +X edge, +Z edge, -X edge
+    std::vector<int> loop;
+    loop.reserve((count_x + count_z) * 2);
+    for (int x = 0; x < count_x - 1; x++) {
+        loop.push_back(x);
+    }
+    for (int z = 0; z < count_z - 1; z++) {
+        loop.push_back(z * count_x + count_x - 1);
+    }
+    for (int x = count_x - 1; x > 0; x--) {
+        loop.push_back((count_z - 1) * count_x + x);
+    }
+    for (int z = count_z - 1; z > 0; z--) {
+        loop.push_back(z * count_x);
+    }
+    append_skirt(out, loop, skirt_depth, true);
+}
+
+// Right-triangulated irregular network (RTIN) over a tile of (tile_cells + 1)^2 samples,
+// following the Martini approach. Triangle i is the (i + 2)-th node of the implicit binary
+// tree; coords stores its hypotenuse endpoints (ax, ay, bx, by).
+static std::vector<uint16_t> build_rtin_triangle_coords(int tile_cells) {
+    const int triangle_count = tile_cells * tile_cells * 2 - 2;
+    std::vector<uint16_t> coords(static_cast<size_t>(triangle_count) * 4);
+    for (int i = 0; i < triangle_count; i++) {
+        int id = i + 2;
+        int ax = 0, ay = 0, bx = 0, by = 0, cx = 0, cy = 0;
+        if (id & 1) {
+            bx = by = cx = tile_cells;
+        } else {
+            ax = ay = cy = tile_cells;
+        }
+        while ((id >>= 1) > 1) {
+            int mx = (ax + bx) >> 1;
+            int my = (ay + by) >> 1;
+            if (id & 1) {
+                bx = ax;
+                by = ay;
+                ax = cx;
+                ay = cy;
+            } else {
+                ax = bx;
+                ay = by;
+                bx = cx;
+                by = cy;
+            }
+            cx = mx;
+            cy = my;
+        }
+        coords[i * 4] = static_cast<uint16_t>(ax);
+        coords[i * 4 + 1] = static_cast<uint16_t>(ay);
+        coords[i * 4 + 2] = static_cast<uint16_t>(bx);
+        coords[i * 4 + 3] = static_cast<uint16_t>(by);
+    }
+    return coords;
+}
+
+// Per-sample approximation error, propagated bottom-up so a sample's error bounds its whole
+// subtree. Samples beyond (limit_x, limit_y) are padding: triangles straddling that border get
+// an infinite error so they always split down to cells that are fully inside or outside.
+static void compute_rtin_errors(const std::vector<uint16_t> &coords, int tile_cells, const std::vector<float> &heights,
+                                int limit_x, int limit_y, std::vector<float> &errors) {
+    const int grid_size = tile_cells + 1;
+    const int triangle_count = static_cast<int>(coords.size() / 4);
+    const int parent_count = triangle_count - tile_cells * tile_cells;
+    errors.assign(static_cast<size_t>(grid_size) * grid_size, 0.0f);
+
+    for (int i = triangle_count - 1; i >= 0; i--) {
+        int ax = coords[i * 4];
+        int ay = coords[i * 4 + 1];
+        int bx = coords[i * 4 + 2];
+        int by = coords[i * 4 + 3];
+        int mx = (ax + bx) >> 1;
+        int my = (ay + by) >> 1;
+        int cx = mx + my - ay;
+        int cy = my + ax - mx;
+
+        const int middle = my * grid_size + mx;
+        float interpolated = (heights[ay * grid_size + ax] + heights[by * grid_size + bx]) * 0.5f;
+        float error = std::abs(interpolated - heights[middle]);
+
+        int min_x = std::min({ax, bx, cx});
+        int max_x = std::max({ax, bx, cx});
+        int min_y = std::min({ay, by, cy});
+        int max_y = std::max({ay, by, cy});
+        if ((min_x < limit_x && max_x > limit_x) || (min_y < limit_y && max_y > limit_y)) {
+            error = std::numeric_limits<float>::infinity();
+        }
+
+        errors[middle] = std::max(errors[middle], error);
+        if (i < parent_count) {
+            int left_child = ((ay + cy) >> 1) * grid_size + ((ax + cx) >> 1);
+            int right_child = ((by + cy) >> 1) * grid_size + ((bx + cx) >> 1);
+            errors[middle] = std::max({errors[middle], errors[left_child], errors[right_child]});
+        }
+    }
+}
+
+struct RtinSelection {
+    const std::vector<float> *errors;
+    int grid_size;
+    int limit_x;
+    int limit_y;
+    float max_error;
+    std::vector<int> *triangles; // (x, y) x 3 per triangle
+};
+
+static void select_rtin_triangle(const RtinSelection &selection, int ax, int ay, int bx, int by, int cx, int cy) {
+    int mx = (ax + bx) >> 1;
+    int my = (ay + by) >> 1;
+    if (std::abs(ax - cx) + std::abs(ay - cy) > 1 && (*selection.errors)[my * selection.grid_size + mx] > selection.max_error) {
+        select_rtin_triangle(selection, cx, cy, ax, ay, mx, my);
+        select_rtin_triangle(selection, bx, by, cx, cy, mx, my);
+        return;
+    }
+
+    // Leaves in the padding area are dropped
+    if (std::max({ax, bx, cx}) > selection.limit_x || std::max({ay, by, cy}) > selection.limit_y) {
+        return;
+    }
+    const int triangle[6] = {ax, ay, bx, by, cx, cy};
+    selection.triangles->insert(selection.triangles->end(), triangle, triangle + 6);
+}
+
+static void select_rtin_triangles(const std::vector<float> &errors, int tile_cells, int limit_x, int limit_y,
+                                  float max_error, std::vector<int> &out_triangles) {
+    RtinSelection selection = {&errors, tile_cells + 1, limit_x, limit_y, max_error, &out_triangles};
+    select_rtin_triangle(selection, 0, 0, tile_cells, tile_cells, tile_cells, 0);
+    select_rtin_triangle(selection, tile_cells, tile_cells, 0, 0, 0, tile_cells);
+}
+
+// Build one RTIN tile whose sample (0, 0) is heightmap sample (col0, row0). Interior tile
+// edges get skirts since neighbouring tiles simplify their shared edge independently.
+static void build_adaptive_tile(const HeightmapSampler &sampler, const std::vector<uint16_t> &coords, int tile_cells,
+                                int col0, int row0, float max_error, float skirt_depth, const bool skirt_edges[4],
+                                TerrainSurfaceBuffers &out) {
+    const int grid_size = tile_cells + 1;
+    const int limit_x = std::min(tile_cells, sampler.width - 1 - col0);
+    const int limit_y = std::min(tile_cells, sampler.height - 1 - row0);
+
+    // Samples past the heightmap edge repeat the border and are cut away during selection
+    std::vector<float> heights(static_cast<size_t>(grid_size) * grid_size);
+    for (int y = 0; y < grid_size; y++) {
+        for (int x = 0; x < grid_size; x++) {
+            heights[y * grid_size + x] = static_cast<float>(
+                sampler.height_at(col0 + std::min(x, limit_x), row0 + std::min(y, limit_y)));
+        }
+    }
+
+    std::vector<float> errors;
+    compute_rtin_errors(coords, tile_cells, heights, limit_x, limit_y, errors);
+
+    std::vector<int> triangles;
+    select_rtin_triangles(errors, tile_cells, limit_x, limit_y, max_error, triangles);
+
+    std::vector<int> vertex_map(static_cast<size_t>(grid_size) * grid_size, -1);
+    std::vector<Vector3> vertices;
+    std::vector<Vector3> normals;
+    std::vector<Vector2> uvs;
+    auto get_vertex = [&](int x, int y) {
+        int &index = vertex_map[y * grid_size + x];
+        if (index < 0) {
+            index = static_cast<int>(vertices.size());
+            vertices.push_back(sampler.position(col0 + x, row0 + y));
+            normals.push_back(sampler.normal(col0 + x, row0 + y));
+            uvs.push_back(sampler.uv(col0 + x, row0 + y));
+        }
+        return index;
+    };
+
+    out.indices.resize(static_cast<int64_t>(triangles.size() / 2));
+    int32_t *indices = out.indices.ptrw();
+    for (size_t i = 0; i < triangles.size(); i += 6) {
+        int a = get_vertex(triangles[i], triangles[i + 1]);
+        int b = get_vertex(triangles[i + 2], triangles[i + 3]);
+        int c = get_vertex(triangles[i + 4], triangles[i + 5]);
+        // Emit in the same orientation as build_grid_surface (positive in col/row space)
+        int64_t cross = static_cast<int64_t>(triangles[i + 2] - triangles[i]) * (triangles[i + 5] - triangles[i + 1]) -
+                        static_cast<int64_t>(triangles[i + 3] - triangles[i + 1]) * (triangles[i + 4] - triangles[i]);
+        size_t n = i / 2;
+        indices[n] = a;
+        indices[n + 1] = cross > 0 ? b : c;
+        indices[n + 2] = cross > 0 ? c : b;
+    }
+
+    out.vertices.resize(static_cast<int64_t>(vertices.size()));
+    out.normals.resize(static_cast<int64_t>(normals.size()));
+    out.uvs.resize(static_cast<int64_t>(uvs.size()));
+    std::copy(vertices.begin(), vertices.end(), out.vertices.ptrw());
+    std::copy(normals.begin(), normals.end(), out.normals.ptrw());
+    std::copy(uvs.begin(), uvs.end(), out.uvs.ptrw());
+
+    // Edges in order -Z, +X, +Z, -X; each chain runs along the edge
+    for (int edge = 0; edge < 4; edge++) {
+        if (!skirt_edges[edge]) {
+            continue;
+        }
+        const int length = (edge % 2 == 0) ? limit_x : limit_y;
+        std::vector<int> chain;
+        for (int t = 0; t <= length; t++) {
+            int x = edge == 0 || edge == 2 ? t : (edge == 1 ? limit_x : 0);
+            int y = edge == 1 || edge == 3 ? t : (edge == 2 ? limit_y : 0);
+            int index = vertex_map[y * grid_size + x];
+            if (index >= 0) {
+                chain.push_back(index);
+            }
+        }
+        append_skirt(out, chain, skirt_depth, false);
+    }
+}
+
+static Ref<ArrayMesh> create_terrain_array_mesh(const TerrainSurfaceBuffers &buffers, const Ref<Material> &material) {
+    Ref<ArrayMesh> array_mesh;
+    array_mesh.instantiate();
+    if (buffers.indices.is_empty()) {
+        return array_mesh;
+    }
+
+    Array arrays;
+    arrays.resize(Mesh::ARRAY_MAX);
+    arrays[Mesh::ARRAY_VERTEX] = buffers.vertices;
+    arrays[Mesh::ARRAY_NORMAL] = buffers.normals;
+    arrays[Mesh::ARRAY_TEX_UV] = buffers.uvs;
+    arrays[Mesh::ARRAY_INDEX] = buffers.indices;
+    array_mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
+    if (material.is_valid()) {
+        array_mesh->surface_set_material(0, material);
+    }
+    return array_mesh;
+}
+
+static Ref<StandardMaterial3D> create_default_terrain_material() {
+    Ref<StandardMaterial3D> material;
+    material.instantiate();
+    material->set_cull_mode(StandardMaterial3D::CULL_BACK);
+    material->set_albedo(Color(0.6f, 0.6f, 0.6f, 1.0f));
+    material->set_metallic(0.0f);
+    material->set_roughness(0.9f);
+    return material;
+}
+
+Ref<StandardMaterial3D> PLATEAUHeightMapData::get_default_material() const {
+    if (default_material_.is_null()) {
+        default_material_ = create_default_terrain_material();
+    }
+    return default_material_;
+}
+#endif
+
 Ref<ArrayMesh> PLATEAUHeightMapData::generate_mesh() const {
     Ref<ArrayMesh> array_mesh;
     array_mesh.instantiate();
@@ -331,13 +741,7 @@ Ref<ArrayMesh> PLATEAUHeightMapData::generate_mesh() const {
         array_mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
 
         // Create default material
-        Ref<StandardMaterial3D> material;
-        material.instantiate();
-        material->set_cull_mode(StandardMaterial3D::CULL_BACK);
-        material->set_albedo(Color(0.6f, 0.6f, 0.6f, 1.0f));
-        material->set_metallic(0.0f);
-        material->set_roughness(0.9f);
-        array_mesh->surface_set_material(0, material);
+        array_mesh->surface_set_material(0, get_default_material());
 
         UtilityFunctions::print("Generated terrain mesh with ", godot_vertices.size(), " vertices");
 
@@ -349,6 +753,322 @@ Ref<ArrayMesh> PLATEAUHeightMapData::generate_mesh() const {
     return array_mesh;
 }
 
+Ref<ArrayMesh> PLATEAUHeightMapData::generate_adaptive_mesh(float max_error) const {
+    Ref<ArrayMesh> array_mesh;
+    array_mesh.instantiate();
+
+#ifdef PLATEAU_MOBILE_PLATFORM
+    PLATEAU_MOBILE_UNSUPPORTED_V(array_mesh);
+#endif
+
+#ifndef PLATEAU_MOBILE_PLATFORM
+    ERR_FAIL_COND_V_MSG(heightmap_data_.empty() || width_ < 2 || height_ < 2, array_mesh, "Cannot generate mesh: no heightmap data.");
+    ERR_FAIL_COND_V_MSG(max_error < 0.0f, array_mesh, "Max error must not be negative.");
+
+    HeightmapSampler sampler;
+    sampler.data = heightmap_data_.data();
+    sampler.width = width_;
+    sampler.height = height_;
+    sampler.min = get_min_bounds();
+    sampler.size = get_max_bounds() - sampler.min;
+    sampler.uv_min = get_min_uv();
+    sampler.uv_max = get_max_uv();
+
+    // Tiles are 2^k cells wide (at most 256) and simplified independently in parallel
+    int tile_cells = 2;
+    while (tile_cells < 256 && tile_cells < std::max(width_, height_) - 1) {
+        tile_cells *= 2;
+    }
+    const int tiles_x = (width_ - 2) / tile_cells + 1;
+    const int tiles_y = (height_ - 2) / tile_cells + 1;
+    const size_t tile_count = static_cast<size_t>(tiles_x) * tiles_y;
+
+    // Neighbouring tiles can disagree on their shared edge by up to twice the error
+    const float skirt_depth = std::max(max_error * 2.0f, 0.01f);
+
+    const std::vector<uint16_t> coords = build_rtin_triangle_coords(tile_cells);
+    std::vector<TerrainSurfaceBuffers> tiles(tile_count);
+    plateau_parallel::parallel_for(0, tile_count, [&](size_t tile) {
+        int tx = static_cast<int>(tile % tiles_x);
+        int ty = static_cast<int>(tile / tiles_x);
+        const bool skirt_edges[4] = {ty > 0, tx < tiles_x - 1, ty < tiles_y - 1, tx > 0};
+        build_adaptive_tile(sampler, coords, tile_cells, tx * tile_cells, ty * tile_cells,
+                            max_error, skirt_depth, skirt_edges, tiles[tile]);
+    }, 1);
+
+    // Merge tiles into a single surface
+    int64_t vertex_count = 0;
+    int64_t index_count = 0;
+    for (const TerrainSurfaceBuffers &tile : tiles) {
+        vertex_count += tile.vertices.size();
+        index_count += tile.indices.size();
+    }
+
+    TerrainSurfaceBuffers merged;
+    merged.vertices.resize(vertex_count);
+    merged.normals.resize(vertex_count);
+    merged.uvs.resize(vertex_count);
+    merged.indices.resize(index_count);
+    Vector3 *vertices = merged.vertices.ptrw();
+    Vector3 *normals = merged.normals.ptrw();
+    Vector2 *uvs = merged.uvs.ptrw();
+    int32_t *indices = merged.indices.ptrw();
+
+    int64_t vertex_offset = 0;
+    int64_t index_offset = 0;
+    for (const TerrainSurfaceBuffers &tile : tiles) {
+        std::copy(tile.vertices.ptr(), tile.vertices.ptr() + tile.vertices.size(), vertices + vertex_offset);
+        std::copy(tile.normals.ptr(), tile.normals.ptr() + tile.normals.size(), normals + vertex_offset);
+        std::copy(tile.uvs.ptr(), tile.uvs.ptr() + tile.uvs.size(), uvs + vertex_offset);
+        const int32_t *tile_indices = tile.indices.ptr();
+        for (int64_t i = 0; i < tile.indices.size(); i++) {
+            indices[index_offset + i] = tile_indices[i] + static_cast<int32_t>(vertex_offset);
+        }
+        vertex_offset += tile.vertices.size();
+        index_offset += tile.indices.size();
+    }
+
+    array_mesh = create_terrain_array_mesh(merged, get_default_material());
+
+    int64_t grid_triangles = static_cast<int64_t>(width_ - 1) * (height_ - 1) * 2;
+    UtilityFunctions::print("Generated adaptive terrain mesh with ", index_count / 3, " triangles (uniform grid: ",
+                            grid_triangles, ", max error: ", max_error, "m)");
+#endif
+
+    return array_mesh;
+}
+
+Array PLATEAUHeightMapData::generate_chunked_meshes(int chunks_x, int chunks_y, int lod_count, float skirt_depth) const {
+    Array result;
+
+#ifdef PLATEAU_MOBILE_PLATFORM
+    PLATEAU_MOBILE_UNSUPPORTED_V(result);
+#endif
+
+#ifndef PLATEAU_MOBILE_PLATFORM
+    ERR_FAIL_COND_V_MSG(heightmap_data_.empty() || width_ < 2 || height_ < 2, result, "Cannot generate chunks: no heightmap data.");
+    ERR_FAIL_COND_V_MSG(chunks_x < 1 || chunks_y < 1, result, "Chunk counts must be at least 1.");
+    ERR_FAIL_COND_V_MSG(chunks_x > width_ - 1 || chunks_y > height_ - 1, result, "More chunks than heightmap cells.");
+    ERR_FAIL_COND_V_MSG(lod_count < 1 || lod_count > 8, result, "LOD count must be between 1 and 8.");
+
+    HeightmapSampler sampler;
+    sampler.data = heightmap_data_.data();
+    sampler.width = width_;
+    sampler.height = height_;
+    sampler.min = get_min_bounds();
+    sampler.size = get_max_bounds() - sampler.min;
+    sampler.uv_min = get_min_uv();
+    sampler.uv_max = get_max_uv();
+
+    // Chunk boundaries sit on shared samples so neighbouring chunks of the same LOD meet exactly
+    auto chunk_first_sample = [](int chunk, int chunk_count, int sample_count) {
+        return static_cast<int>(static_cast<int64_t>(chunk) * (sample_count - 1) / chunk_count);
+    };
+
+    const size_t chunk_count = static_cast<size_t>(chunks_x) * chunks_y;
+    const size_t job_count = chunk_count * lod_count;
+    std::vector<TerrainSurfaceBuffers> surfaces(job_count);
+    std::vector<Vector3> origins(chunk_count);
+
+    for (size_t chunk = 0; chunk < chunk_count; chunk++) {
+        int cx = static_cast<int>(chunk % chunks_x);
+        int cy = static_cast<int>(chunk / chunks_x);
+        int col0 = chunk_first_sample(cx, chunks_x, width_);
+        int col1 = chunk_first_sample(cx + 1, chunks_x, width_);
+        int row0 = chunk_first_sample(cy, chunks_y, height_);
+        int row1 = chunk_first_sample(cy + 1, chunks_y, height_);
+        Vector3 corner0 = sampler.position(col0, row0);
+        Vector3 corner1 = sampler.position(col1, row1);
+        origins[chunk] = Vector3((corner0.x + corner1.x) * 0.5f, sampler.min.y, (corner0.z + corner1.z) * 0.5f);
+    }
+
+    // Each (chunk, LOD) pair is independent; LOD k keeps every 2^k-th sample
+    plateau_parallel::parallel_for(0, job_count, [&](size_t job) {
+        size_t chunk = job / lod_count;
+        int lod = static_cast<int>(job % lod_count);
+        int cx = static_cast<int>(chunk % chunks_x);
+        int cy = static_cast<int>(chunk / chunks_x);
+        build_grid_surface(sampler,
+                           chunk_first_sample(cx, chunks_x, width_), chunk_first_sample(cx + 1, chunks_x, width_),
+                           chunk_first_sample(cy, chunks_y, height_), chunk_first_sample(cy + 1, chunks_y, height_),
+                           1 << lod, skirt_depth, origins[chunk], surfaces[job]);
+    }, 1);
+
+    // Resource creation stays on the calling thread
+    Ref<StandardMaterial3D> material = get_default_material();
+    int64_t lod0_triangles = 0;
+    for (size_t chunk = 0; chunk < chunk_count; chunk++) {
+        TypedArray<ArrayMesh> lods;
+        for (int lod = 0; lod < lod_count; lod++) {
+            const TerrainSurfaceBuffers &surface = surfaces[chunk * lod_count + lod];
+            lods.push_back(create_terrain_array_mesh(surface, material));
+            if (lod == 0) {
+                lod0_triangles += surface.indices.size() / 3;
+            }
+        }
+
+        Dictionary entry;
+        entry["chunk_x"] = static_cast<int>(chunk % chunks_x);
+        entry["chunk_y"] = static_cast<int>(chunk / chunks_x);
+        entry["origin"] = origins[chunk];
+        entry["lods"] = lods;
+        result.push_back(entry);
+    }
+
+    UtilityFunctions::print("Generated ", static_cast<int64_t>(chunk_count), " terrain chunks x ", lod_count,
+                            " LODs (", lod0_triangles, " triangles at LOD0)");
+#endif
+
+    return result;
+}
+
+Node3D *PLATEAUHeightMapData::create_chunked_terrain(int chunks_x, int chunks_y, int lod_count, float lod_distance, float skirt_depth) const {
+    Array chunks = generate_chunked_meshes(chunks_x, chunks_y, lod_count, skirt_depth);
+    if (chunks.is_empty()) {
+        return nullptr;
+    }
+
+    Node3D *root = memnew(Node3D);
+    root->set_name(name_.is_empty() ? String("Terrain") : name_);
+
+    for (int i = 0; i < chunks.size(); i++) {
+        Dictionary entry = chunks[i];
+        TypedArray<ArrayMesh> lods = entry["lods"];
+
+        Node3D *chunk_node = memnew(Node3D);
+        chunk_node->set_name("Chunk_" + String::num_int64(int(entry["chunk_x"])) + "_" + String::num_int64(int(entry["chunk_y"])));
+        chunk_node->set_position(entry["origin"]);
+        root->add_child(chunk_node);
+
+        // LOD k is visible from lod_distance * 2^(k-1) to lod_distance * 2^k (last LOD to infinity)
+        for (int lod = 0; lod < lods.size(); lod++) {
+            MeshInstance3D *mesh_instance = memnew(MeshInstance3D);
+            mesh_instance->set_name("LOD" + String::num_int64(lod));
+            mesh_instance->set_mesh(lods[lod]);
+            mesh_instance->set_visibility_range_begin(lod == 0 ? 0.0f : lod_distance * static_cast<float>(1 << (lod - 1)));
+            mesh_instance->set_visibility_range_end(lod == lods.size() - 1 ? 0.0f : lod_distance * static_cast<float>(1 << lod));
+            chunk_node->add_child(mesh_instance);
+        }
+    }
+
+    return root;
+}
+
+#ifndef PLATEAU_MOBILE_PLATFORM
+// IEEE 754 binary32 to binary16 with round-to-nearest (for FORMAT_RH images)
+static uint16_t float_to_half(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint32_t sign = (bits >> 16) & 0x8000;
+    const int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xFF) - 127 + 15;
+    uint32_t mantissa = bits & 0x7FFFFF;
+
+    if (exponent <= 0) {
+        // Subnormal half (or zero)
+        if (exponent < -10) {
+            return static_cast<uint16_t>(sign);
+        }
+        mantissa |= 0x800000;
+        const uint32_t shift = static_cast<uint32_t>(14 - exponent);
+        uint32_t half_mantissa = mantissa >> shift;
+        if ((mantissa >> (shift - 1)) & 1) {
+            half_mantissa++;
+        }
+        return static_cast<uint16_t>(sign | half_mantissa);
+    }
+    if (exponent >= 31) {
+        return static_cast<uint16_t>(sign | 0x7C00);
+    }
+
+    uint32_t half = sign | (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+    if (mantissa & 0x1000) {
+        half++; // A carry into the exponent is still the correctly rounded value
+    }
+    return static_cast<uint16_t>(half);
+}
+#endif
+
+Ref<Image> PLATEAUHeightMapData::create_heightmap_image(bool half_precision) const {
+#ifdef PLATEAU_MOBILE_PLATFORM
+    PLATEAU_MOBILE_UNSUPPORTED_V(Ref<Image>());
+#endif
+
+#ifndef PLATEAU_MOBILE_PLATFORM
+    ERR_FAIL_COND_V_MSG(heightmap_data_.empty() || width_ <= 0 || height_ <= 0, Ref<Image>(), "Cannot create image: no heightmap data.");
+
+    // Written in one pass straight from the uint16 samples, bypassing the normalized cache
+    const size_t count = heightmap_data_.size();
+    PackedByteArray bytes;
+    if (half_precision) {
+        bytes.resize(count * sizeof(uint16_t));
+        uint16_t *dst = reinterpret_cast<uint16_t *>(bytes.ptrw());
+        for (size_t i = 0; i < count; i++) {
+            dst[i] = float_to_half(static_cast<float>(heightmap_data_[i]) / 65535.0f);
+        }
+    } else {
+        bytes.resize(count * sizeof(float));
+        float *dst = reinterpret_cast<float *>(bytes.ptrw());
+        for (size_t i = 0; i < count; i++) {
+            dst[i] = static_cast<float>(heightmap_data_[i]) / 65535.0f;
+        }
+    }
+
+    return Image::create_from_data(width_, height_, false, half_precision ? Image::FORMAT_RH : Image::FORMAT_RF, bytes);
+#endif
+}
+
+Ref<ImageTexture> PLATEAUHeightMapData::create_heightmap_texture(bool half_precision) const {
+    Ref<Image> image = create_heightmap_image(half_precision);
+    if (image.is_null()) {
+        return Ref<ImageTexture>();
+    }
+    return ImageTexture::create_from_image(image);
+}
+
+Ref<Image> PLATEAUHeightMapData::create_normal_map_image() const {
+#ifdef PLATEAU_MOBILE_PLATFORM
+    PLATEAU_MOBILE_UNSUPPORTED_V(Ref<Image>());
+#endif
+
+#ifndef PLATEAU_MOBILE_PLATFORM
+    ERR_FAIL_COND_V_MSG(heightmap_data_.empty() || width_ < 2 || height_ < 2, Ref<Image>(), "Cannot create normal map: no heightmap data.");
+
+    HeightmapSampler sampler;
+    sampler.data = heightmap_data_.data();
+    sampler.width = width_;
+    sampler.height = height_;
+    sampler.min = get_min_bounds();
+    sampler.size = get_max_bounds() - sampler.min;
+    sampler.uv_min = get_min_uv();
+    sampler.uv_max = get_max_uv();
+
+    PackedByteArray bytes;
+    bytes.resize(static_cast<int64_t>(width_) * height_ * 3);
+    uint8_t *dst = bytes.ptrw();
+
+    // Rows are independent; each writes its own span of the buffer
+    plateau_parallel::parallel_for(0, static_cast<size_t>(height_), [&](size_t row) {
+        uint8_t *row_dst = dst + row * width_ * 3;
+        for (int col = 0; col < width_; col++) {
+            Vector3 normal = sampler.normal(col, static_cast<int>(row));
+            row_dst[col * 3] = static_cast<uint8_t>(std::lround((normal.x * 0.5f + 0.5f) * 255.0f));
+            row_dst[col * 3 + 1] = static_cast<uint8_t>(std::lround((normal.y * 0.5f + 0.5f) * 255.0f));
+            row_dst[col * 3 + 2] = static_cast<uint8_t>(std::lround((normal.z * 0.5f + 0.5f) * 255.0f));
+        }
+    }, 16);
+
+    return Image::create_from_data(width_, height_, false, Image::FORMAT_RGB8, bytes);
+#endif
+}
+
+Ref<ImageTexture> PLATEAUHeightMapData::create_normal_map_texture() const {
+    Ref<Image> image = create_normal_map_image();
+    if (image.is_null()) {
+        return Ref<ImageTexture>();
+    }
+    return ImageTexture::create_from_image(image);
+}
+
 #ifndef PLATEAU_MOBILE_PLATFORM
 void PLATEAUHeightMapData::set_data(const HeightMapT &heightmap,
                                      int width, int height,
@@ -361,10 +1081,15 @@ void PLATEAUHeightMapData::set_data(const HeightMapT &heightmap,
     max_ = max;
     uv_min_ = uv_min;
     uv_max_ = uv_max;
+    revision_++;
     // Invalidate cache when data changes
     invalidate_cache();
 }
 
+uint64_t PLATEAUHeightMapData::get_revision_internal() const {
+    return revision_;
+}
+
 const HeightMapT& PLATEAUHeightMapData::get_heightmap_internal() const {
     return heightmap_data_;
 }
@@ -403,10 +1128,18 @@ void PLATEAUHeightMapData::_bind_methods() {
     ClassDB::bind_method(D_METHOD("get_heightmap_raw"), &PLATEAUHeightMapData::get_heightmap_raw);
     ClassDB::bind_method(D_METHOD("get_heightmap_normalized"), &PLATEAUHeightMapData::get_heightmap_normalized);
 
+    ClassDB::bind_method(D_METHOD("create_heightmap_image", "half_precision"), &PLATEAUHeightMapData::create_heightmap_image, DEFVAL(false));
+    ClassDB::bind_method(D_METHOD("create_heightmap_texture", "half_precision"), &PLATEAUHeightMapData::create_heightmap_texture, DEFVAL(false));
+    ClassDB::bind_method(D_METHOD("create_normal_map_image"), &PLATEAUHeightMapData::create_normal_map_image);
+    ClassDB::bind_method(D_METHOD("create_normal_map_texture"), &PLATEAUHeightMapData::create_normal_map_texture);
+
     ClassDB::bind_method(D_METHOD("save_png", "path"), &PLATEAUHeightMapData::save_png);
     ClassDB::bind_method(D_METHOD("save_raw", "path"), &PLATEAUHeightMapData::save_raw);
 
     ClassDB::bind_method(D_METHOD("generate_mesh"), &PLATEAUHeightMapData::generate_mesh);
+    ClassDB::bind_method(D_METHOD("generate_adaptive_mesh", "max_error"), &PLATEAUHeightMapData::generate_adaptive_mesh, DEFVAL(0.5f));
+    ClassDB::bind_method(D_METHOD("generate_chunked_meshes", "chunks_x", "chunks_y", "lod_count", "skirt_depth"), &PLATEAUHeightMapData::generate_chunked_meshes, DEFVAL(4), DEFVAL(2.0f));
+    ClassDB::bind_method(D_METHOD("create_chunked_terrain", "chunks_x", "chunks_y", "lod_count", "lod_distance", "skirt_depth"), &PLATEAUHeightMapData::create_chunked_terrain, DEFVAL(4), DEFVAL(200.0f), DEFVAL(2.0f));
 
     ClassDB::bind_method(D_METHOD("clear_cache"), &PLATEAUHeightMapData::clear_cache);
 }
@@ -463,6 +1196,35 @@ bool PLATEAUTerrain::get_apply_blur_filter() const {
     return apply_blur_filter_;
 }
 
+#ifndef PLATEAU_MOBILE_PLATFORM
+// Gather the native relief meshes of mesh_data_array and a combined name for the result
+static void collect_native_meshes(
+    const TypedArray<PLATEAUMeshData> &mesh_data_array,
+    std::vector<std::shared_ptr<const PlateauMesh>> &out_meshes,
+    String &out_name) {
+
+    for (int mesh_idx = 0; mesh_idx < mesh_data_array.size(); mesh_idx++) {
+        Ref<PLATEAUMeshData> mesh_data = mesh_data_array[mesh_idx];
+        if (mesh_data.is_null()) {
+            continue;
+        }
+
+        std::shared_ptr<const PlateauMesh> native_mesh = plateau_utils::get_native_mesh(mesh_data);
+        if (!native_mesh || native_mesh->getVertices().empty() || native_mesh->getIndices().empty()) {
+            continue;
+        }
+
+        // Build combined name
+        if (!out_name.is_empty()) {
+            out_name += "_";
+        }
+        out_name += mesh_data->get_name();
+
+        out_meshes.push_back(std::move(native_mesh));
+    }
+}
+#endif
+
 Ref<PLATEAUHeightMapData> PLATEAUTerrain::generate_from_mesh(const Ref<PLATEAUMeshData> &mesh_data) {
     Ref<PLATEAUHeightMapData> result;
 
@@ -476,154 +1238,447 @@ Ref<PLATEAUHeightMapData> PLATEAUTerrain::generate_from_mesh(const Ref<PLATEAUMe
     Ref<ArrayMesh> godot_mesh = mesh_data->get_mesh();
     ERR_FAIL_COND_V_MSG(godot_mesh.is_null() || godot_mesh->get_surface_count() == 0, result, "PLATEAUTerrain: mesh_data has no mesh.");
 
-    // Convert Godot ArrayMesh to plateau::polygonMesh::Mesh
-    PlateauMesh native_mesh;
+    // Use the retained native mesh directly, or convert all surfaces in one pass
+    std::shared_ptr<const PlateauMesh> native_mesh = plateau_utils::get_native_mesh(mesh_data);
+    ERR_FAIL_COND_V_MSG(!native_mesh, result, "PLATEAUTerrain: mesh has no vertices or indices.");
 
-    // Get surface data
-    Array arrays = godot_mesh->surface_get_arrays(0);
-    ERR_FAIL_COND_V_MSG(arrays.size() < Mesh::ARRAY_VERTEX + 1, result, "PLATEAUTerrain: invalid mesh arrays.");
+    return generate_from_plateau_mesh(*native_mesh, mesh_data->get_name());
+#endif
+}
 
-    PackedVector3Array vertices = arrays[Mesh::ARRAY_VERTEX];
-    PackedInt32Array indices = arrays[Mesh::ARRAY_INDEX];
-    PackedVector2Array uvs;
-    if (arrays.size() > Mesh::ARRAY_TEX_UV && arrays[Mesh::ARRAY_TEX_UV].get_type() == Variant::PACKED_VECTOR2_ARRAY) {
-        uvs = arrays[Mesh::ARRAY_TEX_UV];
+Ref<PLATEAUHeightMapData> PLATEAUTerrain::generate_from_meshes(const TypedArray<PLATEAUMeshData> &mesh_data_array) {
+    Ref<PLATEAUHeightMapData> result;
+
+#ifdef PLATEAU_MOBILE_PLATFORM
+    PLATEAU_MOBILE_UNSUPPORTED_V(result);
+#endif
+
+#ifndef PLATEAU_MOBILE_PLATFORM
+    if (mesh_data_array.is_empty()) {
+        UtilityFunctions::printerr("PLATEAUTerrain: mesh_data_array is empty");
+        return result;
     }
 
-    ERR_FAIL_COND_V_MSG(vertices.is_empty() || indices.is_empty(), result, "PLATEAUTerrain: mesh has no vertices or indices.");
+    std::vector<std::shared_ptr<const PlateauMesh>> native_meshes;
+    String combined_name;
+    collect_native_meshes(mesh_data_array, native_meshes, combined_name);
 
-    // Convert to native mesh
-    std::vector<TVec3d> native_vertices;
-    native_vertices.reserve(vertices.size());
-    for (int i = 0; i < vertices.size(); i++) {
-        Vector3 v = vertices[i];
-        native_vertices.push_back(TVec3d(v.x, v.y, v.z));
+    if (native_meshes.empty()) {
+        UtilityFunctions::printerr("PLATEAUTerrain: no valid mesh data found in array");
+        return result;
     }
 
-    std::vector<unsigned int> native_indices;
-    native_indices.reserve(indices.size());
-    for (int i = 0; i < indices.size(); i++) {
-        native_indices.push_back(static_cast<unsigned int>(indices[i]));
+    // A single mesh needs no merge
+    if (native_meshes.size() == 1) {
+        return generate_from_plateau_mesh(*native_meshes[0], combined_name);
     }
 
-    std::vector<TVec2f> native_uvs;
-    if (!uvs.is_empty()) {
-        native_uvs.reserve(uvs.size());
-        for (int i = 0; i < uvs.size(); i++) {
-            Vector2 uv = uvs[i];
-            native_uvs.push_back(TVec2f(uv.x, 1.0f - uv.y)); // Flip Y back
-        }
+    // Merge all meshes into one, sizing the buffers exactly once
+    size_t total_vertices = 0;
+    size_t total_indices = 0;
+    for (const auto &native_mesh : native_meshes) {
+        total_vertices += native_mesh->getVertices().size();
+        total_indices += native_mesh->getIndices().size();
     }
 
-    // Set mesh data
-    native_mesh.addVerticesList(native_vertices);
-    native_mesh.addIndicesList(native_indices, 0, false);
-    if (!native_uvs.empty()) {
-        native_mesh.setUV1(std::move(native_uvs));
+    std::vector<TVec3d> merged_vertices;
+    std::vector<unsigned int> merged_indices;
+    std::vector<TVec2f> merged_uvs;
+    merged_vertices.reserve(total_vertices);
+    merged_indices.reserve(total_indices);
+    merged_uvs.reserve(total_vertices);
+
+    for (const auto &native_mesh : native_meshes) {
+        const auto &vertices = native_mesh->getVertices();
+        const auto &indices = native_mesh->getIndices();
+        const auto &uvs = native_mesh->getUV1();
+        const unsigned int vertex_offset = static_cast<unsigned int>(merged_vertices.size());
+
+        merged_vertices.insert(merged_vertices.end(), vertices.begin(), vertices.end());
+        for (unsigned int index : indices) {
+            merged_indices.push_back(index + vertex_offset);
+        }
+
+        // Keep UVs aligned with vertices even when a mesh has none
+        if (uvs.size() == vertices.size()) {
+            merged_uvs.insert(merged_uvs.end(), uvs.begin(), uvs.end());
+        } else {
+            merged_uvs.resize(merged_vertices.size(), TVec2f(0.0f, 0.0f));
+        }
     }
 
-    return generate_from_plateau_mesh(native_mesh, mesh_data->get_name());
-#endif
-}
+    PlateauMesh merged_mesh;
+    merged_mesh.addVerticesList(merged_vertices);
+    merged_mesh.addIndicesList(merged_indices, 0, false);
+    merged_mesh.setUV1(std::move(merged_uvs));
 
-Ref<PLATEAUHeightMapData> PLATEAUTerrain::generate_from_meshes(const TypedArray<PLATEAUMeshData> &mesh_data_array) {
-    Ref<PLATEAUHeightMapData> result;
+    UtilityFunctions::print("PLATEAUTerrain: merged ", static_cast<int64_t>(native_meshes.size()), " meshes, ",
+                           static_cast<int64_t>(merged_mesh.getVertices().size()), " vertices");
 
-#ifdef PLATEAU_MOBILE_PLATFORM
-    PLATEAU_MOBILE_UNSUPPORTED_V(result);
+    return generate_from_plateau_mesh(merged_mesh, combined_name);
 #endif
+}
 
 #ifndef PLATEAU_MOBILE_PLATFORM
-    if (mesh_data_array.is_empty()) {
-        UtilityFunctions::printerr("PLATEAUTerrain: mesh_data_array is empty");
-        return result;
+// Relief triangle projected to the XZ plane, with Y as height (Godot / EUN axes)
+struct ReliefTriangle {
+    double x[3];
+    double y[3];
+    double z[3];
+};
+
+// Sample the relief on a tile grid: sample (col, row) sits at origin + (col * step_x, row * step_z).
+// Samples no triangle covers are left as NaN. Overlapping triangles keep the highest surface.
+static void rasterize_relief_tile(
+    const std::vector<ReliefTriangle> &triangles,
+    const std::vector<uint32_t> &triangle_ids,
+    double origin_x, double origin_z,
+    double step_x, double step_z,
+    int count_x, int count_z,
+    std::vector<float> &out_heights) {
+
+    const double epsilon = 1e-9;
+    out_heights.assign(static_cast<size_t>(count_x) * count_z, std::numeric_limits<float>::quiet_NaN());
+
+    for (uint32_t id : triangle_ids) {
+        const ReliefTriangle &t = triangles[id];
+
+        const double denom = (t.z[1] - t.z[2]) * (t.x[0] - t.x[2]) + (t.x[2] - t.x[1]) * (t.z[0] - t.z[2]);
+        if (std::abs(denom) < 1e-12) {
+            continue; // Degenerate (vertical) triangle
+        }
+
+        // Sample range covered by the triangle's bounding box
+        double min_x = std::min({t.x[0], t.x[1], t.x[2]});
+        double max_x = std::max({t.x[0], t.x[1], t.x[2]});
+        double min_z = std::min({t.z[0], t.z[1], t.z[2]});
+        double max_z = std::max({t.z[0], t.z[1], t.z[2]});
+
+        double col_begin_f = std::ceil((min_x - origin_x) / step_x - epsilon);
+        double col_end_f = std::floor((max_x - origin_x) / step_x + epsilon);
+        double row_begin_f = std::ceil((min_z - origin_z) / step_z - epsilon);
+        double row_end_f = std::floor((max_z - origin_z) / step_z + epsilon);
+
+        int col_begin = static_cast<int>(std::max(0.0, col_begin_f));
+        int col_end = static_cast<int>(std::min(static_cast<double>(count_x - 1), col_end_f));
+        int row_begin = static_cast<int>(std::max(0.0, row_begin_f));
+        int row_end = static_cast<int>(std::min(static_cast<double>(count_z - 1), row_end_f));
+
+        for (int row = row_begin; row <= row_end; row++) {
+            const double pz = origin_z + row * step_z;
+            float *dst_row = out_heights.data() + static_cast<size_t>(row) * count_x;
+
+            for (int col = col_begin; col <= col_end; col++) {
+                const double px = origin_x + col * step_x;
+
+                // Barycentric weights in the XZ plane
+                const double w0 = ((t.z[1] - t.z[2]) * (px - t.x[2]) + (t.x[2] - t.x[1]) * (pz - t.z[2])) / denom;
+                const double w1 = ((t.z[2] - t.z[0]) * (px - t.x[2]) + (t.x[0] - t.x[2]) * (pz - t.z[2])) / denom;
+                const double w2 = 1.0 - w0 - w1;
+                if (w0 < -epsilon || w1 < -epsilon || w2 < -epsilon) {
+                    continue;
+                }
+
+                const float height = static_cast<float>(w0 * t.y[0] + w1 * t.y[1] + w2 * t.y[2]);
+                float &dst = dst_row[col];
+                if (std::isnan(dst) || height > dst) {
+                    dst = height;
+                }
+            }
+        }
     }
+}
 
-    // Merge all meshes into one
-    PlateauMesh merged_mesh;
-    String combined_name;
+// Replace uncovered samples with the nearest covered sample in the same row, then copy
+// the nearest filled row into rows with no coverage at all. Used when fill_edges is on.
+static void fill_uncovered_samples(std::vector<float> &heights, int count_x, int count_z, float fallback) {
+    std::vector<bool> row_filled(count_z, false);
 
-    for (int mesh_idx = 0; mesh_idx < mesh_data_array.size(); mesh_idx++) {
-        Ref<PLATEAUMeshData> mesh_data = mesh_data_array[mesh_idx];
-        if (mesh_data.is_null()) {
+    for (int row = 0; row < count_z; row++) {
+        float *values = heights.data() + static_cast<size_t>(row) * count_x;
+
+        int last_covered = -1;
+        for (int col = 0; col < count_x; col++) {
+            if (std::isnan(values[col])) {
+                continue;
+            }
+            // Fill the gap before this sample from whichever covered side is nearer
+            for (int gap = last_covered + 1; gap < col; gap++) {
+                bool use_left = last_covered >= 0 && (gap - last_covered) <= (col - gap);
+                values[gap] = use_left ? values[last_covered] : values[col];
+            }
+            last_covered = col;
+        }
+
+        if (last_covered < 0) {
             continue;
         }
+        for (int col = last_covered + 1; col < count_x; col++) {
+            values[col] = values[last_covered];
+        }
+        row_filled[row] = true;
+    }
 
-        Ref<ArrayMesh> godot_mesh = mesh_data->get_mesh();
-        if (godot_mesh.is_null() || godot_mesh->get_surface_count() == 0) {
+    // Rows without any coverage take the nearest filled row
+    for (int row = 0; row < count_z; row++) {
+        if (row_filled[row]) {
             continue;
         }
+        int source = -1;
+        for (int distance = 1; distance < count_z && source < 0; distance++) {
+            if (row - distance >= 0 && row_filled[row - distance]) {
+                source = row - distance;
+            } else if (row + distance < count_z && row_filled[row + distance]) {
+                source = row + distance;
+            }
+        }
 
-        // Build combined name
-        if (!combined_name.is_empty()) {
-            combined_name += "_";
+        float *values = heights.data() + static_cast<size_t>(row) * count_x;
+        if (source >= 0) {
+            const float *source_values = heights.data() + static_cast<size_t>(source) * count_x;
+            std::copy(source_values, source_values + count_x, values);
+        } else {
+            std::fill(values, values + count_x, fallback);
         }
-        combined_name += mesh_data->get_name();
+    }
+}
 
-        // Process all surfaces
-        for (int surface_idx = 0; surface_idx < godot_mesh->get_surface_count(); surface_idx++) {
-            Array arrays = godot_mesh->surface_get_arrays(surface_idx);
-            if (arrays.size() < Mesh::ARRAY_VERTEX + 1) {
+#endif
+
+TypedArray<PLATEAUHeightMapData> PLATEAUTerrain::generate_tiled_from_meshes(
+    const TypedArray<PLATEAUMeshData> &mesh_data_array, int tiles_x, int tiles_y) {
+    TypedArray<PLATEAUHeightMapData> result;
+
+#ifdef PLATEAU_MOBILE_PLATFORM
+    PLATEAU_MOBILE_UNSUPPORTED_V(result);
+#endif
+
+#ifndef PLATEAU_MOBILE_PLATFORM
+
+    ERR_FAIL_COND_V_MSG(mesh_data_array.is_empty(), result, "PLATEAUTerrain: mesh_data_array is empty.");
+    ERR_FAIL_COND_V_MSG(tiles_x < 1 || tiles_y < 1, result, "PLATEAUTerrain: tile counts must be at least 1.");
+    ERR_FAIL_COND_V_MSG(texture_width_ < 2 || texture_height_ < 2, result, "PLATEAUTerrain: tiled generation needs texture_width and texture_height of at least 2.");
+
+    std::vector<std::shared_ptr<const PlateauMesh>> native_meshes;
+    String combined_name;
+    collect_native_meshes(mesh_data_array, native_meshes, combined_name);
+    ERR_FAIL_COND_V_MSG(native_meshes.empty(), result, "PLATEAUTerrain: no valid mesh data found in array.");
+
+    // Flatten all relief triangles and measure the shared extent, height range and UV range
+    std::vector<ReliefTriangle> triangles;
+    TVec3d extent_min(DBL_MAX, DBL_MAX, DBL_MAX);
+    TVec3d extent_max(-DBL_MAX, -DBL_MAX, -DBL_MAX);
+    TVec2f uv_min(FLT_MAX, FLT_MAX);
+    TVec2f uv_max(-FLT_MAX, -FLT_MAX);
+
+    size_t total_triangles = 0;
+    for (const auto &native_mesh : native_meshes) {
+        total_triangles += native_mesh->getIndices().size() / 3;
+    }
+    triangles.reserve(total_triangles);
+
+    for (const auto &native_mesh : native_meshes) {
+        const auto &vertices = native_mesh->getVertices();
+        const auto &indices = native_mesh->getIndices();
+
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            ReliefTriangle t;
+            bool valid = true;
+            for (int k = 0; k < 3; k++) {
+                unsigned int index = indices[i + k];
+                if (index >= vertices.size()) {
+                    valid = false;
+                    break;
+                }
+                const TVec3d &v = vertices[index];
+                t.x[k] = v.x;
+                t.y[k] = v.y;
+                t.z[k] = v.z;
+            }
+            if (!valid) {
                 continue;
             }
 
-            PackedVector3Array vertices = arrays[Mesh::ARRAY_VERTEX];
-            PackedInt32Array indices;
-            if (arrays.size() > Mesh::ARRAY_INDEX && arrays[Mesh::ARRAY_INDEX].get_type() == Variant::PACKED_INT32_ARRAY) {
-                indices = arrays[Mesh::ARRAY_INDEX];
+            for (int k = 0; k < 3; k++) {
+                extent_min.x = std::min(extent_min.x, t.x[k]);
+                extent_min.y = std::min(extent_min.y, t.y[k]);
+                extent_min.z = std::min(extent_min.z, t.z[k]);
+                extent_max.x = std::max(extent_max.x, t.x[k]);
+                extent_max.y = std::max(extent_max.y, t.y[k]);
+                extent_max.z = std::max(extent_max.z, t.z[k]);
             }
+            triangles.push_back(t);
+        }
 
-            if (vertices.is_empty() || indices.is_empty()) {
-                continue;
-            }
+        for (const auto &uv : native_mesh->getUV1()) {
+            uv_min.x = std::min(uv_min.x, uv.x);
+            uv_min.y = std::min(uv_min.y, uv.y);
+            uv_max.x = std::max(uv_max.x, uv.x);
+            uv_max.y = std::max(uv_max.y, uv.y);
+        }
+    }
+
+    ERR_FAIL_COND_V_MSG(triangles.empty(), result, "PLATEAUTerrain: meshes contain no triangles.");
+    ERR_FAIL_COND_V_MSG(extent_max.x <= extent_min.x || extent_max.z <= extent_min.z, result, "PLATEAUTerrain: relief has no horizontal extent.");
 
-            // Get current vertex count for index offset
-            size_t vertex_offset = merged_mesh.getVertices().size();
+    if (uv_min.x > uv_max.x) {
+        uv_min = TVec2f(0, 0);
+        uv_max = TVec2f(1, 1);
+    }
+
+    // Widen the extent by the offset margin on every side, as generateFromMesh does for the
+    // single heightmap. UVs are extended at the same rate so the texture stays in place.
+    if (offset_.x != 0.0 || offset_.y != 0.0) {
+        const float uv_margin_x = (uv_max.x - uv_min.x) * static_cast<float>(offset_.x / (extent_max.x - extent_min.x));
+        const float uv_margin_y = (uv_max.y - uv_min.y) * static_cast<float>(offset_.y / (extent_max.z - extent_min.z));
+        extent_min.x -= offset_.x;
+        extent_max.x += offset_.x;
+        extent_min.z -= offset_.y;
+        extent_max.z += offset_.y;
+        uv_min = TVec2f(uv_min.x - uv_margin_x, uv_min.y - uv_margin_y);
+        uv_max = TVec2f(uv_max.x + uv_margin_x, uv_max.y + uv_margin_y);
+        ERR_FAIL_COND_V_MSG(extent_max.x <= extent_min.x || extent_max.z <= extent_min.z, result, "PLATEAUTerrain: offset leaves no horizontal extent.");
+    }
 
-            // Add vertices
-            std::vector<TVec3d> native_vertices;
-            native_vertices.reserve(vertices.size());
-            for (int i = 0; i < vertices.size(); i++) {
-                Vector3 v = vertices[i];
-                native_vertices.push_back(TVec3d(v.x, v.y, v.z));
+    // Tiles split the extent evenly; each tile's samples span its full extent, so the
+    // last column/row of one tile lands exactly on the first column/row of the next
+    const double tile_size_x = (extent_max.x - extent_min.x) / tiles_x;
+    const double tile_size_z = (extent_max.z - extent_min.z) / tiles_y;
+    const double step_x = tile_size_x / (texture_width_ - 1);
+    const double step_z = tile_size_z / (texture_height_ - 1);
+
+    // One extra ring of samples lets the blur see across tile borders
+    const int halo = apply_blur_filter_ ? 1 : 0;
+    const int count_x = texture_width_ + halo * 2;
+    const int count_z = texture_height_ + halo * 2;
+
+    // Bin triangles into every tile (including halo) their bounding box touches
+    const size_t tile_count = static_cast<size_t>(tiles_x) * tiles_y;
+    std::vector<std::vector<uint32_t>> tile_triangles(tile_count);
+    for (size_t i = 0; i < triangles.size(); i++) {
+        const ReliefTriangle &t = triangles[i];
+        double min_x = std::min({t.x[0], t.x[1], t.x[2]}) - extent_min.x - halo * step_x;
+        double max_x = std::max({t.x[0], t.x[1], t.x[2]}) - extent_min.x + halo * step_x;
+        double min_z = std::min({t.z[0], t.z[1], t.z[2]}) - extent_min.z - halo * step_z;
+        double max_z = std::max({t.z[0], t.z[1], t.z[2]}) - extent_min.z + halo * step_z;
+
+        int tx_begin = std::clamp(static_cast<int>(std::floor(min_x / tile_size_x)), 0, tiles_x - 1);
+        int tx_end = std::clamp(static_cast<int>(std::floor(max_x / tile_size_x)), 0, tiles_x - 1);
+        int ty_begin = std::clamp(static_cast<int>(std::floor(min_z / tile_size_z)), 0, tiles_y - 1);
+        int ty_end = std::clamp(static_cast<int>(std::floor(max_z / tile_size_z)), 0, tiles_y - 1);
+
+        for (int ty = ty_begin; ty <= ty_end; ty++) {
+            for (int tx = tx_begin; tx <= tx_end; tx++) {
+                tile_triangles[static_cast<size_t>(ty) * tiles_x + tx].push_back(static_cast<uint32_t>(i));
             }
-            merged_mesh.addVerticesList(native_vertices);
+        }
+    }
 
-            // Add indices with offset
-            std::vector<unsigned int> native_indices;
-            native_indices.reserve(indices.size());
-            for (int i = 0; i < indices.size(); i++) {
-                native_indices.push_back(static_cast<unsigned int>(indices[i] + vertex_offset));
+    // Rasterize tiles in parallel; every tile is quantized against the shared height range
+    const double min_height = extent_min.y;
+    const double height_range = extent_max.y - extent_min.y;
+    const bool fill_edges = fill_edges_;
+    std::vector<HeightMapT> tile_maps(tile_count);
+
+    plateau_parallel::parallel_for(0, tile_count, [&](size_t tile_index) {
+        const int tx = static_cast<int>(tile_index % tiles_x);
+        const int ty = static_cast<int>(tile_index / tiles_x);
+        const double origin_x = extent_min.x + tx * tile_size_x - halo * step_x;
+        const double origin_z = extent_min.z + ty * tile_size_z - halo * step_z;
+
+        std::vector<float> heights;
+        rasterize_relief_tile(triangles, tile_triangles[tile_index],
+                              origin_x, origin_z, step_x, step_z, count_x, count_z, heights);
+
+        if (fill_edges) {
+            fill_uncovered_samples(heights, count_x, count_z, static_cast<float>(min_height));
+        } else {
+            for (float &h : heights) {
+                if (std::isnan(h)) {
+                    h = static_cast<float>(min_height);
+                }
             }
-            merged_mesh.addIndicesList(native_indices, 0, false);
-
-            // Add UVs if present
-            if (arrays.size() > Mesh::ARRAY_TEX_UV && arrays[Mesh::ARRAY_TEX_UV].get_type() == Variant::PACKED_VECTOR2_ARRAY) {
-                PackedVector2Array uvs = arrays[Mesh::ARRAY_TEX_UV];
-                if (!uvs.is_empty()) {
-                    std::vector<TVec2f> native_uvs;
-                    native_uvs.reserve(uvs.size());
-                    for (int i = 0; i < uvs.size(); i++) {
-                        Vector2 uv = uvs[i];
-                        native_uvs.push_back(TVec2f(uv.x, 1.0f - uv.y));
-                    }
-                    // Append to existing UVs
-                    auto& existing_uvs = const_cast<std::vector<TVec2f>&>(merged_mesh.getUV1());
-                    existing_uvs.insert(existing_uvs.end(), native_uvs.begin(), native_uvs.end());
+        }
+
+        // Halo samples beyond the global extent have no relief; replicate the border so the
+        // blur doesn't pull the terrain's outer edge toward min_height
+        if (halo > 0) {
+            for (int row = 0; row < count_z; row++) {
+                float *line = heights.data() + static_cast<size_t>(row) * count_x;
+                if (tx == 0) {
+                    line[0] = line[1];
+                }
+                if (tx == tiles_x - 1) {
+                    line[count_x - 1] = line[count_x - 2];
                 }
             }
+            if (ty == 0) {
+                std::copy_n(heights.data() + count_x, count_x, heights.data());
+            }
+            if (ty == tiles_y - 1) {
+                std::copy_n(heights.data() + static_cast<size_t>(count_z - 2) * count_x, count_x,
+                            heights.data() + static_cast<size_t>(count_z - 1) * count_x);
+            }
         }
-    }
 
-    if (merged_mesh.getVertices().empty() || merged_mesh.getIndices().empty()) {
-        UtilityFunctions::printerr("PLATEAUTerrain: no valid mesh data found in array");
-        return result;
+        HeightMapT &heightmap = tile_maps[tile_index];
+        heightmap.resize(static_cast<size_t>(texture_width_) * texture_height_);
+
+        for (int row = 0; row < texture_height_; row++) {
+            for (int col = 0; col < texture_width_; col++) {
+                const int src_col = col + halo;
+                const int src_row = row + halo;
+
+                double height;
+                if (halo > 0) {
+                    // 3x3 box blur
+                    double sum = 0.0;
+                    for (int dz = -1; dz <= 1; dz++) {
+                        const float *src = heights.data() + static_cast<size_t>(src_row + dz) * count_x;
+                        sum += src[src_col - 1] + src[src_col] + src[src_col + 1];
+                    }
+                    height = sum / 9.0;
+                } else {
+                    height = heights[static_cast<size_t>(src_row) * count_x + src_col];
+                }
+
+                double normalized = height_range > 0.0 ? (height - min_height) / height_range : 0.0;
+                normalized = std::clamp(normalized, 0.0, 1.0);
+                heightmap[static_cast<size_t>(row) * texture_width_ + col] =
+                    static_cast<HeightMapElemT>(std::lround(normalized * 65535.0));
+            }
+        }
+    }, 1);
+
+    // Wrap tiles on the calling thread
+    const float uv_size_x = uv_max.x - uv_min.x;
+    const float uv_size_y = uv_max.y - uv_min.y;
+    for (int ty = 0; ty < tiles_y; ty++) {
+        for (int tx = 0; tx < tiles_x; tx++) {
+            const size_t tile_index = static_cast<size_t>(ty) * tiles_x + tx;
+
+            TVec3d tile_min(extent_min.x + tx * tile_size_x, extent_min.y, extent_min.z + ty * tile_size_z);
+            TVec3d tile_max(extent_min.x + (tx + 1) * tile_size_x, extent_max.y, extent_min.z + (ty + 1) * tile_size_z);
+            TVec2f tile_uv_min(uv_min.x + uv_size_x * static_cast<float>(tx) / tiles_x,
+                               uv_min.y + uv_size_y * static_cast<float>(ty) / tiles_y);
+            TVec2f tile_uv_max(uv_min.x + uv_size_x * static_cast<float>(tx + 1) / tiles_x,
+                               uv_min.y + uv_size_y * static_cast<float>(ty + 1) / tiles_y);
+
+            Ref<PLATEAUHeightMapData> tile;
+            tile.instantiate();
+            tile->set_name(combined_name + "_" + String::num_int64(tx) + "_" + String::num_int64(ty));
+            tile->set_data(tile_maps[tile_index], texture_width_, texture_height_,
+                           tile_min, tile_max, tile_uv_min, tile_uv_max);
+            result.push_back(tile);
+
+            tile_maps[tile_index] = HeightMapT();
+        }
     }
 
-    UtilityFunctions::print("PLATEAUTerrain: merged ", static_cast<int64_t>(mesh_data_array.size()), " meshes, ",
-                           static_cast<int64_t>(merged_mesh.getVertices().size()), " vertices");
+    UtilityFunctions::print("PLATEAUTerrain: generated ", tiles_x, "x", tiles_y, " heightmap tiles of ",
+                           texture_width_, "x", texture_height_, " from ", static_cast<int64_t>(triangles.size()), " triangles");
 
-    return generate_from_plateau_mesh(merged_mesh, combined_name);
+    return result;
 #endif
 }
 
@@ -713,6 +1768,45 @@ void PLATEAUTerrain::_generate_thread_func() {
 #endif
 }
 
+void PLATEAUTerrain::generate_tiled_from_meshes_async(const TypedArray<PLATEAUMeshData> &mesh_data_array, int tiles_x, int tiles_y) {
+#ifdef PLATEAU_MOBILE_PLATFORM
+    PLATEAU_MOBILE_UNSUPPORTED();
+#endif
+
+#ifndef PLATEAU_MOBILE_PLATFORM
+    if (is_processing_.load()) {
+        UtilityFunctions::printerr("PLATEAUTerrain: Already processing");
+        return;
+    }
+
+    if (mesh_data_array.is_empty()) {
+        UtilityFunctions::printerr("PLATEAUTerrain: mesh_data_array is empty");
+        call_deferred("emit_signal", "generate_tiled_completed", TypedArray<PLATEAUHeightMapData>());
+        return;
+    }
+
+    is_processing_.store(true);
+    pending_mesh_data_ = mesh_data_array;
+    pending_tiles_x_ = tiles_x;
+    pending_tiles_y_ = tiles_y;
+
+    WorkerThreadPool::get_singleton()->add_task(
+        callable_mp(this, &PLATEAUTerrain::_generate_tiled_thread_func)
+    );
+#endif
+}
+
+void PLATEAUTerrain::_generate_tiled_thread_func() {
+#ifndef PLATEAU_MOBILE_PLATFORM
+    TypedArray<PLATEAUHeightMapData> result = generate_tiled_from_meshes(pending_mesh_data_, pending_tiles_x_, pending_tiles_y_);
+
+    is_processing_.store(false);
+    pending_mesh_data_.clear();
+
+    call_deferred("emit_signal", "generate_tiled_completed", result);
+#endif
+}
+
 bool PLATEAUTerrain::is_processing() const {
     return is_processing_.load();
 }
@@ -741,8 +1835,11 @@ void PLATEAUTerrain::_bind_methods() {
     ClassDB::bind_method(D_METHOD("generate_from_mesh", "mesh_data"), &PLATEAUTerrain::generate_from_mesh);
     ClassDB::bind_method(D_METHOD("generate_from_meshes", "mesh_data_array"), &PLATEAUTerrain::generate_from_meshes);
     ClassDB::bind_method(D_METHOD("generate_from_meshes_async", "mesh_data_array"), &PLATEAUTerrain::generate_from_meshes_async);
+    ClassDB::bind_method(D_METHOD("generate_tiled_from_meshes", "mesh_data_array", "tiles_x", "tiles_y"), &PLATEAUTerrain::generate_tiled_from_meshes);
+    ClassDB::bind_method(D_METHOD("generate_tiled_from_meshes_async", "mesh_data_array", "tiles_x", "tiles_y"), &PLATEAUTerrain::generate_tiled_from_meshes_async);
     ClassDB::bind_method(D_METHOD("is_processing"), &PLATEAUTerrain::is_processing);
 
     // Signal for async completion
     ADD_SIGNAL(MethodInfo("generate_completed", PropertyInfo(Variant::OBJECT, "heightmap_data", PROPERTY_HINT_RESOURCE_TYPE, "PLATEAUHeightMapData")));
+    ADD_SIGNAL(MethodInfo("generate_tiled_completed", PropertyInfo(Variant::ARRAY, "heightmaps")));
 }
@@ -4,6 +4,7 @@
 
 #include <godot_cpp/classes/ref_counted.hpp>
 #include <godot_cpp/classes/array_mesh.hpp>
+#include <godot_cpp/classes/node3d.hpp>
 #include <godot_cpp/classes/standard_material3d.hpp>
 #include <godot_cpp/classes/image_texture.hpp>
 #include <godot_cpp/classes/worker_thread_pool.hpp>
@@ -65,6 +66,15 @@ public:
     // Get heightmap as normalized float array [0.0 - 1.0]
     PackedFloat32Array get_heightmap_normalized() const;
 
+    // Heightmap as a single-channel float image ([0, 1] normalized) for use in shaders.
+    // FORMAT_RF keeps the full 16-bit precision; FORMAT_RH (half_precision) halves the size
+    Ref<Image> create_heightmap_image(bool half_precision = false) const;
+    Ref<ImageTexture> create_heightmap_texture(bool half_precision = false) const;
+
+    // World-space normal map (FORMAT_RGB8, normal * 0.5 + 0.5), computed in parallel
+    Ref<Image> create_normal_map_image() const;
+    Ref<ImageTexture> create_normal_map_texture() const;
+
     // Save heightmap to file
     bool save_png(const String &path) const;
     bool save_raw(const String &path) const;
@@ -72,6 +82,17 @@ public:
     // Generate mesh from heightmap
     Ref<ArrayMesh> generate_mesh() const;
 
+    // Generate a mesh with adaptive (RTIN) triangulation: flat areas get few large triangles
+    // while keeping the vertical error around max_error meters
+    Ref<ArrayMesh> generate_adaptive_mesh(float max_error = 0.5f) const;
+
+    // Generate a grid of chunk meshes, each with lod_count decimation levels (1x, 2x, 4x, ...)
+    // and skirts. Returns an Array of Dictionaries: {chunk_x, chunk_y, origin, lods}
+    Array generate_chunked_meshes(int chunks_x, int chunks_y, int lod_count = 4, float skirt_depth = 2.0f) const;
+
+    // Build a node tree of chunk MeshInstance3Ds with visibility ranges per LOD
+    Node3D *create_chunked_terrain(int chunks_x, int chunks_y, int lod_count = 4, float lod_distance = 200.0f, float skirt_depth = 2.0f) const;
+
     // Clear cached data to free memory
     void clear_cache();
 
@@ -86,6 +107,9 @@ public:
     const plateau::heightMapGenerator::HeightMapT& get_heightmap_internal() const;
     TVec3d get_min_internal() const;
     TVec3d get_max_internal() const;
+
+    // Internal: Incremented whenever set_data() replaces the heightmap
+    uint64_t get_revision_internal() const;
 #endif
 
 protected:
@@ -103,6 +127,7 @@ private:
     TVec2f uv_min_;
     TVec2f uv_max_;
     plateau::heightMapGenerator::HeightMapT heightmap_data_;
+    uint64_t revision_ = 0;
 
     // Cached converted data
     mutable PackedByteArray cached_raw_;
@@ -110,6 +135,10 @@ private:
     mutable bool cached_raw_valid_ = false;
     mutable bool cached_normalized_valid_ = false;
 
+    // Default material shared by every mesh generated from this heightmap
+    mutable Ref<StandardMaterial3D> default_material_;
+    Ref<StandardMaterial3D> get_default_material() const;
+
     // Internal: Invalidate cache when data changes
     void invalidate_cache();
 #endif
@@ -163,6 +192,15 @@ public:
     // Async version - emits generate_completed signal when done
     void generate_from_meshes_async(const TypedArray<PLATEAUMeshData> &mesh_data_array);
 
+    // Generate a tiles_x * tiles_y grid of heightmaps covering the merged relief extent
+    // Each tile is texture_width x texture_height and shares its border samples with its
+    // neighbours; all tiles use the same height range. Tiles are rasterized in parallel.
+    // Returned in row-major order (index = tile_y * tiles_x + tile_x)
+    TypedArray<PLATEAUHeightMapData> generate_tiled_from_meshes(const TypedArray<PLATEAUMeshData> &mesh_data_array, int tiles_x, int tiles_y);
+
+    // Async version - emits generate_tiled_completed signal when done
+    void generate_tiled_from_meshes_async(const TypedArray<PLATEAUMeshData> &mesh_data_array, int tiles_x, int tiles_y);
+
     // Check if async generation is in progress
     bool is_processing() const;
 
@@ -185,9 +223,12 @@ private:
     // Async processing state
     std::atomic<bool> is_processing_{false};
     TypedArray<PLATEAUMeshData> pending_mesh_data_;
+    int pending_tiles_x_ = 1;
+    int pending_tiles_y_ = 1;
 
-    // Async worker function
+    // Async worker functions
     void _generate_thread_func();
+    void _generate_tiled_thread_func();
 };
 
 } // namespace godot
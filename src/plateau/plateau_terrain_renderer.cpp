@@ -0,0 +1,508 @@
+#include "plateau_terrain_renderer.h"
+#include <godot_cpp/classes/viewport.hpp>
+#include <godot_cpp/classes/mesh.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace godot;
+
+// Spatial shader that displaces the shared patch mesh by the heightmap texture.
+// Patch vertices lie in [0, 1] on XZ; VERTEX.y is 1 for skirt vertices and 0 otherwise.
+// INSTANCE_CUSTOM carries (patch origin x, patch origin z, patch size, lod level).
+static const char *TERRAIN_SHADER_CODE = R"(
+shader_type spatial;
+render_mode cull_back;
+
+uniform sampler2D height_map : filter_linear, repeat_disable;
+uniform sampler2D albedo_texture : source_color, filter_linear_mipmap, repeat_disable;
+uniform bool use_albedo_texture = false;
+uniform vec4 albedo_color : source_color = vec4(1.0);
+uniform vec3 terrain_min = vec3(0.0);
+uniform vec3 terrain_size = vec3(1.0);
+uniform vec2 height_map_size = vec2(2.0);
+uniform vec2 uv_min = vec2(0.0);
+uniform vec2 uv_max = vec2(1.0);
+uniform float skirt_depth = 2.0;
+
+varying vec2 terrain_coord;
+
+float get_height(vec2 coord) {
+	// Sample i sits at the centre of texel i, so coord 0..1 spans first to last sample
+	vec2 uv = (coord * (height_map_size - 1.0) + 0.5) / height_map_size;
+	return terrain_min.y + textureLod(height_map, uv, 0.0).r * terrain_size.y;
+}
+
+void vertex() {
+	vec2 local_xz = INSTANCE_CUSTOM.xy + VERTEX.xz * INSTANCE_CUSTOM.z;
+	local_xz = clamp(local_xz, terrain_min.xz, terrain_min.xz + terrain_size.xz);
+	terrain_coord = (local_xz - terrain_min.xz) / max(terrain_size.xz, vec2(0.0001));
+
+	float height = get_height(terrain_coord) - VERTEX.y * skirt_depth;
+	VERTEX = vec3(local_xz.x, height, local_xz.y);
+
+	// Central differences over one heightmap sample
+	vec2 texel = 1.0 / max(height_map_size - 1.0, vec2(1.0));
+	vec2 spacing = max(terrain_size.xz * texel, vec2(0.0001));
+	float h_left = get_height(terrain_coord - vec2(texel.x, 0.0));
+	float h_right = get_height(terrain_coord + vec2(texel.x, 0.0));
+	float h_back = get_height(terrain_coord - vec2(0.0, texel.y));
+	float h_front = get_height(terrain_coord + vec2(0.0, texel.y));
+	NORMAL = normalize(vec3((h_left - h_right) / (2.0 * spacing.x), 1.0, (h_back - h_front) / (2.0 * spacing.y)));
+}
+
+void fragment() {
+	vec4 color = albedo_color;
+	if (use_albedo_texture) {
+		vec2 uv = mix(uv_min, uv_max, terrain_coord);
+		color *= texture(albedo_texture, vec2(uv.x, 1.0 - uv.y));
+	}
+	ALBEDO = color.rgb;
+	ROUGHNESS = 1.0;
+}
+)";
+
+PLATEAUTerrainRenderer::PLATEAUTerrainRenderer() :
+    camera_(nullptr),
+    patch_resolution_(32),
+    lod_levels_(8),
+    lod_distance_factor_(2.0f),
+    skirt_depth_(2.0f),
+    instance_(nullptr),
+    texel_spacing_(0.0),
+    patch_count_(0),
+    patch_triangle_count_(0),
+    needs_update_(true),
+    has_last_camera_position_(false) {
+    Ref<Shader> shader;
+    shader.instantiate();
+    shader->set_code(TERRAIN_SHADER_CODE);
+
+    material_.instantiate();
+    material_->set_shader(shader);
+}
+
+PLATEAUTerrainRenderer::~PLATEAUTerrainRenderer() {
+}
+
+void PLATEAUTerrainRenderer::_ready() {
+    ensure_instance();
+    if (has_terrain() && height_texture_.is_null()) {
+        rebuild();
+    }
+    set_process(true);
+}
+
+void PLATEAUTerrainRenderer::_process(double delta) {
+    if (!has_terrain() || height_texture_.is_null()) {
+        return;
+    }
+
+    Vector3 camera_position = terrain_min_ + terrain_size_ * 0.5;
+    Camera3D *camera = get_tracked_camera();
+    if (camera) {
+        camera_position = to_local(camera->get_global_position());
+    }
+
+    // Skip re-selection until the camera has moved by at least one cell of the finest patch
+    if (!needs_update_ && has_last_camera_position_) {
+        double root_size = std::max(terrain_size_.x, terrain_size_.z);
+        double finest_cell = root_size / (1 << (lod_levels_ - 1)) / patch_resolution_;
+        if (last_camera_position_.distance_to(camera_position) < finest_cell) {
+            return;
+        }
+    }
+
+    update_lod(camera_position);
+}
+
+Camera3D *PLATEAUTerrainRenderer::get_tracked_camera() const {
+    if (camera_) {
+        return camera_;
+    }
+
+    Viewport *viewport = get_viewport();
+    if (viewport) {
+        return viewport->get_camera_3d();
+    }
+
+    return nullptr;
+}
+
+bool PLATEAUTerrainRenderer::has_terrain() const {
+    return heightmap_.is_valid() && heightmap_->get_width() >= 2 && heightmap_->get_height() >= 2;
+}
+
+void PLATEAUTerrainRenderer::ensure_instance() {
+    if (instance_) {
+        return;
+    }
+
+    multimesh_.instantiate();
+    multimesh_->set_transform_format(MultiMesh::TRANSFORM_3D);
+    multimesh_->set_use_custom_data(true);
+    if (patch_mesh_.is_valid()) {
+        multimesh_->set_mesh(patch_mesh_);
+    }
+
+    instance_ = memnew(MultiMeshInstance3D);
+    instance_->set_name("TerrainPatches");
+    instance_->set_multimesh(multimesh_);
+    instance_->set_material_override(material_);
+    add_child(instance_, false, INTERNAL_MODE_FRONT);
+}
+
+// ============================================================================
+// Resource building
+// ============================================================================
+
+Ref<ArrayMesh> PLATEAUTerrainRenderer::build_patch_mesh(int resolution, int64_t &out_triangle_count) {
+    const int side = resolution + 1;
+    const int grid_vertex_count = side * side;
+    const int perimeter_count = resolution * 4;
+
+    PackedVector3Array vertices;
+    vertices.resize(grid_vertex_count + perimeter_count);
+    Vector3 *vertex_ptr = vertices.ptrw();
+
+    for (int z = 0; z < side; z++) {
+        for (int x = 0; x < side; x++) {
+            vertex_ptr[z * side + x] = Vector3(
+                static_cast<float>(x) / resolution, 0.0f, static_cast<float>(z) / resolution);
+        }
+    }
+
+    // Perimeter walked as a closed loop: -Z edge, +X edge, +Z edge, -X edge
+    std::vector<int> perimeter;
+    perimeter.reserve(perimeter_count);
+    for (int x = 0; x < resolution; x++) {
+        perimeter.push_back(x);
+    }
+    for (int z = 0; z < resolution; z++) {
+        perimeter.push_back(z * side + resolution);
+    }
+    for (int x = resolution; x > 0; x--) {
+        perimeter.push_back(resolution * side + x);
+    }
+    for (int z = resolution; z > 0; z--) {
+        perimeter.push_back(z * side);
+    }
+
+    // Skirt vertices duplicate the perimeter with y = 1 (lowered by the shader)
+    for (int i = 0; i < perimeter_count; i++) {
+        Vector3 v = vertex_ptr[perimeter[i]];
+        vertex_ptr[grid_vertex_count + i] = Vector3(v.x, 1.0f, v.z);
+    }
+
+    const int grid_index_count = resolution * resolution * 6;
+    const int skirt_index_count = perimeter_count * 12;
+    PackedInt32Array indices;
+    indices.resize(grid_index_count + skirt_index_count);
+    int32_t *index_ptr = indices.ptrw();
+    int n = 0;
+
+    for (int z = 0; z < resolution; z++) {
+        for (int x = 0; x < resolution; x++) {
+            int a = z * side + x;
+            int b = a + 1;
+            int c = a + side;
+            int d = c + 1;
+            index_ptr[n++] = a;
+            index_ptr[n++] = b;
+            index_ptr[n++] = c;
+            index_ptr[n++] = b;
+            index_ptr[n++] = d;
+            index_ptr[n++] = c;
+        }
+    }
+
+    // Skirts are emitted double-sided so they hide cracks from any viewing direction
+    for (int i = 0; i < perimeter_count; i++) {
+        int top0 = perimeter[i];
+        int top1 = perimeter[(i + 1) % perimeter_count];
+        int bottom0 = grid_vertex_count + i;
+        int bottom1 = grid_vertex_count + (i + 1) % perimeter_count;
+        const int quad[12] = {
+            top0, bottom0, top1, top1, bottom0, bottom1,
+            top0, top1, bottom0, top1, bottom1, bottom0
+        };
+        for (int k = 0; k < 12; k++) {
+            index_ptr[n++] = quad[k];
+        }
+    }
+
+    Array arrays;
+    arrays.resize(Mesh::ARRAY_MAX);
+    arrays[Mesh::ARRAY_VERTEX] = vertices;
+    arrays[Mesh::ARRAY_INDEX] = indices;
+
+    Ref<ArrayMesh> mesh;
+    mesh.instantiate();
+    mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
+
+    out_triangle_count = indices.size() / 3;
+    return mesh;
+}
+
+void PLATEAUTerrainRenderer::rebuild() {
+    ensure_instance();
+
+    height_texture_.unref();
+    patch_count_ = 0;
+    if (multimesh_.is_valid()) {
+        multimesh_->set_visible_instance_count(0);
+    }
+
+    if (!has_terrain()) {
+        return;
+    }
+
+    // FORMAT_RF keeps the full 16-bit precision of the source heights
+    height_texture_ = heightmap_->create_heightmap_texture(false);
+    if (height_texture_.is_null()) {
+        return;
+    }
+
+    terrain_min_ = heightmap_->get_min_bounds();
+    terrain_size_ = heightmap_->get_max_bounds() - terrain_min_;
+    texel_spacing_ = std::min(terrain_size_.x / (heightmap_->get_width() - 1),
+                              terrain_size_.z / (heightmap_->get_height() - 1));
+
+    patch_mesh_ = build_patch_mesh(patch_resolution_, patch_triangle_count_);
+    multimesh_->set_instance_count(0);
+    multimesh_->set_mesh(patch_mesh_);
+
+    update_shader_parameters();
+    needs_update_ = true;
+}
+
+void PLATEAUTerrainRenderer::update_shader_parameters() {
+    material_->set_shader_parameter("height_map", height_texture_);
+    material_->set_shader_parameter("albedo_texture", albedo_texture_);
+    material_->set_shader_parameter("use_albedo_texture", albedo_texture_.is_valid());
+    material_->set_shader_parameter("skirt_depth", skirt_depth_);
+
+    if (!has_terrain()) {
+        return;
+    }
+
+    material_->set_shader_parameter("terrain_min", terrain_min_);
+    material_->set_shader_parameter("terrain_size", terrain_size_);
+    material_->set_shader_parameter("height_map_size", Vector2(heightmap_->get_width(), heightmap_->get_height()));
+    material_->set_shader_parameter("uv_min", heightmap_->get_min_uv());
+    material_->set_shader_parameter("uv_max", heightmap_->get_max_uv());
+
+    // Patches are placed with identity transforms, so culling uses the whole terrain bounds
+    if (instance_) {
+        Vector3 skirt_offset(0, skirt_depth_, 0);
+        instance_->set_custom_aabb(AABB(terrain_min_ - skirt_offset, terrain_size_ + skirt_offset));
+    }
+}
+
+// ============================================================================
+// LOD selection
+// ============================================================================
+
+void PLATEAUTerrainRenderer::update_lod(const Vector3 &local_camera_position) {
+    if (!has_terrain() || height_texture_.is_null()) {
+        return;
+    }
+    ensure_instance();
+
+    struct PatchNode {
+        double x;
+        double z;
+        double size;
+        int depth;
+    };
+
+    const double terrain_max_x = terrain_min_.x + terrain_size_.x;
+    const double terrain_max_z = terrain_min_.z + terrain_size_.z;
+    const double height_min = terrain_min_.y - skirt_depth_;
+    const double height_max = terrain_min_.y + terrain_size_.y;
+
+    // Splitting stops once patch cells would be finer than the heightmap samples
+    const double min_patch_size = texel_spacing_ * patch_resolution_;
+
+    std::vector<PatchNode> stack;
+    std::vector<Color> patches;
+    stack.push_back({terrain_min_.x, terrain_min_.z, std::max(terrain_size_.x, terrain_size_.z), 0});
+
+    while (!stack.empty()) {
+        PatchNode node = stack.back();
+        stack.pop_back();
+
+        // The root is square, so quadrants may fall outside a rectangular terrain
+        if (node.x >= terrain_max_x || node.z >= terrain_max_z) {
+            continue;
+        }
+
+        double dx = std::max({node.x - local_camera_position.x, 0.0, local_camera_position.x - (node.x + node.size)});
+        double dy = std::max({height_min - local_camera_position.y, 0.0, local_camera_position.y - height_max});
+        double dz = std::max({node.z - local_camera_position.z, 0.0, local_camera_position.z - (node.z + node.size)});
+        double distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+        bool split = node.depth + 1 < lod_levels_ &&
+                     node.size * 0.5 >= min_patch_size &&
+                     distance < node.size * lod_distance_factor_;
+        if (split) {
+            double half = node.size * 0.5;
+            stack.push_back({node.x, node.z, half, node.depth + 1});
+            stack.push_back({node.x + half, node.z, half, node.depth + 1});
+            stack.push_back({node.x, node.z + half, half, node.depth + 1});
+            stack.push_back({node.x + half, node.z + half, half, node.depth + 1});
+        } else {
+            patches.push_back(Color(node.x, node.z, node.size, node.depth));
+        }
+    }
+
+    // Grow capacity in powers of two; unused instances are hidden via the visible count
+    int count = static_cast<int>(patches.size());
+    if (multimesh_->get_instance_count() < count) {
+        int capacity = 64;
+        while (capacity < count) {
+            capacity *= 2;
+        }
+        multimesh_->set_instance_count(capacity);
+        for (int i = 0; i < capacity; i++) {
+            multimesh_->set_instance_transform(i, Transform3D());
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        multimesh_->set_instance_custom_data(i, patches[i]);
+    }
+    multimesh_->set_visible_instance_count(count);
+
+    patch_count_ = count;
+    last_camera_position_ = local_camera_position;
+    has_last_camera_position_ = true;
+    needs_update_ = false;
+}
+
+// ============================================================================
+// Properties
+// ============================================================================
+
+void PLATEAUTerrainRenderer::set_heightmap(const Ref<PLATEAUHeightMapData> &heightmap) {
+    heightmap_ = heightmap;
+    if (is_inside_tree()) {
+        rebuild();
+    } else {
+        height_texture_.unref();
+    }
+}
+
+Ref<PLATEAUHeightMapData> PLATEAUTerrainRenderer::get_heightmap() const {
+    return heightmap_;
+}
+
+void PLATEAUTerrainRenderer::set_albedo_texture(const Ref<Texture2D> &texture) {
+    albedo_texture_ = texture;
+    material_->set_shader_parameter("albedo_texture", albedo_texture_);
+    material_->set_shader_parameter("use_albedo_texture", albedo_texture_.is_valid());
+}
+
+Ref<Texture2D> PLATEAUTerrainRenderer::get_albedo_texture() const {
+    return albedo_texture_;
+}
+
+void PLATEAUTerrainRenderer::set_camera(Camera3D *camera) {
+    camera_ = camera;
+    needs_update_ = true;
+}
+
+Camera3D *PLATEAUTerrainRenderer::get_camera() const {
+    return camera_;
+}
+
+void PLATEAUTerrainRenderer::set_patch_resolution(int resolution) {
+    ERR_FAIL_COND_MSG(resolution < 1 || resolution > 256, "Patch resolution must be between 1 and 256");
+    patch_resolution_ = resolution;
+    if (is_inside_tree()) {
+        rebuild();
+    }
+}
+
+int PLATEAUTerrainRenderer::get_patch_resolution() const {
+    return patch_resolution_;
+}
+
+void PLATEAUTerrainRenderer::set_lod_levels(int levels) {
+    ERR_FAIL_COND_MSG(levels < 1 || levels > 16, "LOD levels must be between 1 and 16");
+    lod_levels_ = levels;
+    needs_update_ = true;
+}
+
+int PLATEAUTerrainRenderer::get_lod_levels() const {
+    return lod_levels_;
+}
+
+void PLATEAUTerrainRenderer::set_lod_distance_factor(float factor) {
+    lod_distance_factor_ = std::max(factor, 0.0f);
+    needs_update_ = true;
+}
+
+float PLATEAUTerrainRenderer::get_lod_distance_factor() const {
+    return lod_distance_factor_;
+}
+
+void PLATEAUTerrainRenderer::set_skirt_depth(float depth) {
+    skirt_depth_ = std::max(depth, 0.0f);
+    update_shader_parameters();
+    needs_update_ = true;
+}
+
+float PLATEAUTerrainRenderer::get_skirt_depth() const {
+    return skirt_depth_;
+}
+
+Ref<ShaderMaterial> PLATEAUTerrainRenderer::get_material() const {
+    return material_;
+}
+
+int PLATEAUTerrainRenderer::get_patch_count() const {
+    return patch_count_;
+}
+
+int64_t PLATEAUTerrainRenderer::get_triangle_count() const {
+    return static_cast<int64_t>(patch_count_) * patch_triangle_count_;
+}
+
+void PLATEAUTerrainRenderer::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("set_heightmap", "heightmap"), &PLATEAUTerrainRenderer::set_heightmap);
+    ClassDB::bind_method(D_METHOD("get_heightmap"), &PLATEAUTerrainRenderer::get_heightmap);
+    ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "heightmap", PROPERTY_HINT_RESOURCE_TYPE, "PLATEAUHeightMapData"), "set_heightmap", "get_heightmap");
+
+    ClassDB::bind_method(D_METHOD("set_albedo_texture", "texture"), &PLATEAUTerrainRenderer::set_albedo_texture);
+    ClassDB::bind_method(D_METHOD("get_albedo_texture"), &PLATEAUTerrainRenderer::get_albedo_texture);
+    ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "albedo_texture", PROPERTY_HINT_RESOURCE_TYPE, "Texture2D"), "set_albedo_texture", "get_albedo_texture");
+
+    ClassDB::bind_method(D_METHOD("set_camera", "camera"), &PLATEAUTerrainRenderer::set_camera);
+    ClassDB::bind_method(D_METHOD("get_camera"), &PLATEAUTerrainRenderer::get_camera);
+    ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "camera", PROPERTY_HINT_NODE_TYPE, "Camera3D"), "set_camera", "get_camera");
+
+    ClassDB::bind_method(D_METHOD("set_patch_resolution", "resolution"), &PLATEAUTerrainRenderer::set_patch_resolution);
+    ClassDB::bind_method(D_METHOD("get_patch_resolution"), &PLATEAUTerrainRenderer::get_patch_resolution);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "patch_resolution"), "set_patch_resolution", "get_patch_resolution");
+
+    ClassDB::bind_method(D_METHOD("set_lod_levels", "levels"), &PLATEAUTerrainRenderer::set_lod_levels);
+    ClassDB::bind_method(D_METHOD("get_lod_levels"), &PLATEAUTerrainRenderer::get_lod_levels);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_levels"), "set_lod_levels", "get_lod_levels");
+
+    ClassDB::bind_method(D_METHOD("set_lod_distance_factor", "factor"), &PLATEAUTerrainRenderer::set_lod_distance_factor);
+    ClassDB::bind_method(D_METHOD("get_lod_distance_factor"), &PLATEAUTerrainRenderer::get_lod_distance_factor);
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "lod_distance_factor"), "set_lod_distance_factor", "get_lod_distance_factor");
+
+    ClassDB::bind_method(D_METHOD("set_skirt_depth", "depth"), &PLATEAUTerrainRenderer::set_skirt_depth);
+    ClassDB::bind_method(D_METHOD("get_skirt_depth"), &PLATEAUTerrainRenderer::get_skirt_depth);
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "skirt_depth"), "set_skirt_depth", "get_skirt_depth");
+
+    ClassDB::bind_method(D_METHOD("get_material"), &PLATEAUTerrainRenderer::get_material);
+    ClassDB::bind_method(D_METHOD("update_lod", "local_camera_position"), &PLATEAUTerrainRenderer::update_lod);
+    ClassDB::bind_method(D_METHOD("rebuild"), &PLATEAUTerrainRenderer::rebuild);
+    ClassDB::bind_method(D_METHOD("get_patch_count"), &PLATEAUTerrainRenderer::get_patch_count);
+    ClassDB::bind_method(D_METHOD("get_triangle_count"), &PLATEAUTerrainRenderer::get_triangle_count);
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <godot_cpp/classes/node3d.hpp>
+#include <godot_cpp/classes/camera3d.hpp>
+#include <godot_cpp/classes/array_mesh.hpp>
+#include <godot_cpp/classes/multi_mesh.hpp>
+#include <godot_cpp/classes/multi_mesh_instance3d.hpp>
+#include <godot_cpp/classes/shader.hpp>
+#include <godot_cpp/classes/shader_material.hpp>
+#include <godot_cpp/classes/image_texture.hpp>
+#include <godot_cpp/classes/texture2d.hpp>
+#include <godot_cpp/core/class_db.hpp>
+
+#include "plateau_terrain.h"
+
+namespace godot {
+
+/**
+ * PLATEAUTerrainRenderer - Renders a PLATEAUHeightMapData with chunked quadtree LOD
+ *
+ * A single N x N patch mesh is drawn once per quadtree leaf through a MultiMesh, and the
+ * vertex shader displaces it by sampling the heightmap texture. Patches near the camera
+ * are small, distant ones large, so triangle count and mesh memory stay constant no matter
+ * how large the heightmap is. Patch borders are hidden with skirts.
+ *
+ * Usage:
+ * ```gdscript
+ * var renderer = PLATEAUTerrainRenderer.new()
+ * renderer.heightmap = terrain.generate_from_meshes(relief_meshes)
+ * renderer.albedo_texture = load("res://aerial_photo.png")
+ * add_child(renderer)
+ * ```
+ */
+class PLATEAUTerrainRenderer : public Node3D {
+    GDCLASS(PLATEAUTerrainRenderer, Node3D)
+
+public:
+    PLATEAUTerrainRenderer();
+    ~PLATEAUTerrainRenderer();
+
+    // Lifecycle
+    void _ready() override;
+    void _process(double delta) override;
+
+    // Heightmap to render
+    void set_heightmap(const Ref<PLATEAUHeightMapData> &heightmap);
+    Ref<PLATEAUHeightMapData> get_heightmap() const;
+
+    // Optional surface texture, mapped with the heightmap's UV range
+    void set_albedo_texture(const Ref<Texture2D> &texture);
+    Ref<Texture2D> get_albedo_texture() const;
+
+    // Camera driving LOD selection (defaults to the viewport camera)
+    void set_camera(Camera3D *camera);
+    Camera3D *get_camera() const;
+
+    // Cells per patch side (patch has (n + 1)^2 vertices)
+    void set_patch_resolution(int resolution);
+    int get_patch_resolution() const;
+
+    // Quadtree depth; the finest patch is 1 / 2^(levels - 1) of the terrain
+    void set_lod_levels(int levels);
+    int get_lod_levels() const;
+
+    // A patch is split while camera distance < patch size * factor
+    void set_lod_distance_factor(float factor);
+    float get_lod_distance_factor() const;
+
+    // How far skirts hang below patch borders (meters)
+    void set_skirt_depth(float depth);
+    float get_skirt_depth() const;
+
+    // Shader material used for the terrain (parameters can be tweaked directly)
+    Ref<ShaderMaterial> get_material() const;
+
+    // Re-select patches for a camera position in this node's local space
+    void update_lod(const Vector3 &local_camera_position);
+
+    // Recreate the height texture and patch mesh from the current settings
+    void rebuild();
+
+    // Statistics
+    int get_patch_count() const;
+    int64_t get_triangle_count() const;
+
+protected:
+    static void _bind_methods();
+
+private:
+    Ref<PLATEAUHeightMapData> heightmap_;
+    Ref<Texture2D> albedo_texture_;
+    Camera3D *camera_;
+
+    int patch_resolution_;
+    int lod_levels_;
+    float lod_distance_factor_;
+    float skirt_depth_;
+
+    MultiMeshInstance3D *instance_;
+    Ref<MultiMesh> multimesh_;
+    Ref<ArrayMesh> patch_mesh_;
+    Ref<ShaderMaterial> material_;
+    Ref<ImageTexture> height_texture_;
+
+    Vector3 terrain_min_;
+    Vector3 terrain_size_;
+    double texel_spacing_;
+    int patch_count_;
+    int64_t patch_triangle_count_;
+
+    bool needs_update_;
+    bool has_last_camera_position_;
+    Vector3 last_camera_position_;
+
+    Camera3D *get_tracked_camera() const;
+    void ensure_instance();
+    void update_shader_parameters();
+    bool has_terrain() const;
+
+    static Ref<ArrayMesh> build_patch_mesh(int resolution, int64_t &out_triangle_count);
+};
+
+} // namespace godot
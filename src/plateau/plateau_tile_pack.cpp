@@ -0,0 +1,647 @@
+#include "plateau_tile_pack.h"
+#include <godot_cpp/variant/utility_functions.hpp>
+#include <godot_cpp/classes/dir_access.hpp>
+#include <godot_cpp/classes/project_settings.hpp>
+#include <algorithm>
+#include <cstring>
+#include <unordered_set>
+#include <vector>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace godot;
+
+static const uint32_t TILE_PACK_MAGIC = 0x50544C50; // "PLTP"
+static const uint32_t TILE_PACK_VERSION = 1;
+static const uint64_t TILE_PACK_HEADER_SIZE = 16;
+static const uint64_t TILE_PACK_INDEX_OFFSET_POS = 8;
+
+// ============================================================================
+// PLATEAUTilePack
+// ============================================================================
+
+PLATEAUTilePack::PLATEAUTilePack()
+    : writable_(false),
+      data_end_(0),
+      dirty_(false),
+      deduplicated_bytes_(0),
+      mapped_data_(nullptr),
+      mapped_size_(0),
+      map_handle_(nullptr) {
+}
+
+PLATEAUTilePack::~PLATEAUTilePack() {
+    close();
+}
+
+uint64_t PLATEAUTilePack::make_key(int zoom, int column, int row) {
+    return (static_cast<uint64_t>(zoom & 0xFF) << 56) |
+           (static_cast<uint64_t>(column & 0xFFFFFFF) << 28) |
+           static_cast<uint64_t>(row & 0xFFFFFFF);
+}
+
+uint64_t PLATEAUTilePack::hash_bytes(const uint8_t *data, size_t size) {
+    // FNV-1a; collisions are resolved by comparing the blob bytes
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+Error PLATEAUTilePack::open(const String &path, bool writable) {
+    close();
+
+    bool exists = FileAccess::file_exists(path);
+    ERR_FAIL_COND_V_MSG(!writable && !exists, ERR_FILE_NOT_FOUND,
+        "PLATEAUTilePack: File not found: " + path);
+
+    if (writable) {
+        if (!exists) {
+            DirAccess::make_dir_recursive_absolute(path.get_base_dir());
+        }
+        file_ = FileAccess::open(path, exists ? FileAccess::READ_WRITE : FileAccess::WRITE_READ);
+    } else {
+        file_ = FileAccess::open(path, FileAccess::READ);
+    }
+    ERR_FAIL_COND_V_MSG(file_.is_null(), ERR_CANT_OPEN, "PLATEAUTilePack: Failed to open: " + path);
+
+    path_ = path;
+    writable_ = writable;
+
+    if (file_->get_length() == 0) {
+        ERR_FAIL_COND_V(!writable, ERR_FILE_CORRUPT);
+        file_->store_32(TILE_PACK_MAGIC);
+        file_->store_32(TILE_PACK_VERSION);
+        file_->store_64(0);
+        data_end_ = TILE_PACK_HEADER_SIZE;
+        dirty_ = true;
+    } else if (!read_index()) {
+        UtilityFunctions::printerr("PLATEAUTilePack: Invalid pack file: ", path);
+        file_.unref();
+        path_ = "";
+        return ERR_FILE_CORRUPT;
+    }
+
+    if (!writable_) {
+        String absolute_path = path;
+        if (path.begins_with("user://") || path.begins_with("res://")) {
+            absolute_path = ProjectSettings::get_singleton()->globalize_path(path);
+        }
+        if (absolute_path.is_absolute_path() && !absolute_path.begins_with("res://")) {
+            map_file(absolute_path);
+        }
+    }
+
+    return OK;
+}
+
+bool PLATEAUTilePack::read_index() {
+    file_->seek(0);
+    if (file_->get_32() != TILE_PACK_MAGIC || file_->get_32() != TILE_PACK_VERSION) {
+        return false;
+    }
+    uint64_t index_offset = file_->get_64();
+    uint64_t length = file_->get_length();
+
+    index_.clear();
+    blob_by_hash_.clear();
+    deduplicated_bytes_ = 0;
+
+    if (index_offset != 0) {
+        if (index_offset + 4 > length) {
+            return false;
+        }
+        file_->seek(index_offset);
+        uint32_t count = file_->get_32();
+        if (index_offset + 4 + static_cast<uint64_t>(count) * 32 > length) {
+            return false;
+        }
+
+        // Read the whole index in one call and parse it from memory
+        PackedByteArray raw = file_->get_buffer(static_cast<int64_t>(count) * 32);
+        const uint8_t *ptr = raw.ptr();
+        index_.reserve(count);
+        std::unordered_set<uint64_t> seen_offsets;
+        for (uint32_t i = 0; i < count; i++, ptr += 32) {
+            uint32_t zoom, column, row;
+            Entry entry;
+            memcpy(&zoom, ptr, 4);
+            memcpy(&column, ptr + 4, 4);
+            memcpy(&row, ptr + 8, 4);
+            memcpy(&entry.size, ptr + 12, 4);
+            memcpy(&entry.offset, ptr + 16, 8);
+            memcpy(&entry.hash, ptr + 24, 8);
+            if (entry.offset < TILE_PACK_HEADER_SIZE || entry.offset + entry.size > length ||
+                (entry.offset < index_offset + 4 + static_cast<uint64_t>(count) * 32 && entry.offset + entry.size > index_offset)) {
+                return false;
+            }
+
+            uint64_t key = make_key(zoom, column, row);
+            index_[key] = entry;
+            if (seen_offsets.insert(entry.offset).second) {
+                blob_by_hash_.emplace(entry.hash, key);
+            } else {
+                deduplicated_bytes_ += entry.size;
+            }
+        }
+    }
+
+    // New blobs only go where the on-disk index doesn't point, so the file stays valid until the next flush
+    uint64_t index_size = 0;
+    if (index_offset != 0) {
+        index_size = 4 + static_cast<uint64_t>(index_.size()) * 32;
+    }
+    rebuild_free_space(index_offset, index_size);
+    dirty_ = false;
+    return true;
+}
+
+PackedByteArray PLATEAUTilePack::serialize_index() const {
+    PackedByteArray raw;
+    raw.resize(4 + static_cast<int64_t>(index_.size()) * 32);
+    uint8_t *ptr = raw.ptrw();
+    uint32_t count = static_cast<uint32_t>(index_.size());
+    memcpy(ptr, &count, 4);
+    ptr += 4;
+    for (const auto &pair : index_) {
+        uint32_t zoom = static_cast<uint32_t>(pair.first >> 56);
+        uint32_t column = static_cast<uint32_t>((pair.first >> 28) & 0xFFFFFFF);
+        uint32_t row = static_cast<uint32_t>(pair.first & 0xFFFFFFF);
+        memcpy(ptr, &zoom, 4);
+        memcpy(ptr + 4, &column, 4);
+        memcpy(ptr + 8, &row, 4);
+        memcpy(ptr + 12, &pair.second.size, 4);
+        memcpy(ptr + 16, &pair.second.offset, 8);
+        memcpy(ptr + 24, &pair.second.hash, 8);
+        ptr += 32;
+    }
+    return raw;
+}
+
+uint64_t PLATEAUTilePack::allocate_range(uint64_t size) {
+    // First fit among the gaps, otherwise append
+    for (auto it = free_ranges_.begin(); it != free_ranges_.end(); ++it) {
+        if (it->second < size) {
+            continue;
+        }
+        uint64_t offset = it->first;
+        uint64_t remaining = it->second - size;
+        free_ranges_.erase(it);
+        if (remaining > 0) {
+            free_ranges_[offset + size] = remaining;
+        }
+        return offset;
+    }
+    uint64_t offset = data_end_;
+    data_end_ += size;
+    return offset;
+}
+
+void PLATEAUTilePack::rebuild_free_space(uint64_t index_offset, uint64_t index_size) {
+    // Everything between the header and the last used byte that neither a blob nor the index covers
+    std::vector<std::pair<uint64_t, uint64_t>> used;
+    used.reserve(index_.size() + 1);
+    std::unordered_set<uint64_t> seen_offsets;
+    for (const auto &pair : index_) {
+        if (seen_offsets.insert(pair.second.offset).second) {
+            used.emplace_back(pair.second.offset, pair.second.offset + pair.second.size);
+        }
+    }
+    if (index_size > 0) {
+        used.emplace_back(index_offset, index_offset + index_size);
+    }
+    std::sort(used.begin(), used.end());
+
+    free_ranges_.clear();
+    uint64_t cursor = TILE_PACK_HEADER_SIZE;
+    for (const auto &range : used) {
+        if (range.first > cursor) {
+            free_ranges_[cursor] = range.first - cursor;
+        }
+        cursor = std::max(cursor, range.second);
+    }
+    data_end_ = cursor;
+}
+
+Error PLATEAUTilePack::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ERR_FAIL_COND_V_MSG(file_.is_null() || !writable_, ERR_UNCONFIGURED, "PLATEAUTilePack: Pack is not open for writing");
+    if (!dirty_) {
+        return OK;
+    }
+
+    // Write the new index where the current one doesn't live, then point the header at it.
+    // The previous index (and any replaced tile) becomes free space for later blobs
+    PackedByteArray raw = serialize_index();
+    uint64_t index_size = static_cast<uint64_t>(raw.size());
+    uint64_t index_offset = allocate_range(index_size);
+    file_->seek(index_offset);
+    file_->store_buffer(raw);
+    file_->flush();
+    file_->seek(TILE_PACK_INDEX_OFFSET_POS);
+    file_->store_64(index_offset);
+    file_->flush();
+
+    rebuild_free_space(index_offset, index_size);
+    dirty_ = false;
+    return OK;
+}
+
+Error PLATEAUTilePack::compact() {
+    ERR_FAIL_COND_V_MSG(file_.is_null(), ERR_UNCONFIGURED, "PLATEAUTilePack: Pack is not open");
+
+    String path = path_;
+    bool writable = writable_;
+    String temp_path = path + ".compact";
+    uint64_t old_length = 0;
+    uint64_t new_length = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        old_length = file_->get_length();
+
+        Ref<FileAccess> out = FileAccess::open(temp_path, FileAccess::WRITE);
+        ERR_FAIL_COND_V_MSG(out.is_null(), ERR_CANT_CREATE, "PLATEAUTilePack: Failed to create: " + temp_path);
+        out->store_32(TILE_PACK_MAGIC);
+        out->store_32(TILE_PACK_VERSION);
+        out->store_64(0);
+
+        // Copy every referenced blob once, in file order
+        std::vector<Entry> blobs;
+        std::unordered_set<uint64_t> seen_offsets;
+        for (const auto &pair : index_) {
+            if (seen_offsets.insert(pair.second.offset).second) {
+                blobs.push_back(pair.second);
+            }
+        }
+        std::sort(blobs.begin(), blobs.end(), [](const Entry &a, const Entry &b) { return a.offset < b.offset; });
+
+        std::unordered_map<uint64_t, uint64_t> moved;
+        moved.reserve(blobs.size());
+        uint64_t write_offset = TILE_PACK_HEADER_SIZE;
+        PackedByteArray data;
+        for (const Entry &blob : blobs) {
+            if (!read_blob(blob, data)) {
+                out.unref();
+                DirAccess::remove_absolute(temp_path);
+                ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "PLATEAUTilePack: Failed to read a tile while compacting: " + path);
+            }
+            out->store_buffer(data);
+            moved[blob.offset] = write_offset;
+            write_offset += blob.size;
+        }
+        for (auto &pair : index_) {
+            pair.second.offset = moved[pair.second.offset];
+        }
+
+        PackedByteArray raw = serialize_index();
+        out->store_buffer(raw);
+        out->seek(TILE_PACK_INDEX_OFFSET_POS);
+        out->store_64(write_offset);
+        out->close();
+        new_length = write_offset + raw.size();
+
+        // The remapped index belongs to the new file; don't write it into the old one
+        dirty_ = false;
+    }
+
+    close();
+    if (FileAccess::file_exists(path)) {
+        DirAccess::remove_absolute(path);
+    }
+    Error err = DirAccess::rename_absolute(temp_path, path);
+    ERR_FAIL_COND_V_MSG(err != OK, err, "PLATEAUTilePack: Failed to replace pack: " + path);
+
+    UtilityFunctions::print("PLATEAUTilePack: Compacted ", path, " (", static_cast<int64_t>(old_length), " -> ",
+                            static_cast<int64_t>(new_length), " bytes)");
+    return open(path, writable);
+}
+
+void PLATEAUTilePack::close() {
+    if (file_.is_valid() && writable_ && dirty_) {
+        flush();
+    }
+    unmap_file();
+    if (file_.is_valid()) {
+        file_->close();
+        file_.unref();
+    }
+    index_.clear();
+    blob_by_hash_.clear();
+    free_ranges_.clear();
+    deduplicated_bytes_ = 0;
+    path_ = "";
+    writable_ = false;
+    data_end_ = 0;
+    dirty_ = false;
+}
+
+bool PLATEAUTilePack::is_open() const {
+    return file_.is_valid();
+}
+
+bool PLATEAUTilePack::is_writable() const {
+    return writable_;
+}
+
+bool PLATEAUTilePack::is_memory_mapped() const {
+    return mapped_data_ != nullptr;
+}
+
+String PLATEAUTilePack::get_path() const {
+    return path_;
+}
+
+bool PLATEAUTilePack::read_blob(const Entry &entry, PackedByteArray &out) const {
+    // Caller holds mutex_ unless the pack is memory-mapped
+    if (mapped_data_) {
+        if (entry.offset + entry.size > mapped_size_) {
+            return false;
+        }
+        out.resize(entry.size);
+        memcpy(out.ptrw(), mapped_data_ + entry.offset, entry.size);
+        return true;
+    }
+    file_->seek(entry.offset);
+    out = file_->get_buffer(entry.size);
+    return out.size() == static_cast<int64_t>(entry.size);
+}
+
+bool PLATEAUTilePack::blob_equals(const Entry &entry, const PackedByteArray &data) const {
+    if (entry.size != static_cast<uint32_t>(data.size())) {
+        return false;
+    }
+    PackedByteArray existing;
+    return read_blob(entry, existing) && memcmp(existing.ptr(), data.ptr(), entry.size) == 0;
+}
+
+bool PLATEAUTilePack::has_tile(int zoom, int column, int row) const {
+    std::unique_lock<std::mutex> lock(mutex_, std::defer_lock);
+    if (writable_) {
+        lock.lock();
+    }
+    return index_.find(make_key(zoom, column, row)) != index_.end();
+}
+
+PackedByteArray PLATEAUTilePack::get_tile_data(int zoom, int column, int row) const {
+    PackedByteArray result;
+    if (file_.is_null()) {
+        return result;
+    }
+
+    // The index of a read-only pack never changes, and mapped reads need no file handle
+    std::unique_lock<std::mutex> lock(mutex_, std::defer_lock);
+    if (writable_) {
+        lock.lock();
+    }
+    auto it = index_.find(make_key(zoom, column, row));
+    if (it == index_.end()) {
+        return result;
+    }
+    if (!mapped_data_ && !lock.owns_lock()) {
+        lock.lock();
+    }
+    if (!read_blob(it->second, result)) {
+        result.clear();
+    }
+    return result;
+}
+
+Ref<Image> PLATEAUTilePack::load_tile_image(int zoom, int column, int row) const {
+    PackedByteArray data = get_tile_data(zoom, column, row);
+    if (data.is_empty()) {
+        return Ref<Image>();
+    }
+    return decode_tile_image(data);
+}
+
+bool PLATEAUTilePack::store_tile(int zoom, int column, int row, const PackedByteArray &data) {
+    ERR_FAIL_COND_V_MSG(file_.is_null() || !writable_, false, "PLATEAUTilePack: Pack is not open for writing");
+    ERR_FAIL_COND_V(data.is_empty(), false);
+
+    uint64_t hash = hash_bytes(data.ptr(), data.size());
+    uint64_t key = make_key(zoom, column, row);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Share the blob of an identical tile if there is one
+    auto same = blob_by_hash_.find(hash);
+    if (same != blob_by_hash_.end()) {
+        auto owner = index_.find(same->second);
+        if (owner != index_.end() && owner->second.hash == hash && blob_equals(owner->second, data)) {
+            index_[key] = owner->second;
+            deduplicated_bytes_ += data.size();
+            dirty_ = true;
+            return true;
+        }
+    }
+
+    Entry entry;
+    entry.size = static_cast<uint32_t>(data.size());
+    entry.offset = allocate_range(entry.size);
+    entry.hash = hash;
+
+    file_->seek(entry.offset);
+    file_->store_buffer(data);
+
+    index_[key] = entry;
+    blob_by_hash_[hash] = key;
+    dirty_ = true;
+    return true;
+}
+
+int PLATEAUTilePack::import_directory(const String &directory) {
+    ERR_FAIL_COND_V_MSG(file_.is_null() || !writable_, 0, "PLATEAUTilePack: Pack is not open for writing");
+
+    int imported = 0;
+    PackedStringArray zoom_dirs = DirAccess::get_directories_at(directory);
+    for (int z = 0; z < zoom_dirs.size(); z++) {
+        const String &zoom_name = zoom_dirs[z];
+        if (!zoom_name.is_valid_int()) {
+            continue;
+        }
+        String zoom_path = directory.path_join(zoom_name);
+        PackedStringArray column_dirs = DirAccess::get_directories_at(zoom_path);
+        for (int c = 0; c < column_dirs.size(); c++) {
+            const String &column_name = column_dirs[c];
+            if (!column_name.is_valid_int()) {
+                continue;
+            }
+            String column_path = zoom_path.path_join(column_name);
+            PackedStringArray files = DirAccess::get_files_at(column_path);
+            for (int f = 0; f < files.size(); f++) {
+                const String &file_name = files[f];
+                String row_name = file_name.get_basename();
+                if (!row_name.is_valid_int() || file_name.ends_with(".part")) {
+                    continue;
+                }
+                PackedByteArray data = FileAccess::get_file_as_bytes(column_path.path_join(file_name));
+                if (!data.is_empty() &&
+                    store_tile(zoom_name.to_int(), column_name.to_int(), row_name.to_int(), data)) {
+                    imported++;
+                }
+            }
+        }
+    }
+
+    UtilityFunctions::print("PLATEAUTilePack: Imported ", imported, " tiles from ", directory);
+    return imported;
+}
+
+int PLATEAUTilePack::get_tile_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int>(index_.size());
+}
+
+int PLATEAUTilePack::get_unique_tile_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::unordered_set<uint64_t> offsets;
+    for (const auto &pair : index_) {
+        offsets.insert(pair.second.offset);
+    }
+    return static_cast<int>(offsets.size());
+}
+
+int64_t PLATEAUTilePack::get_deduplicated_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return deduplicated_bytes_;
+}
+
+int64_t PLATEAUTilePack::get_unused_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (file_.is_null()) {
+        return 0;
+    }
+    uint64_t unused = 0;
+    for (const auto &range : free_ranges_) {
+        unused += range.second;
+    }
+    uint64_t length = file_->get_length();
+    if (length > data_end_) {
+        unused += length - data_end_;
+    }
+    return static_cast<int64_t>(unused);
+}
+
+Ref<Image> PLATEAUTilePack::decode_tile_image(const PackedByteArray &data) {
+    if (data.size() < 12) {
+        return Ref<Image>();
+    }
+    const uint8_t *bytes = data.ptr();
+
+    Ref<Image> image;
+    image.instantiate();
+    Error err = ERR_FILE_UNRECOGNIZED;
+    if (bytes[0] == 0x89 && bytes[1] == 'P' && bytes[2] == 'N' && bytes[3] == 'G') {
+        err = image->load_png_from_buffer(data);
+    } else if (bytes[0] == 0xFF && bytes[1] == 0xD8) {
+        err = image->load_jpg_from_buffer(data);
+    } else if (memcmp(bytes, "RIFF", 4) == 0 && memcmp(bytes + 8, "WEBP", 4) == 0) {
+        err = image->load_webp_from_buffer(data);
+    }
+    if (err != OK) {
+        return Ref<Image>();
+    }
+    return image;
+}
+
+// ============================================================================
+// Memory mapping
+// ============================================================================
+
+void PLATEAUTilePack::map_file(const String &absolute_path) {
+#if defined(_WIN32)
+    HANDLE file = CreateFileW(reinterpret_cast<LPCWSTR>(absolute_path.utf16().get_data()), GENERIC_READ,
+                              FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    LARGE_INTEGER size;
+    HANDLE mapping = nullptr;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+        mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    }
+    CloseHandle(file);
+    if (!mapping) {
+        return;
+    }
+    void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        return;
+    }
+    mapped_data_ = static_cast<const uint8_t *>(view);
+    mapped_size_ = static_cast<uint64_t>(size.QuadPart);
+    map_handle_ = mapping;
+#else
+    int fd = ::open(absolute_path.utf8().get_data(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        void *view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view != MAP_FAILED) {
+            mapped_data_ = static_cast<const uint8_t *>(view);
+            mapped_size_ = static_cast<uint64_t>(st.st_size);
+        }
+    }
+    ::close(fd);
+#endif
+}
+
+void PLATEAUTilePack::unmap_file() {
+    if (!mapped_data_) {
+        return;
+    }
+#if defined(_WIN32)
+    UnmapViewOfFile(mapped_data_);
+    if (map_handle_) {
+        CloseHandle(static_cast<HANDLE>(map_handle_));
+    }
+#else
+    munmap(const_cast<uint8_t *>(mapped_data_), static_cast<size_t>(mapped_size_));
+#endif
+    mapped_data_ = nullptr;
+    mapped_size_ = 0;
+    map_handle_ = nullptr;
+}
+
+void PLATEAUTilePack::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("open", "path", "writable"), &PLATEAUTilePack::open, DEFVAL(false));
+    ClassDB::bind_method(D_METHOD("close"), &PLATEAUTilePack::close);
+    ClassDB::bind_method(D_METHOD("flush"), &PLATEAUTilePack::flush);
+    ClassDB::bind_method(D_METHOD("compact"), &PLATEAUTilePack::compact);
+    ClassDB::bind_method(D_METHOD("is_open"), &PLATEAUTilePack::is_open);
+    ClassDB::bind_method(D_METHOD("is_writable"), &PLATEAUTilePack::is_writable);
+    ClassDB::bind_method(D_METHOD("is_memory_mapped"), &PLATEAUTilePack::is_memory_mapped);
+    ClassDB::bind_method(D_METHOD("get_path"), &PLATEAUTilePack::get_path);
+
+    ClassDB::bind_method(D_METHOD("has_tile", "zoom", "column", "row"), &PLATEAUTilePack::has_tile);
+    ClassDB::bind_method(D_METHOD("get_tile_data", "zoom", "column", "row"), &PLATEAUTilePack::get_tile_data);
+    ClassDB::bind_method(D_METHOD("load_tile_image", "zoom", "column", "row"), &PLATEAUTilePack::load_tile_image);
+    ClassDB::bind_method(D_METHOD("store_tile", "zoom", "column", "row", "data"), &PLATEAUTilePack::store_tile);
+    ClassDB::bind_method(D_METHOD("import_directory", "directory"), &PLATEAUTilePack::import_directory);
+
+    ClassDB::bind_method(D_METHOD("get_tile_count"), &PLATEAUTilePack::get_tile_count);
+    ClassDB::bind_method(D_METHOD("get_unique_tile_count"), &PLATEAUTilePack::get_unique_tile_count);
+    ClassDB::bind_method(D_METHOD("get_deduplicated_bytes"), &PLATEAUTilePack::get_deduplicated_bytes);
+    ClassDB::bind_method(D_METHOD("get_unused_bytes"), &PLATEAUTilePack::get_unused_bytes);
+
+    ClassDB::bind_static_method("PLATEAUTilePack", D_METHOD("decode_tile_image", "data"),
+                                &PLATEAUTilePack::decode_tile_image);
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/image.hpp>
+#include <godot_cpp/core/class_db.hpp>
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+namespace godot {
+
+/**
+ * PLATEAUTilePack - Single-file store for basemap tiles
+ *
+ * Replaces the destination/zoom/column/row.ext directory layout with one indexed file.
+ * Identical tiles (blank or ocean tiles are very common) are stored once and shared by
+ * all coordinates that use them. Read-only packs are memory-mapped where the platform
+ * allows it, so tile reads are lock-free and involve no file I/O calls.
+ *
+ * File layout (little endian):
+ *   header  : "PLTP", u32 version, u64 index_offset
+ *   blobs   : encoded tile images (PNG / JPEG / WebP), back to back
+ *   index   : u32 count, count x {u32 zoom, u32 column, u32 row, u32 size, u64 offset, u64 hash}
+ *
+ * Space not referenced by the current index (previous indexes, replaced tiles) is reused for
+ * new blobs and indexes, so repeated flushes don't grow the file. compact() rewrites the pack
+ * without any gaps.
+ *
+ * Usage:
+ * ```gdscript
+ * var pack = PLATEAUTilePack.new()
+ * pack.open("user://basemap.pltp", true)
+ * pack.import_directory("user://map_tiles")   # migrate existing tiles
+ * pack.close()
+ *
+ * downloader.tile_pack = pack                 # fetch_tiles() now writes into the pack
+ * ```
+ */
+class PLATEAUTilePack : public RefCounted {
+    GDCLASS(PLATEAUTilePack, RefCounted)
+
+public:
+    PLATEAUTilePack();
+    ~PLATEAUTilePack();
+
+    // Open (or create, if writable) a pack file
+    Error open(const String &path, bool writable = false);
+    // Write the index and release the file
+    void close();
+    // Write the index without closing (writable packs only)
+    Error flush();
+    // Rewrite the pack without unused space and reopen it in the same mode
+    Error compact();
+
+    bool is_open() const;
+    bool is_writable() const;
+    bool is_memory_mapped() const;
+    String get_path() const;
+
+    // Tile access
+    bool has_tile(int zoom, int column, int row) const;
+    PackedByteArray get_tile_data(int zoom, int column, int row) const;
+    Ref<Image> load_tile_image(int zoom, int column, int row) const;
+    bool store_tile(int zoom, int column, int row, const PackedByteArray &data);
+
+    // Import tiles from a destination/zoom/column/row.ext directory. Returns the number imported
+    int import_directory(const String &directory);
+
+    // Statistics
+    int get_tile_count() const;
+    int get_unique_tile_count() const;
+    int64_t get_deduplicated_bytes() const;
+    int64_t get_unused_bytes() const;
+
+    // Decode PNG / JPEG / WebP bytes (format detected from the file signature)
+    static Ref<Image> decode_tile_image(const PackedByteArray &data);
+
+protected:
+    static void _bind_methods();
+
+private:
+    struct Entry {
+        uint64_t offset;
+        uint32_t size;
+        uint64_t hash;
+    };
+
+    String path_;
+    bool writable_;
+    Ref<FileAccess> file_;
+    uint64_t data_end_;             // End of the used part of the file; blobs that fit no gap go here
+    bool dirty_;
+    std::map<uint64_t, uint64_t> free_ranges_;                // offset -> size, unused by the on-disk index
+
+    std::unordered_map<uint64_t, Entry> index_;               // tile key -> blob
+    std::unordered_map<uint64_t, uint64_t> blob_by_hash_;     // content hash -> tile key owning the blob
+    int64_t deduplicated_bytes_;
+
+    // Memory map of a read-only pack (null if unavailable)
+    const uint8_t *mapped_data_;
+    uint64_t mapped_size_;
+    void *map_handle_;
+
+    mutable std::mutex mutex_;
+
+    static uint64_t make_key(int zoom, int column, int row);
+    static uint64_t hash_bytes(const uint8_t *data, size_t size);
+
+    bool read_index();
+    PackedByteArray serialize_index() const;
+    uint64_t allocate_range(uint64_t size);
+    void rebuild_free_space(uint64_t index_offset, uint64_t index_size);
+    bool read_blob(const Entry &entry, PackedByteArray &out) const;
+    bool blob_equals(const Entry &entry, const PackedByteArray &data) const;
+    void map_file(const String &absolute_path);
+    void unmap_file();
+};
+
+} // namespace godot
@@ -24,8 +24,11 @@
 
 // Terrain/HeightMap/Basemap classes (stub on mobile)
 #include "plateau/plateau_terrain.h"
+#include "plateau/plateau_terrain_renderer.h"
 #include "plateau/plateau_height_map_aligner.h"
 #include "plateau/plateau_basemap.h"
+#include "plateau/plateau_tile_pack.h"
+#include "plateau/plateau_basemap_streamer.h"
 
 using namespace godot;
 
@@ -56,9 +59,13 @@ void initialize_gdextension_types(ModuleInitializationLevel p_level)
 	GDREGISTER_CLASS(PLATEAUHeightMapData);
 	GDREGISTER_CLASS(PLATEAUTerrain);
 	GDREGISTER_CLASS(PLATEAUHeightMapAligner);
+	GDREGISTER_CLASS(PLATEAUTerrainRenderer);
 	GDREGISTER_CLASS(PLATEAUTileCoordinate);
+	GDREGISTER_CLASS(PLATEAUTilePack);
 	GDREGISTER_CLASS(PLATEAUVectorTile);
 	GDREGISTER_CLASS(PLATEAUVectorTileDownloader);
+	GDREGISTER_CLASS(PLATEAUBasemapAtlas);
+	GDREGISTER_CLASS(PLATEAUBasemapStreamer);
 
 	// New API: City Model Scene and Filter
 	GDREGISTER_CLASS(PLATEAUFilterCondition);